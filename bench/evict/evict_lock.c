@@ -0,0 +1,247 @@
+/*-
+ * Public Domain 2008-2012 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * evict_lock.c
+ *	A microbenchmark of eviction queue lock contention: many threads read
+ *	random records from an object much larger than the cache, so every
+ *	thread competes for pages queued for eviction.
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <wiredtiger.h>
+
+int	 get_stat(WT_SESSION *, int, uint64_t *);
+int	 populate(void);
+void	*read_thread(void *);
+void	 usage(void);
+
+const char *home = "WT_TEST";		/* Database home */
+const char *uri = "file:evict.wt";	/* Object */
+u_int cache_mb = 10;			/* Cache size in MB */
+u_int nrecords = 200000;		/* Records in the object */
+u_int nthreads = 64;			/* Read threads */
+u_int seconds = 10;			/* Run time */
+
+WT_CONNECTION *conn;
+volatile int running;
+
+int
+populate(void)
+{
+	WT_CURSOR *cursor;
+	WT_SESSION *session;
+	char kbuf[64], vbuf[200];
+	u_int i;
+	int ret;
+
+	if ((ret = conn->open_session(conn, NULL, NULL, &session)) != 0)
+		return (ret);
+	if ((ret = session->create(session, uri,
+	    "key_format=S,value_format=S,"
+	    "leaf_page_max=4KB,internal_page_max=4KB")) != 0)
+		return (ret);
+	if ((ret = session->open_cursor(
+	    session, uri, NULL, "bulk", &cursor)) != 0)
+		return (ret);
+
+	memset(vbuf, 'a', sizeof(vbuf) - 1);
+	vbuf[sizeof(vbuf) - 1] = '\0';
+	for (i = 0; i < nrecords; i++) {
+		(void)snprintf(kbuf, sizeof(kbuf), "%010u", i);
+		cursor->set_key(cursor, kbuf);
+		cursor->set_value(cursor, vbuf);
+		if ((ret = cursor->insert(cursor)) != 0)
+			return (ret);
+	}
+	return (session->close(session, NULL));
+}
+
+void *
+read_thread(void *arg)
+{
+	WT_CURSOR *cursor;
+	WT_SESSION *session;
+	uint64_t *nopsp;
+	unsigned int seed;
+	char kbuf[64];
+	int ret;
+
+	nopsp = arg;
+	seed = (unsigned int)(uintptr_t)arg;
+
+	if ((ret = conn->open_session(conn, NULL, NULL, &session)) != 0 ||
+	    (ret = session->open_cursor(
+	    session, uri, NULL, NULL, &cursor)) != 0) {
+		fprintf(stderr, "read thread: %s\n", wiredtiger_strerror(ret));
+		return (NULL);
+	}
+	while (running) {
+		(void)snprintf(kbuf, sizeof(kbuf),
+		    "%010u", (u_int)rand_r(&seed) % nrecords);
+		cursor->set_key(cursor, kbuf);
+		if ((ret = cursor->search(cursor)) != 0) {
+			fprintf(stderr,
+			    "search: %s\n", wiredtiger_strerror(ret));
+			break;
+		}
+		++*nopsp;
+	}
+	(void)session->close(session, NULL);
+	return (arg);
+}
+
+int
+get_stat(WT_SESSION *session, int key, uint64_t *valuep)
+{
+	WT_CURSOR *cursor;
+	const char *desc, *pvalue;
+	int ret;
+
+	if ((ret = session->open_cursor(
+	    session, "statistics:", NULL, NULL, &cursor)) != 0)
+		return (ret);
+	cursor->set_key(cursor, key);
+	if ((ret = cursor->search(cursor)) == 0)
+		ret = cursor->get_value(cursor, &desc, &pvalue, valuep);
+	(void)cursor->close(cursor);
+	return (ret);
+}
+
+int
+main(int argc, char *argv[])
+{
+	WT_SESSION *session;
+	pthread_t *tids;
+	uint64_t evicted, modified, nops, *thread_nops, wait_usecs;
+	u_int i;
+	int ch, ret, tret;
+	char config[128];
+
+	while ((ch = getopt(argc, argv, "c:h:n:r:t:")) != EOF)
+		switch (ch) {
+		case 'c':
+			cache_mb = (u_int)atoi(optarg);
+			break;
+		case 'h':
+			home = optarg;
+			break;
+		case 'n':
+			nrecords = (u_int)atoi(optarg);
+			break;
+		case 'r':
+			nthreads = (u_int)atoi(optarg);
+			break;
+		case 't':
+			seconds = (u_int)atoi(optarg);
+			break;
+		default:
+			usage();
+			return (EXIT_FAILURE);
+		}
+	if (nrecords == 0 || nthreads == 0) {
+		usage();
+		return (EXIT_FAILURE);
+	}
+
+	(void)mkdir(home, 0777);
+	(void)snprintf(config, sizeof(config),
+	    "create,cache_size=%uMB,session_max=%u", cache_mb, nthreads + 10);
+	if ((ret = wiredtiger_open(home, NULL, config, &conn)) != 0) {
+		fprintf(stderr, "wiredtiger_open: %s\n",
+		    wiredtiger_strerror(ret));
+		return (EXIT_FAILURE);
+	}
+	if ((ret = populate()) != 0) {
+		fprintf(stderr, "populate: %s\n", wiredtiger_strerror(ret));
+		goto err;
+	}
+
+	tids = calloc(nthreads, sizeof(*tids));
+	thread_nops = calloc(nthreads, sizeof(*thread_nops));
+	if (tids == NULL || thread_nops == NULL) {
+		ret = ENOMEM;
+		goto err;
+	}
+	running = 1;
+	for (i = 0; i < nthreads; i++)
+		if ((ret = pthread_create(
+		    &tids[i], NULL, read_thread, &thread_nops[i])) != 0) {
+			fprintf(stderr, "pthread_create: %s\n", strerror(ret));
+			running = 0;
+			nthreads = i;
+			break;
+		}
+	if (running)
+		(void)sleep(seconds);
+	running = 0;
+	for (nops = 0, i = 0; i < nthreads; i++) {
+		(void)pthread_join(tids[i], NULL);
+		nops += thread_nops[i];
+	}
+	free(tids);
+	free(thread_nops);
+
+	if ((ret = conn->open_session(conn, NULL, NULL, &session)) != 0 ||
+	    (ret = get_stat(
+	    session, WT_STAT_cache_evict_lock_wait, &wait_usecs)) != 0 ||
+	    (ret = get_stat(
+	    session, WT_STAT_cache_evict_unmodified, &evicted)) != 0 ||
+	    (ret = get_stat(
+	    session, WT_STAT_cache_evict_modified, &modified)) != 0) {
+		fprintf(stderr, "statistics: %s\n", wiredtiger_strerror(ret));
+		goto err;
+	}
+	evicted += modified;
+
+	printf("%u threads, %u seconds, %uMB cache, %u records\n",
+	    nthreads, seconds, cache_mb, nrecords);
+	printf("%" PRIu64 " reads, %" PRIu64 " pages evicted\n",
+	    nops, evicted);
+	printf("eviction lock wait: %" PRIu64 "us, %.3fus per eviction\n",
+	    wait_usecs, evicted == 0 ? 0.0 : (double)wait_usecs / evicted);
+
+err:	if ((tret = conn->close(conn, NULL)) != 0) {
+		fprintf(stderr, "close: %s\n", wiredtiger_strerror(tret));
+		if (ret == 0)
+			ret = tret;
+	}
+	return (ret == 0 ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+void
+usage(void)
+{
+	fprintf(stderr, "usage: evict_lock [-c cache MB] [-h home] "
+	    "[-n records] [-r threads] [-t seconds]\n");
+}
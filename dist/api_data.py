@@ -113,6 +113,34 @@ lsm_config = [
 	Config('lsm_merge_max', '15', r'''
 		the maximum number of chunks to include in a merge operation''',
 		min='2', max='100'),
+	Config('lsm_merge_policy', 'tiered', r'''
+		how chunks are chosen for merges.  The \c tiered policy merges
+		runs of adjacent chunks of similar size.  The \c leveled policy
+		arranges chunks in levels of non-overlapping key ranges, each
+		level holding 10 times as many chunks as the previous one, and
+		merges a chunk with only the chunks of the next level whose key
+		ranges it overlaps''',
+		choices=['leveled', 'tiered']),
+	Config('lsm_stall_chunks', '50', r'''
+		the number of chunks written from memory and waiting to be
+		merged at which writes to the tree stop until merges catch up,
+		see @ref lsm_throttle.  Zero disables the limit''',
+		min='0'),
+	Config('lsm_stall_size', '0', r'''
+		the size of the chunks written from memory and waiting to be
+		merged at which writes to the tree stop until merges catch up,
+		see @ref lsm_throttle.  Zero disables the limit''',
+		min='0'),
+	Config('lsm_throttle_chunks', '20', r'''
+		the number of chunks written from memory and waiting to be
+		merged above which writes to the tree are slowed down, see
+		@ref lsm_throttle.  Zero disables the limit''',
+		min='0'),
+	Config('lsm_throttle_size', '0', r'''
+		the size of the chunks written from memory and waiting to be
+		merged above which writes to the tree are slowed down, see
+		@ref lsm_throttle.  Zero disables the limit''',
+		min='0'),
 ]
 
 # Per-file configuration
@@ -205,6 +233,9 @@ file_config = format_meta + lsm_config + [
 file_meta = file_config + [
 	Config('checkpoint', '', r'''
 		the file checkpoint entries'''),
+	Config('checkpoint_lsn', '', r'''
+		the log position recovery starts from, set in the metadata
+		file's entry by checkpoints of the whole database'''),
 	Config('version', '(major=0,minor=0)', r'''
 		the file version'''),
 ]
@@ -233,6 +264,15 @@ connection_runtime_config = [
 		min='1MB', max='10TB'),
 	Config('error_prefix', '', r'''
 		prefix string for error messages'''),
+	Config('eviction_dirty_target', '60', r'''
+		continue evicting until the cache has less dirty memory than this
+		(as a percentage).  Must be less than \c eviction_dirty_trigger''',
+		min=5, max=99),
+	Config('eviction_dirty_trigger', '80', r'''
+		trigger eviction when the cache has this much dirty memory (as a
+		percentage).  Until then, eviction prefers clean pages over dirty
+		pages''',
+		min=5, max=99),
 	Config('eviction_target', '80', r'''
 		continue evicting until the cache becomes less full than this
 		(as a percentage).  Must be less than \c eviction_trigger''',
@@ -241,6 +281,11 @@ connection_runtime_config = [
 		trigger eviction when the cache becomes this full (as a
 		percentage)''',
 		min=10, max=99),
+	Config('read_ahead_pages', '8', r'''
+		the number of pages a cursor scanning a file sequentially reads
+		into the cache ahead of its position, using the read-ahead
+		worker threads.  A value of 0 disables read-ahead''',
+		min=0, max=1000),
 	Config('verbose', '', r'''
 		enable messages for various events.  Options are given as a
 		list, such as <code>"verbose=[evictserver,read]"</code>''',
@@ -251,6 +296,7 @@ connection_runtime_config = [
 		    'evictserver',
 		    'fileops',
 		    'hazard',
+		    'log',
 		    'lsm',
 		    'mutex',
 		    'read',
@@ -454,6 +500,12 @@ methods = {
 		default, a platform-specific alignment value is used (512 bytes
 		on Linux systems, zero elsewhere)''',
 		min='-1', max='1MB'),
+	Config('buffer_pool_size', '16MB', r'''
+		maximum bytes of aligned I/O buffers kept for reuse.  Pages read
+		into the cache take their buffers from the pool, and return them
+		when the pages are discarded, avoiding an aligned allocation per
+		page read.  A value of 0 disables the pool''',
+		min='0', max='1GB'),
 	Config('create', 'false', r'''
 		create the database if it does not exist''',
 		type='boolean'),
@@ -461,6 +513,11 @@ methods = {
 		Use \c O_DIRECT to access files.  Options are given as a
 		list, such as <code>"direct_io=[data]"</code>''',
 		type='list', choices=['data', 'log']),
+	Config('eviction_workers', '0', r'''
+		additional threads to help the eviction server evict pages from
+		the cache.  The eviction server still chooses the pages to
+		evict, the worker threads reconcile and discard them''',
+		min=0, max=20),
 	Config('extensions', '', r'''
 		list of extensions to load.  Optional values are passed as the
 		\c config parameter to WT_CONNECTION::load_extension.  Complex
@@ -470,17 +527,53 @@ methods = {
 	Config('hazard_max', '1000', r'''
 		maximum number of simultaneous hazard references per session handle''',
 		min='15'),
+	Config('io_backend', 'sync', r'''
+		how batches of reads and writes, such as the pages read by the
+		read-ahead workers, are issued.  With \c sync, each run of
+		adjacent blocks is read or written by the calling thread; with
+		\c threads, runs are issued in parallel by a pool of I/O
+		threads; with \c io_uring, runs are submitted together through
+		a Linux io_uring, falling back to \c threads if io_uring is not
+		available''',
+		choices=['sync', 'io_uring', 'threads']),
+	Config('io_threads', '4', r'''
+		the number of I/O threads if the \c io_backend configuration is
+		\c threads, or if io_uring is not available''',
+		min=1, max=64),
+	Config('log_file_max', '100MB', r'''
+		the maximum size of a log file, when a log file grows past this
+		size, a new log file is created.  Log files are removed once a
+		checkpoint makes them unnecessary for recovery''',
+		min='100KB', max='2GB'),
 	Config('logging', 'false', r'''
-		enable logging''',
+		enable write-ahead logging of transactional updates, see
+		@ref transaction_durability for more information''',
 		type='boolean'),
+	Config('lsm_flush_workers', '2', r'''
+		the number of threads shared by all LSM trees to write chunks
+		to disk once they become read-only.  Chunks are flushed in the
+		order they fill, but a chunk that still has cursors writing to
+		it does not delay the chunks after it''',
+		min=1, max=20),
 	Config('lsm_merge', 'true', r'''
 		merge LSM chunks where possible''',
 		type='boolean'),
+	Config('lsm_merge_workers', '2', r'''
+		the number of threads shared by all LSM trees to merge chunks.
+		Merges in different trees, or of different chunks in the same
+		tree, run concurrently; trees with the most chunks are merged
+		first''',
+		min=1, max=20),
 	Config('multiprocess', 'false', r'''
 		permit sharing between processes (will automatically start an
 		RPC server for primary processes and use RPC for secondary
 		processes). <b>Not yet supported in WiredTiger</b>''',
 		type='boolean'),
+	Config('read_ahead_workers', '2', r'''
+		the number of threads shared by all files to read pages into
+		the cache ahead of sequential cursor scans.  A value of 0
+		disables read-ahead''',
+		min=0, max=20),
 	Config('session_max', '50', r'''
 		maximum expected number of sessions (including server
 		threads)''',
@@ -513,6 +606,7 @@ flags = {
 		'VERB_evict',
 		'VERB_evictserver',
 		'VERB_fileops',
+		'VERB_log',
 		'VERB_lsm',
 		'VERB_hazard',
 		'VERB_mutex',
@@ -528,7 +622,10 @@ flags = {
 # Structure flag declarations
 ###################################################
 	'conn' : [
+		'CONN_LOGGING',
+		'CONN_LSM_FLUSHERS',
 		'CONN_LSM_MERGE',
+		'CONN_LSM_WORKERS',
 		'CONN_SYNC',
 		'CONN_TRANSACTIONAL',
 		'SERVER_RUN'
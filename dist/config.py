@@ -187,8 +187,8 @@ __wt_confchk_%(name)s[] = {
 };
 ''' % {
 	'name' : name,
-	'check' : '\n\t'.join('"\n\t    "'.join(w.wrap('{ "%s", "%s", %s },' %
-		(c.name, gettype(c), checkstr(c)))) for c in sorted(ctype)),
+	'check' : '\n\t'.join('"\n\t    "'.join(w.wrap('{ "%s", "%s", %s }' %
+		(c.name, gettype(c), checkstr(c)))) + ',' for c in sorted(ctype)),
 })
 
 tfile.close()
@@ -9,14 +9,40 @@ tmp_file = '__tmp'
 
 # Map log record types to C
 c_types = {
+		'item' : 'WT_ITEM *',
+		'recno' : 'uint64_t',
 		'string' : 'const char *',
+		'uint32' : 'uint32_t',
+		'uint64' : 'uint64_t',
+}
+
+# Map log record types to C types used to return values when unpacking
+c_unpack_types = {
+		'item' : 'WT_ITEM *',
+		'recno' : 'uint64_t *',
+		'string' : 'const char **',
+		'uint32' : 'uint32_t *',
+		'uint64' : 'uint64_t *',
 }
 
 # Map log record types to format strings
 fmt_types = {
+		'item' : 'u',
+		'recno' : 'r',
 		'string' : 'S',
+		'uint32' : 'I',
+		'uint64' : 'Q',
 }
 
+def param_decl(fields, types):
+	return ''.join(', %s%s' % (types[t],
+	    n if types[t].endswith('*') else ' ' + n) for t, n in fields)
+
+def unpack_decl(fields):
+	return ''.join(', %s%sp' % (c_unpack_types[t],
+	    n if c_unpack_types[t].endswith('*') else ' ' + n)
+	    for t, n in fields)
+
 #####################################################################
 # Create log.i with inline functions for each log record type.
 #####################################################################
@@ -25,19 +51,66 @@ tfile = open(tmp_file, 'w')
 
 tfile.write('/* DO NOT EDIT: automatically built by dist/log.py. */\n')
 
-for t in log_data.types:
-	tfile.write('''
+tfile.write('\n/* Log record types. */\n')
+for i, t in enumerate(log_data.rectypes):
+	tfile.write('#define\tWT_LOGREC_%s\t%d\n' % (t.name.upper(), i))
+tfile.write('\n/* Log operation types. */\n')
+for i, t in enumerate(log_data.optypes):
+	tfile.write('#define\tWT_LOGOP_%s\t%d\n' % (t.name.upper(), i))
+
+def wrap(first, rest, indent):
+	# Wrap a C function call or declaration at 80 columns, breaking the
+	# argument list after commas, with a 4-space continuation indent.
+	width = 80 - 8 * len(indent)
+	lines = []
+	cur = first
+	for arg in rest.split(', '):
+		sep = '' if cur == first or cur == '    ' else ' '
+		if len(cur) + len(sep) + len(arg) + 1 > width and \
+		    cur != first and cur != '    ':
+			lines.append(cur)
+			cur = '    '
+			sep = ''
+		cur += sep + arg + ','
+	lines.append(cur[:-1])
+	return '\n'.join(indent + l for l in lines)
+
+for prefix, typelist in (('rec', log_data.rectypes), ('op', log_data.optypes)):
+	for t in typelist:
+		if not t.fields:
+			continue
+		args = {
+			'prefix' : prefix,
+			'uprefix' : prefix.upper(),
+			'name' : t.name,
+			'uname' : t.name.upper(),
+		}
+		tfile.write('''
 static inline int
-__wt_logput_%(name)s(WT_SESSION_IMPL *session, %(param_decl)s)
+%s
 {
-	return (__wt_log_put(session, &__wt_logdesc_%(name)s, %(param_list)s));
+%s
 }
-''' % {
-	'name' : t.name,
-	'param_decl' : ', '.join(
-	    '%s %s' % (c_types.get(t, t), n) for t, n in t.fields),
-	'param_list' : ', '.join(n for t, n in t.fields),
-})
+
+static inline int
+%s
+{
+%s
+}
+''' % (
+	wrap('__wt_log%(prefix)s_%(name)s_pack(' % args,
+	    'WT_SESSION_IMPL *session, WT_ITEM *logrec%s)' %
+	    param_decl(t.fields, c_types), ''),
+	wrap('return (__wt_log%(prefix)s_pack(' % args,
+	    'session, logrec, WT_LOG%(uprefix)s_%(uname)s, '
+	    '&__wt_logdesc_%(prefix)s_%(name)s' % args +
+	    ''.join(', ' + n for t, n in t.fields) + '));', '\t'),
+	wrap('__wt_log%(prefix)s_%(name)s_unpack(' % args,
+	    'WT_SESSION_IMPL *session, const uint8_t **pp, '
+	    'const uint8_t *end%s)' % unpack_decl(t.fields), ''),
+	wrap('return (__wt_log_unpack(',
+	    'session, pp, end, &__wt_logdesc_%(prefix)s_%(name)s' % args +
+	    ''.join(', ' + n + 'p' for t, n in t.fields) + '));', '\t')))
 
 tfile.close()
 compare_srcfile(tmp_file, f)
@@ -53,14 +126,18 @@ tfile.write('''/* DO NOT EDIT: automatically built by dist/log.py. */
 #include "wt_internal.h"
 ''')
 
-for t in log_data.types:
-	tfile.write('''
+for prefix, typelist in (('rec', log_data.rectypes), ('op', log_data.optypes)):
+	for t in typelist:
+		if not t.fields:
+			continue
+		tfile.write('''
 WT_LOGREC_DESC
-__wt_logdesc_%(name)s =
+__wt_logdesc_%(prefix)s_%(name)s =
 {
 	"%(fmt)s", { %(field_list)s, NULL }
 };
 ''' % {
+	'prefix' : prefix,
 	'name' : t.name,
 	'fmt' : ''.join(fmt_types[t] for t, n in t.fields),
 	'field_list' : ', '.join('"%s"' % n for t, n in t.fields),
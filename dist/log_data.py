@@ -1,10 +1,38 @@
-# Data for config.py, describes all configuration key / value pairs
+# Data for log.py, describes all log record and log operation types.
 
 class LogRecordType:
 	def __init__(self, name, fields):
 		self.name = name
 		self.fields = fields
 
-types = [
-	LogRecordType('debug', [('string', 'message')])
+class LogOperationType:
+	def __init__(self, name, fields):
+		self.name = name
+		self.fields = fields
+
+# Log record types: each record written to the log starts with one of these.
+# The record type number is the position in this list, do not re-order.
+rectypes = [
+	LogRecordType('invalid', []),
+	LogRecordType('file_header',
+	    [('uint32', 'magic'), ('uint32', 'version')]),
+	LogRecordType('checkpoint',
+	    [('uint32', 'ckpt_file'), ('uint64', 'ckpt_offset')]),
+	LogRecordType('commit', [('uint64', 'txnid')]),
+	LogRecordType('debug', [('string', 'message')]),
+]
+
+# Operations in a commit record: a commit record is followed by the list of
+# operations done by the transaction, each prefixed by its type and size.
+# The operation type number is the position in this list, do not re-order.
+optypes = [
+	LogOperationType('invalid', []),
+	LogOperationType('col_put',
+	    [('string', 'uri'), ('recno', 'recno'), ('item', 'value')]),
+	LogOperationType('col_remove',
+	    [('string', 'uri'), ('recno', 'recno')]),
+	LogOperationType('row_put',
+	    [('string', 'uri'), ('item', 'key'), ('item', 'value')]),
+	LogOperationType('row_remove',
+	    [('string', 'uri'), ('item', 'key')]),
 ]
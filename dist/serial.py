@@ -10,12 +10,18 @@ class SerialArg:
 		self.sized = sized
 
 class Serial:
-	def __init__(self, name, args):
+	def __init__(self, name, lock, args):
 		self.name = name
+		self.lock = lock
 		self.args = args
 
+# Page modifications are serialized by a per-page lock, so threads updating
+# different pages never contend; other calls use the connection's lock.
+page_lock = '&page->modify->serial_lock'
+conn_lock = '&S2C(session)->serial_lock'
+
 msgtypes = [
-Serial('col_append', [
+Serial('col_append', page_lock, [
 		SerialArg('WT_PAGE *', 'page'),
 		SerialArg('uint32_t', 'write_gen'),
 		SerialArg('WT_INSERT_HEAD **', 'insheadp'),
@@ -26,9 +32,8 @@ Serial('col_append', [
 		SerialArg('u_int', 'skipdepth'),
 	]),
 
-Serial('insert', [
+Serial('insert', page_lock, [
 		SerialArg('WT_PAGE *', 'page'),
-		SerialArg('uint32_t', 'write_gen'),
 		SerialArg('WT_INSERT_HEAD **', 'inshead'),
 		SerialArg('WT_INSERT ***', 'ins_stack'),
 		SerialArg('WT_INSERT_HEAD **', 'new_inslist', 1),
@@ -37,17 +42,11 @@ Serial('insert', [
 		SerialArg('u_int', 'skipdepth'),
 	]),
 
-Serial('row_key', [
-		SerialArg('WT_PAGE *', 'page'),
-		SerialArg('WT_ROW *', 'row_arg'),
-		SerialArg('WT_IKEY *', 'ikey'),
-	]),
-
-Serial('sync_file', [
+Serial('sync_file', conn_lock, [
 		SerialArg('int', 'syncop'),
 	]),
 
-Serial('update', [
+Serial('update', page_lock, [
 		SerialArg('WT_PAGE *', 'page'),
 		SerialArg('uint32_t', 'write_gen'),
 		SerialArg('WT_UPDATE **', 'srch_upd'),
@@ -118,9 +117,9 @@ typedef struct {
 ''')
 		else:
 			f.write('\targs->' + l.name + ' = ' + l.name + ';\n\n')
-	f.write('\t__wt_spin_lock(session, &S2C(session)->serial_lock);\n')
+	f.write('\t__wt_spin_lock(session, ' + entry.lock + ');\n')
 	f.write('\tret = __wt_' + entry.name + '_serial_func(session, args);\n')
-	f.write('\t__wt_spin_unlock(session, &S2C(session)->serial_lock);\n\n')
+	f.write('\t__wt_spin_unlock(session, ' + entry.lock + ');\n\n')
 	for l in entry.args:
 		if not l.sized:
 			continue
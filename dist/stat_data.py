@@ -20,24 +20,44 @@ class Stat:
 connection_stats = [
 	Stat('block_read', 'blocks read from a file'),
 	Stat('block_write', 'blocks written to a file'),
+	Stat('cache_bytes_bloom', 'cache: bytes in loaded Bloom filters', 'perm'),
+	Stat('cache_bytes_dirty', 'cache: tracked dirty bytes in the cache', 'perm'),
 	Stat('cache_bytes_inuse', 'cache: bytes currently held in the cache', 'perm'),
 	Stat('cache_bytes_max', 'cache: maximum bytes configured', 'perm'),
+	Stat('cache_evict_dirty', 'cache: eviction server passes triggered by dirty bytes'),
 	Stat('cache_evict_hazard', 'cache: pages selected for eviction not evicted because of a hazard reference'),
 	Stat('cache_evict_internal', 'cache: internal pages evicted'),
+	Stat('cache_evict_lock_wait', 'cache: eviction queue lock wait time (usecs)'),
 	Stat('cache_evict_modified', 'cache: modified pages evicted'),
 	Stat('cache_evict_slow', 'cache: eviction server unable to reach eviction goal'),
+	Stat('cache_evict_tree_hot', 'cache: eviction server trees skipped because all pages were recently used'),
+	Stat('cache_evict_tree_supply', 'cache: eviction server trees that supplied eviction candidates'),
+	Stat('cache_evict_tree_walk', 'cache: eviction server trees walked'),
 	Stat('cache_evict_unmodified', 'cache: unmodified pages evicted'),
+	Stat('cache_evict_worker_bytes', 'cache: bytes written by eviction worker threads'),
+	Stat('cache_evict_worker_pages', 'cache: pages evicted by eviction worker threads'),
+	Stat('cache_evict_worker_usecs', 'cache: eviction worker thread time reconciling pages (usecs)'),
 	Stat('cache_pages_inuse', 'cache: pages currently held in the cache', 'perm'),
+	Stat('cache_read_ahead', 'cache: pages queued for read-ahead'),
+	Stat('cache_read_ahead_hit', 'cache: read-ahead pages used by a cursor'),
+	Stat('cache_read_ahead_wasted', 'cache: read-ahead pages discarded without being used'),
 	Stat('checkpoint', 'checkpoints'),
 	Stat('cond_wait', 'condition wait calls'),
 	Stat('file_open', 'files currently open'),
+	Stat('io_batch', 'I/O: batches of reads or writes'),
+	Stat('io_batch_calls', 'I/O: calls to issue batches of reads or writes'),
+	Stat('iobuf_alloc', 'I/O: buffers allocated for the buffer pool'),
+	Stat('iobuf_reuse', 'I/O: buffers reused from the buffer pool'),
+	Stat('log_bytes_written', 'log: bytes written'),
+	Stat('log_records', 'log: records written'),
+	Stat('log_syncs', 'log: sync operations'),
+	Stat('log_writes', 'log: write operations'),
 	Stat('memalloc', 'total memory allocations'),
 	Stat('memfree', 'total memory frees'),
 	Stat('rwlock_rdlock', 'rwlock readlock calls'),
 	Stat('rwlock_wrlock', 'rwlock writelock calls'),
 	Stat('total_read_io', 'total read I/Os'),
 	Stat('total_write_io', 'total write I/Os'),
-	Stat('txn_ancient', 'ancient transactions'),
 	Stat('txn_begin', 'transactions'),
 	Stat('txn_commit', 'transactions committed'),
 	Stat('txn_fail_cache', 'transaction failures due to cache overflow'),
@@ -59,6 +79,8 @@ btree_stats = [
 	Stat('cursor_updates', 'cursor-updates'),
 	Stat('extend', 'file: block allocations required file extension'),
 	Stat('file_allocsize', 'page size allocation unit'),
+	Stat('file_bytes_dirty', 'file: dirty bytes held in the cache'),
+	Stat('file_bytes_inuse', 'file: bytes currently held in the cache'),
 	Stat('file_bulk_loaded', 'bulk-loaded entries'),
 	Stat('file_col_deleted', 'column-store deleted values'),
 	Stat('file_col_fix_pages', 'column-store fixed-size leaf pages'),
@@ -67,6 +89,7 @@ btree_stats = [
 	Stat('file_compact_rewrite', 'pages rewritten by compaction'),
 	Stat('file_entries', 'total entries'),
 	Stat('file_fixed_len', 'fixed-record size'),
+	Stat('file_insert_retries', 'skiplist insert retries'),
 	Stat('file_magic', 'magic number'),
 	Stat('file_major', 'major version number'),
 	Stat('file_maxintlitem', 'maximum internal page item size'),
@@ -84,8 +107,10 @@ btree_stats = [
 	Stat('overflow_value_cache', 'file: overflow values cached in memory'),
 	Stat('page_evict', 'file: pages evicted from the file'),
 	Stat('page_evict_fail', 'file: pages that were selected for eviction that could not be evicted'),
+	Stat('page_evict_queued', 'file: pages queued for eviction'),
 	Stat('page_read', 'file: pages read from the file'),
 	Stat('page_write', 'file: pages written to the file'),
+	Stat('page_write_staged', 'file: pages staged for batched checkpoint writes'),
 	Stat('rec_dictionary', 'reconcile: dictionary match'),
 	Stat('rec_hazard', 'reconcile: unable to acquire hazard reference'),
 	Stat('rec_ovfl_key', 'reconcile: overflow key'),
@@ -98,6 +123,15 @@ btree_stats = [
 	Stat('update_conflict', 'update conflicts'),
 ]
 
+##########################################
+# Eviction worker statistics
+##########################################
+evict_worker_stats = [
+	Stat('bytes_write', 'eviction worker: bytes written'),
+	Stat('pages_evict', 'eviction worker: pages evicted'),
+	Stat('rec_usecs', 'eviction worker: time reconciling pages (usecs)'),
+]
+
 ##########################################
 # LSM statistics
 ##########################################
@@ -108,6 +142,7 @@ lsm_stats = [
 	Stat('bloom_hits', 'Number of bloom filter hits'),
 	Stat('bloom_misses', 'Number of bloom filter misses'),
 	Stat('search_miss_no_bloom', 'Number of queries that could have benefited from a bloom filter that did not exist'),
+	Stat('search_range_skips', 'Number of chunk searches skipped because the key was outside the chunk\'s key range'),
 	Stat('bloom_space', 'Total space used by bloom filters'),
 	Stat('bloom_cache_evict', 'Number of bloom pages evicted from cache'),
 	Stat('bloom_cache_read', 'Number of bloom pages read into cache'),
@@ -118,5 +153,16 @@ lsm_stats = [
 	Stat('cache_read', 'Number of pages read into cache'),
 	Stat('cache_write', 'Number of pages written from cache'),
 	Stat('generation_max', 'Highest merge generation in the LSM tree'),
+	Stat('merge_count', 'Number of merges completed'),
+	Stat('merge_rows', 'Number of rows written by merges'),
+	Stat('merge_tombstones', 'Number of deleted records dropped by minor merges'),
+	Stat('merge_usecs', 'Time spent merging, in microseconds'),
+	Stat('unmerged_chunks', 'Number of chunks written from memory waiting to be merged'),
+	Stat('unmerged_size', 'Size of the chunks written from memory waiting to be merged'),
+	Stat('write_stall', 'Number of writes stopped until merges caught up'),
+	Stat('write_stalled', 'Writes are stopped until merges catch up'),
+	Stat('write_throttle', 'Number of writes slowed down to wait for merges'),
+	Stat('write_throttle_delay', 'Current delay added to each write to wait for merges, in microseconds'),
+	Stat('write_throttle_usecs', 'Time writes spent waiting for merges, in microseconds'),
 ]
 
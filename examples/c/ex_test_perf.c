@@ -33,6 +33,8 @@
 #include <errno.h>
 #include <stdlib.h>
 #include <sys/time.h>
+#include <dirent.h>
+#include <fcntl.h>
 #include <pthread.h>
 #include <inttypes.h>
 #include <unistd.h>
@@ -55,6 +57,7 @@ typedef struct {
 	uint32_t read_threads;	/* Number of read threads. */
 	uint32_t verbose;
 	uint32_t stat_thread;	/* Whether to create a stat thread. */
+	uint32_t direct_io;	/* Compare buffered and direct I/O. */
 	WT_CONNECTION *conn;
 	FILE *logf;
 #define	LSM_TEST_PERF_INIT	0x00
@@ -65,6 +68,8 @@ typedef struct {
 } CONFIG;
 
 /* Forward function definitions. */
+int drop_os_cache(CONFIG *);
+int execute_direct_io(CONFIG *);
 int execute_reads(CONFIG *);
 int populate(CONFIG *);
 void print_config(CONFIG *);
@@ -90,6 +95,7 @@ CONFIG default_cfg = {
 	2,		/* read_threads */
 	0,		/* verbose */
 	0,		/* stat_thread */
+	0,		/* direct_io */
 	NULL,		/* conn */
 	NULL,		/* logf */
 	LSM_TEST_PERF_INIT, /* phase */
@@ -113,6 +119,7 @@ CONFIG small_cfg = {
 	8,		/* read_threads */
 	0,		/* verbose */
 	0,		/* stat_thread */
+	0,		/* direct_io */
 	NULL,		/* conn */
 	NULL,		/* logf */
 	LSM_TEST_PERF_INIT, /* phase */
@@ -136,6 +143,7 @@ CONFIG med_cfg = {
 	16,		/* read_threads */
 	0,		/* verbose */
 	0,		/* stat_thread */
+	0,		/* direct_io */
 	NULL,		/* conn */
 	NULL,		/* logf */
 	LSM_TEST_PERF_INIT, /* phase */
@@ -159,6 +167,7 @@ CONFIG large_cfg = {
 	16,		/* read_threads */
 	0,		/* verbose */
 	0,		/* stat_thread */
+	0,		/* direct_io */
 	NULL,		/* conn */
 	NULL,		/* logf */
 	LSM_TEST_PERF_INIT, /* phase */
@@ -421,7 +430,7 @@ int main(int argc, char **argv)
 	CONFIG cfg;
 	WT_CONNECTION *conn;
 	const char *user_cconfig, *user_tconfig;
-	const char *opts = "C:R:T:d:eh:i:k:lr:s:u:v:SML";
+	const char *opts = "C:DR:T:d:eh:i:k:lr:s:u:v:SML";
 	char *cc_buf, *tc_buf;
 	int ch, ret, stat_created;
 	pthread_t stat;
@@ -491,6 +500,9 @@ int main(int argc, char **argv)
 		case 'C':
 			user_cconfig = optarg;
 			break;
+		case 'D':
+			cfg.direct_io = 1;
+			break;
 		case 'R':
 			cfg.read_threads = atoi(optarg);
 			break;
@@ -508,6 +520,13 @@ int main(int argc, char **argv)
 			return (EINVAL);
 		}
 
+	/* The statistics thread can't follow the connection being re-opened. */
+	if (cfg.direct_io && cfg.stat_thread) {
+		fprintf(stderr, "-D and -l are incompatible\n");
+		usage();
+		return (EINVAL);
+	}
+
 	if ((ret = setup_log_file(&cfg)) != 0)
 		goto err;
 
@@ -575,9 +594,15 @@ int main(int argc, char **argv)
 	if (cfg.create != 0 && (ret = populate(&cfg)) != 0)
 		goto err;
 
-	if (cfg.read_time != 0 && cfg.read_threads != 0)
-		if ((ret = execute_reads(&cfg)) != 0)
+	if (cfg.read_time != 0 && cfg.read_threads != 0) {
+		if (cfg.direct_io) {
+			ret = conn->close(conn, NULL);
+			conn = cfg.conn = NULL;
+			if (ret != 0 || (ret = execute_direct_io(&cfg)) != 0)
+				goto err;
+		} else if ((ret = execute_reads(&cfg)) != 0)
 			goto err;
+	}
 
 	if (cfg.verbose > 0) {
 		fprintf(cfg.logf,
@@ -664,6 +689,104 @@ int execute_reads(CONFIG *cfg)
 	return (ret);
 }
 
+/*
+ * Evict the database's files from the operating system's cache, so a run with
+ * buffered I/O doesn't read pages the load or an earlier run left there.
+ */
+int drop_os_cache(CONFIG *cfg)
+{
+#ifdef POSIX_FADV_DONTNEED
+	DIR *dirp;
+	struct dirent *dp;
+	char path[512];
+	int fd, ret;
+
+	if ((dirp = opendir(cfg->home)) == NULL)
+		return (errno);
+	ret = 0;
+	while (ret == 0 && (dp = readdir(dirp)) != NULL) {
+		if (dp->d_name[0] == '.')
+			continue;
+		snprintf(path, sizeof(path), "%s/%s", cfg->home, dp->d_name);
+		if ((fd = open(path, O_RDONLY)) == -1)
+			continue;
+		/* Dirty pages can't be dropped, write them first. */
+		if (fsync(fd) != 0)
+			ret = errno;
+		else
+			ret = posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+		(void)close(fd);
+	}
+	(void)closedir(dirp);
+	return (ret);
+#else
+	printf("Can't evict %s from the OS cache: "
+	    "buffered reads may find pages there\n", cfg->home);
+	return (0);
+#endif
+}
+
+/*
+ * Direct I/O reads blocks following a file's 512B description sector, buffers
+ * must be aligned to divide it.
+ */
+#define	DIRECT_IO_CONFIG	",direct_io=[data],buffer_alignment=512"
+
+/*
+ * Run the read workload with buffered I/O, then with direct I/O, re-opening
+ * the database each time and evicting its files from the operating system's
+ * cache, so both runs start with empty caches.
+ */
+int execute_direct_io(CONFIG *cfg)
+{
+	WT_CONNECTION *conn;
+	char *cc_buf;
+	const char *mode[] = { "buffered", "direct" };
+	double rate[2];
+	int i, ret, t_ret;
+	size_t req_len;
+
+	req_len = strlen(cfg->conn_config) + strlen(DIRECT_IO_CONFIG) + 1;
+	if ((cc_buf = calloc(req_len, 1)) == NULL)
+		return (ENOMEM);
+
+	for (i = 0; i < 2; i++) {
+		snprintf(cc_buf, req_len, "%s%s",
+		    cfg->conn_config, i == 0 ? "" : DIRECT_IO_CONFIG);
+		if ((ret = drop_os_cache(cfg)) != 0) {
+			fprintf(stderr, "Error evicting %s from the OS cache: "
+			    "%s\n", cfg->home, strerror(ret));
+			break;
+		}
+		if ((ret = wiredtiger_open(
+		    cfg->home, NULL, cc_buf, &conn)) != 0) {
+			fprintf(stderr, "Error connecting to %s: %s\n",
+			    cfg->home, wiredtiger_strerror(ret));
+			break;
+		}
+		cfg->conn = conn;
+		ret = execute_reads(cfg);
+		cfg->conn = NULL;
+		if ((t_ret = conn->close(conn, NULL)) != 0 && ret == 0)
+			ret = t_ret;
+		if (ret != 0)
+			break;
+
+		rate[i] = (double)nops / cfg->read_time;
+		printf("%s I/O: %" PRIu64 " reads in %d secs, %.2f reads/sec\n",
+		    mode[i], nops, cfg->read_time, rate[i]);
+		if (cfg->logf != NULL)
+			fprintf(cfg->logf,
+			    "%s I/O: %.2f reads/sec\n", mode[i], rate[i]);
+	}
+	if (ret == 0 && rate[0] != 0)
+		printf("direct/buffered read throughput: %.2f\n",
+		    rate[1] / rate[0]);
+
+	free(cc_buf);
+	return (ret);
+}
+
 void print_config(CONFIG *cfg)
 {
 	printf("Workload configuration:\n");
@@ -680,6 +803,8 @@ void print_config(CONFIG *cfg)
 	printf("\t Read workload period: %d\n", cfg->read_time);
 	printf("\t Number read threads: %d\n", cfg->read_threads);
 	printf("\t Verbosity: %d\n", cfg->verbose);
+	if (cfg->direct_io)
+		printf("\t Comparing buffered and direct I/O\n");
 }
 
 void usage(void)
@@ -689,6 +814,7 @@ void usage(void)
 	printf("\t-M Use a medium default configuration\n");
 	printf("\t-L Use a large default configuration\n");
 	printf("\t-C <string> additional connection configuration\n");
+	printf("\t-D compare read throughput with buffered and direct I/O\n");
 	printf("\t-R <int> number of read threads\n");
 	printf("\t-T <string> additional table configuration\n");
 	printf("\t-d <int> data item size\n");
@@ -220,6 +220,9 @@ COMPARE_OK(__wt_cursor::search_near)
 %ignore __wt_cursor::compare(WT_CURSOR *, WT_CURSOR *, int *);
 %ignore __wt_cursor::search_near(WT_CURSOR *, int *);
 
+/* Batched searches take C arrays, they aren't available from Python. */
+%ignore __wt_cursor::search_batch;
+
 /* SWIG magic to turn Python byte strings into data / size. */
 %apply (char *STRING, int LENGTH) { (char *data, int size) };
 
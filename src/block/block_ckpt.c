@@ -216,6 +216,12 @@ __wt_block_checkpoint(WT_SESSION_IMPL *session,
 		WT_RET(__wt_block_write_off(session, block, buf,
 		    &ci->root_offset, &ci->root_size, &ci->root_cksum, 0));
 
+	/*
+	 * The root page is the last page of the checkpoint: write any staged
+	 * blocks, they must be on disk before the checkpoint references them.
+	 */
+	WT_RET(__wt_block_stage_end(session, block));
+
 	/* Process the checkpoint list, deleting and updating as required. */
 	WT_RET(__ckpt_process(session, block, ckptbase));
 
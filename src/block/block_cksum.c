@@ -1080,8 +1080,8 @@ static const uint32_t g_crc_slicing[8][256] = {
 };
 
 /*
- * __wt_cksum --
- *	Return a checksum for a chunk of memory.
+ * __cksum_sw --
+ *	Return a checksum for a chunk of memory, computed in software.
  *
  * Slicing-by-8 algorithm by Michael E. Kounavis and Frank L. Berry from
  * Intel Corp.:
@@ -1094,8 +1094,8 @@ static const uint32_t g_crc_slicing[8][256] = {
  * value of the crc is byte reversed from what it would be at that step for
  * little endian.
  */
-uint32_t
-__wt_cksum(const void *chunk, size_t len)
+static uint32_t
+__cksum_sw(const void *chunk, size_t len)
 {
 	uint32_t crc, next;
 	size_t nqwords;
@@ -1158,3 +1158,76 @@ __wt_cksum(const void *chunk, size_t len)
 #endif
 	return (~crc);
 }
+
+#if defined(__GNUC__) && (defined(x86_64) || defined(__x86_64__))
+/*
+ * __cksum_hw --
+ *	Return a checksum for a chunk of memory, computed with the SSE4.2
+ *	crc32 instruction, which implements the same CRC32C polynomial as
+ *	the tables.
+ */
+static uint32_t
+__cksum_hw(const void *chunk, size_t len)
+{
+	uint64_t crc64;
+	uint32_t crc;
+	size_t nqwords;
+	const uint8_t *p;
+
+	crc = 0xffffffff;
+
+	/* Checksum one byte at a time to the first 8B boundary. */
+	for (p = chunk;
+	    ((uintptr_t)p & (sizeof(uint64_t) - 1)) != 0 &&
+	    len > 0; ++p, --len)
+		__asm__ __volatile__(
+		    "crc32b %1, %0" : "+r" (crc) : "rm" (*p));
+
+	/* Checksum in 8B chunks. */
+	crc64 = crc;
+	for (nqwords = len / sizeof(uint64_t); nqwords; nqwords--) {
+		__asm__ __volatile__(
+		    "crc32q %1, %0" : "+r" (crc64) : "rm" (*(uint64_t *)p));
+		p += sizeof(uint64_t);
+	}
+	crc = (uint32_t)crc64;
+
+	/* Checksum trailing bytes one byte at a time. */
+	for (len &= 0x7; len > 0; ++p, len--)
+		__asm__ __volatile__(
+		    "crc32b %1, %0" : "+r" (crc) : "rm" (*p));
+
+	return (~crc);
+}
+#endif
+
+static uint32_t (*__cksum_func)(const void *, size_t) = __cksum_sw;
+
+/*
+ * __wt_cksum_init --
+ *	Choose the checksum implementation for this CPU.
+ */
+void
+__wt_cksum_init(void)
+{
+#if defined(__GNUC__) && (defined(x86_64) || defined(__x86_64__))
+	uint32_t eax, ebx, ecx, edx;
+
+	/* CPUID leaf 1 reports SSE4.2 support in bit 20 of ECX. */
+	__asm__ __volatile__ ("cpuid"
+	    : "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx)
+	    : "a" (1));
+	if (ecx & (1U << 20))
+		__cksum_func = __cksum_hw;
+#endif
+}
+
+/*
+ * __wt_cksum --
+ *	Return a checksum for a chunk of memory.
+ */
+uint32_t
+__wt_cksum(const void *chunk, size_t len)
+{
+	return ((*__cksum_func)(chunk, len));
+}
@@ -375,6 +375,38 @@ __wt_block_off_remove_overlap(
 	return (0);
 }
 
+/*
+ * __block_alloc_stage --
+ *	Return the available extent from which to allocate a staged checkpoint
+ * write, NULL if the file should be extended.
+ */
+static WT_EXT *
+__block_alloc_stage(WT_BLOCK *block, off_t size)
+{
+	WT_EXT *after, *before;
+	WT_EXTLIST *el;
+	WT_SIZE *szp, **sstack[WT_SKIP_MAXDEPTH];
+
+	el = &block->live.avail;
+
+	/*
+	 * Staged writes are written in file order, and adjacent blocks are
+	 * written with a single call: keep the checkpoint's blocks together.
+	 * Continue from the end of the last block written if the following
+	 * space is free, else take the smallest extent large enough to hold
+	 * a run of blocks (the lowest-offset extent of that size), else extend
+	 * the file.
+	 */
+	if (block->stage_next == block->fh->file_size)
+		return (NULL);
+	__block_off_srch_pair(el, block->stage_next, &before, &after);
+	if (after != NULL &&
+	    after->off == block->stage_next && after->size >= size)
+		return (after);
+	__block_size_srch(el->sz, WT_MAX(size, WT_BLOCK_STAGE_EXTENT), sstack);
+	return ((szp = *sstack[0]) == NULL ? NULL : szp->off[0]);
+}
+
 /*
  * __wt_block_alloc --
  *	Alloc a chunk of space from the underlying file.
@@ -399,16 +431,21 @@ __wt_block_alloc(
 	 * the by-size offset list.  This means we prefer best-fit over lower
 	 * offset, but within a size we'll prefer an offset appearing earlier
 	 * in the file.  If we don't have anything big enough, extend the file.
+	 *
+	 * Checkpoints stage their writes and allocate for contiguity instead.
 	 */
-	__block_size_srch(block->live.avail.sz, size, sstack);
-	szp = *sstack[0];
-	if (szp == NULL) {
+	if (block->stage)
+		ext = __block_alloc_stage(block, size);
+	else {
+		__block_size_srch(block->live.avail.sz, size, sstack);
+		ext = (szp = *sstack[0]) == NULL ? NULL : szp->off[0];
+	}
+	if (ext == NULL) {
 		WT_RET(__wt_block_extend(session, block, offp, size));
 		goto done;
 	}
 
-	/* Remove the first record, and set the returned offset. */
-	ext = szp->off[0];
+	/* Remove the record, and set the returned offset. */
 	WT_RET(__block_off_remove(session, &block->live.avail, ext->off, &ext));
 	*offp = ext->off;
 
@@ -433,7 +470,10 @@ __wt_block_alloc(
 		__wt_free(session, ext);
 	}
 
-done:	/* Add the newly allocated extent to the list of allocations. */
+done:	if (block->stage)
+		block->stage_next = *offp + size;
+
+	/* Add the newly allocated extent to the list of allocations. */
 	WT_RET(__block_merge(session, &block->live.alloc, *offp, (off_t)size));
 	return (0);
 }
@@ -532,7 +572,12 @@ __wt_block_off_free(
 	 * workloads including repeated overflow record modification).  If this
 	 * extent is referenced in a previous checkpoint, merge into the discard
 	 * list.
+	 *
+	 * A staged write of a block allocated during this checkpoint is no
+	 * longer needed.
 	 */
+	if (block->stage_cur->entries != 0)
+		__wt_block_stage_discard(session, block, offset, size);
 	if ((ret = __wt_block_off_remove_overlap(
 	    session, &block->live.alloc, offset, size)) == 0)
 		ret = __block_merge(
@@ -266,6 +266,23 @@ __wt_bm_read(WT_SESSION_IMPL *session,
 	return (__wt_block_read(session, block, buf, addr, addr_size));
 }
 
+/*
+ * __wt_bm_read_batch --
+ *	Read a set of address cookie-referenced blocks into buffers.
+ */
+int
+__wt_bm_read_batch(WT_SESSION_IMPL *session, WT_ITEM *bufs,
+    const uint8_t **addrs, uint32_t *addr_sizes, u_int n)
+{
+	WT_BLOCK *block;
+
+	if ((block = session->btree->block) == NULL)
+		return (__bm_invalid(session));
+
+	return (__wt_block_read_batch(
+	    session, block, bufs, addrs, addr_sizes, n));
+}
+
 /*
  * __wt_bm_write_size --
  *	Return the buffer size required to write a block.
@@ -297,6 +314,37 @@ __wt_bm_write(
 	return (__wt_block_write(session, block, buf, addr, addr_size));
 }
 
+/*
+ * __wt_bm_stage_start --
+ *	Start staging writes for a checkpoint.
+ */
+int
+__wt_bm_stage_start(WT_SESSION_IMPL *session)
+{
+	WT_BLOCK *block;
+
+	if ((block = session->btree->block) == NULL)
+		return (__bm_invalid(session));
+
+	__wt_block_stage_start(session, block);
+	return (0);
+}
+
+/*
+ * __wt_bm_stage_end --
+ *	Write any staged writes and stop staging.
+ */
+int
+__wt_bm_stage_end(WT_SESSION_IMPL *session)
+{
+	WT_BLOCK *block;
+
+	if ((block = session->btree->block) == NULL)
+		return (__bm_invalid(session));
+
+	return (__wt_block_stage_end(session, block));
+}
+
 /*
  * __wt_bm_stat --
  *	Block-manager statistics.
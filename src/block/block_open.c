@@ -114,6 +114,11 @@ __wt_block_open(WT_SESSION_IMPL *session, const char *filename,
 	/* Initialize the live checkpoint's lock. */
 	__wt_spin_init(session, &block->live_lock);
 
+	/* Initialize checkpoint write staging. */
+	block->stage_cur = &block->stage_batch[0];
+	WT_ERR(__wt_cond_alloc(
+	    session, "block stage", 0, &block->stage_cond));
+
 	/*
 	 * Read the description sector.
 	 *
@@ -146,6 +151,8 @@ __wt_block_close(WT_SESSION_IMPL *session, WT_BLOCK *block)
 	if (block->name != NULL)
 		__wt_free(session, block->name);
 
+	__wt_block_stage_destroy(session, block);
+
 	if (block->fh != NULL)
 		WT_TRET(__wt_close(session, block->fh));
 
@@ -33,20 +33,29 @@ __wt_block_read(WT_SESSION_IMPL *session, WT_BLOCK *block,
 }
 
 /*
- * __wt_block_read_off --
- *	Read an addr/size pair referenced block into a buffer.
+ * __block_buf_init --
+ *	Initialize the caller's buffer for a block: buffers without memory take
+ * it from the connection's pool of I/O buffers.
  */
-int
-__wt_block_read_off(WT_SESSION_IMPL *session, WT_BLOCK *block,
-    WT_ITEM *buf, off_t offset, uint32_t size, uint32_t cksum)
+static int
+__block_buf_init(WT_SESSION_IMPL *session, WT_ITEM *buf, size_t size)
 {
-	WT_BLOCK_HEADER *blk;
-	WT_DECL_ITEM(tmp);
-	WT_DECL_RET;
-	WT_PAGE_HEADER *dsk;
-	size_t result_len;
-	uint32_t page_cksum;
+	if (buf->mem == NULL)
+		return (__wt_iobuf_get(session, size, buf));
+
+	F_SET(buf, WT_ITEM_ALIGNED);
+	return (__wt_buf_init(session, buf, size));
+}
 
+/*
+ * __block_read_setup --
+ *	Return the memory into which a block is read.
+ */
+static int
+__block_read_setup(WT_SESSION_IMPL *session, WT_BLOCK *block,
+    WT_ITEM *buf, off_t offset, uint32_t size, uint32_t cksum,
+    WT_ITEM **tmpp, void **dskp)
+{
 	WT_VERBOSE_RET(session, read,
 	    "off %" PRIuMAX ", size %" PRIu32 ", cksum %" PRIu32,
 	    (uintmax_t)offset, size, cksum);
@@ -64,25 +73,49 @@ __wt_block_read_off(WT_SESSION_IMPL *session, WT_BLOCK *block,
 		    __wt_block_misplaced(session, block, "read", offset, size));
 #endif
 
+	/*
+	 * A block written by a checkpoint may still be staged: make sure it's
+	 * written before reading it.  (Reading the flag without a lock is safe,
+	 * a block's address isn't published until its write has been staged,
+	 * and staging doesn't stop until every staged block has been written.)
+	 */
+	if (block->stage)
+		WT_RET(__wt_block_stage_read(session, block, offset, size));
+
 	/*
 	 * If we're compressing the file blocks, place the initial read into a
 	 * scratch buffer, we're going to have to re-allocate more memory for
 	 * decompression.  Else check the caller's buffer size and grow it as
 	 * necessary, there will only be one buffer.
 	 */
+	*tmpp = NULL;
 	if (block->compressor == NULL) {
-		F_SET(buf, WT_ITEM_ALIGNED);
-		WT_RET(__wt_buf_init(session, buf, size));
+		WT_RET(__block_buf_init(session, buf, size));
 		buf->size = size;
-		dsk = buf->mem;
+		*dskp = buf->mem;
 	} else {
-		WT_RET(__wt_scr_alloc(session, size, &tmp));
-		tmp->size = size;
-		dsk = tmp->mem;
+		WT_RET(__wt_scr_alloc(session, size, tmpp));
+		(*tmpp)->size = size;
+		*dskp = (*tmpp)->mem;
 	}
+	return (0);
+}
 
-	/* Read. */
-	WT_ERR(__wt_read(session, block->fh, offset, size, dsk));
+/*
+ * __block_read_check --
+ *	Check the checksum of a block that's been read, and decompress it into
+ * the caller's buffer.
+ */
+static int
+__block_read_check(WT_SESSION_IMPL *session, WT_BLOCK *block,
+    WT_ITEM *buf, WT_ITEM *tmp, off_t offset, uint32_t size, uint32_t cksum)
+{
+	WT_BLOCK_HEADER *blk;
+	WT_PAGE_HEADER *dsk;
+	size_t result_len;
+	uint32_t page_cksum;
+
+	dsk = tmp == NULL ? buf->mem : tmp->mem;
 	blk = WT_BLOCK_HEADER_REF(dsk);
 
 	/* Validate the checksum. */
@@ -100,7 +133,7 @@ __wt_block_read_off(WT_SESSION_IMPL *session, WT_BLOCK *block,
 				    PRIu32 "B @ %" PRIuMAX ", %"
 				    PRIu32 " != %" PRIu32 "]",
 				    size, (uintmax_t)offset, cksum, page_cksum);
-			WT_ERR(WT_ERROR);
+			return (WT_ERROR);
 		}
 	}
 
@@ -114,9 +147,9 @@ __wt_block_read_off(WT_SESSION_IMPL *session, WT_BLOCK *block,
 	 */
 	if (blk->disk_size < dsk->size) {
 		if (block->compressor == NULL)
-			WT_ERR(__wt_illegal_value(session, block->name));
+			return (__wt_illegal_value(session, block->name));
 
-		WT_ERR(__wt_buf_init(session, buf, dsk->size));
+		WT_RET(__block_buf_init(session, buf, dsk->size));
 		buf->size = dsk->size;
 
 		/*
@@ -130,7 +163,7 @@ __wt_block_read_off(WT_SESSION_IMPL *session, WT_BLOCK *block,
 		 * an example.
 		 */
 		memcpy(buf->mem, tmp->mem, WT_BLOCK_COMPRESS_SKIP);
-		WT_ERR(block->compressor->decompress(
+		WT_RET(block->compressor->decompress(
 		    block->compressor, &session->iface,
 		    (uint8_t *)tmp->mem + WT_BLOCK_COMPRESS_SKIP,
 		    tmp->size - WT_BLOCK_COMPRESS_SKIP,
@@ -138,26 +171,99 @@ __wt_block_read_off(WT_SESSION_IMPL *session, WT_BLOCK *block,
 		    dsk->size - WT_BLOCK_COMPRESS_SKIP,
 		    &result_len));
 		if (result_len != dsk->size - WT_BLOCK_COMPRESS_SKIP)
-			WT_ERR(__wt_illegal_value(session, block->name));
-	} else
-		if (block->compressor == NULL)
-			buf->size = dsk->size;
-		else
-			/*
-			 * We guessed wrong: there was a compressor, but this
-			 * block was not compressed, and now the page is in the
-			 * wrong buffer and the buffer may be of the wrong size.
-			 * This should be rare, why configure a compressor that
-			 * doesn't work?  Allocate a buffer of the right size
-			 * (we used a scratch buffer which might be large), and
-			 * copy the data into place.
-			 */
-			WT_ERR(
-			    __wt_buf_set(session, buf, tmp->data, dsk->size));
+			return (__wt_illegal_value(session, block->name));
+	} else if (block->compressor == NULL)
+		buf->size = dsk->size;
+	else {
+		/*
+		 * We guessed wrong: there was a compressor, but this block was
+		 * not compressed, and now the page is in the wrong buffer and
+		 * the buffer may be of the wrong size.  This should be rare,
+		 * why configure a compressor that doesn't work?  Allocate a
+		 * buffer of the right size (we used a scratch buffer which
+		 * might be large), and copy the data into place.
+		 */
+		WT_RET(__block_buf_init(session, buf, dsk->size));
+		memcpy(buf->mem, tmp->data, dsk->size);
+		buf->size = dsk->size;
+	}
 
 	WT_BSTAT_INCR(session, page_read);
 	WT_CSTAT_INCR(session, block_read);
 
+	return (0);
+}
+
+/*
+ * __wt_block_read_off --
+ *	Read an addr/size pair referenced block into a buffer.
+ */
+int
+__wt_block_read_off(WT_SESSION_IMPL *session, WT_BLOCK *block,
+    WT_ITEM *buf, off_t offset, uint32_t size, uint32_t cksum)
+{
+	WT_DECL_ITEM(tmp);
+	WT_DECL_RET;
+	void *dsk;
+
+	WT_RET(__block_read_setup(
+	    session, block, buf, offset, size, cksum, &tmp, &dsk));
+	WT_ERR(__wt_read(session, block->fh, offset, size, dsk));
+	WT_ERR(__block_read_check(
+	    session, block, buf, tmp, offset, size, cksum));
+
 err:	__wt_scr_free(&tmp);
 	return (ret);
 }
+
+/*
+ * __wt_block_read_batch --
+ *	Read a set of filesystem cookie referenced blocks into buffers, with
+ * batched I/O.
+ */
+int
+__wt_block_read_batch(WT_SESSION_IMPL *session, WT_BLOCK *block,
+    WT_ITEM *bufs, const uint8_t **addrs, uint32_t *addr_sizes, u_int n)
+{
+	WT_DECL_RET;
+	WT_IO_REQ reqs[WT_BLOCK_READ_BATCH];
+	WT_ITEM *tmp[WT_BLOCK_READ_BATCH];
+	uint32_t cksum[WT_BLOCK_READ_BATCH];
+	u_int base, cnt, i;
+
+	memset(tmp, 0, sizeof(tmp));
+	for (base = 0; base < n; base += cnt) {
+		cnt = WT_MIN(n - base, WT_BLOCK_READ_BATCH);
+
+		/* Crack the cookies and set up the reads. */
+		for (i = 0; i < cnt; ++i) {
+			reqs[i].fh = block->fh;
+			WT_ERR(__wt_block_buffer_to_addr(block,
+			    addrs[base + i], &reqs[i].offset,
+			    &reqs[i].bytes, &cksum[i]));
+			WT_ERR(__block_read_setup(session, block,
+			    &bufs[base + i], reqs[i].offset, reqs[i].bytes,
+			    cksum[i], &tmp[i], &reqs[i].buf));
+		}
+
+		/* Read the blocks. */
+		WT_ERR(__wt_read_batch(session, reqs, cnt));
+
+		/* Check the blocks, optionally verify the pages. */
+		for (i = 0; i < cnt; ++i) {
+			WT_ERR(__block_read_check(session, block,
+			    &bufs[base + i], tmp[i],
+			    reqs[i].offset, reqs[i].bytes, cksum[i]));
+			if (block->verify)
+				WT_ERR(__wt_block_verify(session, block,
+				    &bufs[base + i], addrs[base + i],
+				    addr_sizes[base + i],
+				    reqs[i].offset, reqs[i].bytes));
+			__wt_scr_free(&tmp[i]);
+		}
+	}
+
+err:	for (i = 0; i < WT_BLOCK_READ_BATCH; ++i)
+		__wt_scr_free(&tmp[i]);
+	return (ret);
+}
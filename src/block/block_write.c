@@ -57,6 +57,303 @@ __wt_block_write(WT_SESSION_IMPL *session,
 	return (0);
 }
 
+/*
+ * __block_stage_srch --
+ *	Return the index of the first staged write in a batch ending after an
+ * offset.
+ */
+static u_int
+__block_stage_srch(WT_BLOCK_STAGE *batch, off_t offset)
+{
+	WT_IO_REQ *req;
+	u_int base, indx, limit;
+
+	for (base = 0, limit = batch->entries; limit != 0; limit >>= 1) {
+		indx = base + (limit >> 1);
+		req = &batch->reqs[indx];
+		if (req->offset + (off_t)req->bytes <= offset) {
+			base = indx + 1;
+			--limit;
+		}
+	}
+	return (base);
+}
+
+/*
+ * __block_stage_find --
+ *	Return if a batch has a staged write overlapping a range of the file.
+ */
+static int
+__block_stage_find(WT_BLOCK_STAGE *batch, off_t offset, uint32_t size)
+{
+	u_int indx;
+
+	indx = __block_stage_srch(batch, offset);
+	return (indx < batch->entries &&
+	    batch->reqs[indx].offset < offset + (off_t)size);
+}
+
+/*
+ * __block_stage --
+ *	Stage a copy of a checkpoint write.
+ */
+static int
+__block_stage(WT_SESSION_IMPL *session,
+    WT_BLOCK *block, off_t offset, uint32_t size, const void *dsk)
+{
+	WT_BLOCK_STAGE *batch;
+	WT_IO_REQ *req;
+	WT_ITEM buf;
+	u_int indx, n;
+
+	/*
+	 * Callers of this function are expected to have acquired the live
+	 * lock, it protects the staged batch.
+	 */
+	batch = block->stage_cur;
+	n = batch->entries + 1;
+	if (batch->reqs_alloc < n * sizeof(WT_IO_REQ))
+		WT_RET(__wt_realloc(session, &batch->reqs_alloc,
+		    WT_MAX(2 * n, 64) * sizeof(WT_IO_REQ), &batch->reqs));
+	if (batch->bufs_alloc < n * sizeof(WT_ITEM))
+		WT_RET(__wt_realloc(session, &batch->bufs_alloc,
+		    WT_MAX(2 * n, 64) * sizeof(WT_ITEM), &batch->bufs));
+
+	WT_CLEAR(buf);
+	WT_RET(__wt_iobuf_get(session, size, &buf));
+	memcpy(buf.mem, dsk, size);
+	buf.size = size;
+
+	/*
+	 * Keep the batch sorted by offset, so reads and frees can search it.
+	 * Checkpoints mostly allocate in file order, blocks are usually
+	 * appended.
+	 */
+	indx = __block_stage_srch(batch, offset);
+	if (indx < batch->entries) {
+		memmove(&batch->reqs[indx + 1], &batch->reqs[indx],
+		    (batch->entries - indx) * sizeof(WT_IO_REQ));
+		memmove(&batch->bufs[indx + 1], &batch->bufs[indx],
+		    (batch->entries - indx) * sizeof(WT_ITEM));
+	}
+	batch->bufs[indx] = buf;
+
+	req = &batch->reqs[indx];
+	req->fh = block->fh;
+	req->offset = offset;
+	req->bytes = size;
+	req->buf = buf.mem;
+
+	++batch->entries;
+	batch->bytes += size;
+	WT_BSTAT_INCR(session, page_write_staged);
+	return (0);
+}
+
+/*
+ * __block_stage_wait --
+ *	Wait for the batch being written, if any.
+ */
+static void
+__block_stage_wait(WT_SESSION_IMPL *session, WT_BLOCK *block)
+{
+	while (block->stage_flight != NULL)
+		__wt_cond_wait(session, block->stage_cond, 10000);
+}
+
+/*
+ * __block_stage_flush --
+ *	Write the staged checkpoint writes.
+ */
+static int
+__block_stage_flush(WT_SESSION_IMPL *session, WT_BLOCK *block)
+{
+	WT_BLOCK_STAGE *batch;
+	WT_DECL_RET;
+	u_int i;
+
+	/*
+	 * Detach the staged batch under the live lock, and write it after
+	 * releasing the lock: allocation continues, staging into the other
+	 * batch.  Batches are written one at a time, so a block freed from the
+	 * batch being written and reallocated is written after the batch.
+	 */
+	for (;;) {
+		__block_stage_wait(session, block);
+		__wt_spin_lock(session, &block->live_lock);
+		if (block->stage_flight == NULL)
+			break;
+		__wt_spin_unlock(session, &block->live_lock);
+	}
+	batch = block->stage_cur;
+	if (batch->entries == 0) {
+		__wt_spin_unlock(session, &block->live_lock);
+		return (0);
+	}
+	block->stage_flight = batch;
+	block->stage_cur = batch == &block->stage_batch[0] ?
+	    &block->stage_batch[1] : &block->stage_batch[0];
+	__wt_spin_unlock(session, &block->live_lock);
+
+	/* The batch is written in file order, adjacent blocks together. */
+	ret = __wt_write_batch(session, batch->reqs, batch->entries);
+	if (ret != 0)
+		block->stage_error = ret;
+
+	for (i = 0; i < batch->entries; ++i)
+		__wt_buf_free(session, &batch->bufs[i]);
+	batch->entries = 0;
+	batch->bytes = 0;
+
+	/* Wake any readers waiting for the batch. */
+	WT_PUBLISH(block->stage_flight, NULL);
+	__wt_cond_signal(session, block->stage_cond);
+	return (ret);
+}
+
+/*
+ * __wt_block_stage_start --
+ *	Start staging writes for a checkpoint.
+ */
+void
+__wt_block_stage_start(WT_SESSION_IMPL *session, WT_BLOCK *block)
+{
+	__wt_spin_lock(session, &block->live_lock);
+	block->stage = 1;
+	block->stage_next = WT_BLOCK_INVALID_OFFSET;
+	block->stage_error = 0;
+	__wt_spin_unlock(session, &block->live_lock);
+}
+
+/*
+ * __wt_block_stage_end --
+ *	Write any staged writes and stop staging.
+ */
+int
+__wt_block_stage_end(WT_SESSION_IMPL *session, WT_BLOCK *block)
+{
+	WT_DECL_RET;
+
+	/*
+	 * Other threads stage writes until staging stops: write batches until
+	 * nothing is staged or being written, and stop staging while holding
+	 * the lock.  Writes that aren't staged may reuse space freed from a
+	 * batch, they can't start until the batch is written.
+	 */
+	for (;;) {
+		WT_TRET(__block_stage_flush(session, block));
+		__block_stage_wait(session, block);
+
+		__wt_spin_lock(session, &block->live_lock);
+		if (block->stage_cur->entries == 0 &&
+		    block->stage_flight == NULL) {
+			block->stage = 0;
+			__wt_spin_unlock(session, &block->live_lock);
+			break;
+		}
+		__wt_spin_unlock(session, &block->live_lock);
+	}
+
+	/* Batches written by readers report their errors here too. */
+	if (ret == 0)
+		ret = block->stage_error;
+	return (ret);
+}
+
+/*
+ * __wt_block_stage_read --
+ *	Make sure a block about to be read isn't staged or being written.
+ */
+int
+__wt_block_stage_read(
+    WT_SESSION_IMPL *session, WT_BLOCK *block, off_t offset, uint32_t size)
+{
+	int flight, staged, waited;
+
+	/*
+	 * If the block is staged, write the staged batch.  If it's in the batch
+	 * being written, wait for that write to finish rather than holding the
+	 * live lock while it happens.  The batches are sorted, each check is a
+	 * binary search.
+	 */
+	for (waited = 0;; waited = 1) {
+		__wt_spin_lock(session, &block->live_lock);
+		staged = __block_stage_find(block->stage_cur, offset, size);
+		flight = !staged && block->stage_flight != NULL &&
+		    __block_stage_find(block->stage_flight, offset, size);
+		__wt_spin_unlock(session, &block->live_lock);
+
+		if (staged)
+			WT_RET(__block_stage_flush(session, block));
+		else if (flight)
+			__block_stage_wait(session, block);
+		else
+			break;
+	}
+
+	/* If another thread wrote the block, check that write succeeded. */
+	return (waited ? block->stage_error : 0);
+}
+
+/*
+ * __wt_block_stage_discard --
+ *	Discard staged writes of a range being freed.
+ */
+void
+__wt_block_stage_discard(
+    WT_SESSION_IMPL *session, WT_BLOCK *block, off_t offset, off_t size)
+{
+	WT_BLOCK_STAGE *batch;
+	u_int i, indx;
+
+	/*
+	 * Callers of this function are expected to have acquired the live
+	 * lock.  Only the staged batch is searched: space freed from the batch
+	 * being written can be reallocated at once, because the new contents
+	 * are staged, and written after the batch.
+	 */
+	batch = block->stage_cur;
+	indx = __block_stage_srch(batch, offset);
+	for (i = indx; i < batch->entries &&
+	    batch->reqs[i].offset < offset + size; ++i) {
+		batch->bytes -= batch->reqs[i].bytes;
+		__wt_buf_free(session, &batch->bufs[i]);
+	}
+	if (i == indx)
+		return;
+
+	memmove(&batch->reqs[indx], &batch->reqs[i],
+	    (batch->entries - i) * sizeof(WT_IO_REQ));
+	memmove(&batch->bufs[indx], &batch->bufs[i],
+	    (batch->entries - i) * sizeof(WT_ITEM));
+	batch->entries -= i - indx;
+}
+
+/*
+ * __wt_block_stage_destroy --
+ *	Discard the block's staged writes and staging memory.
+ */
+void
+__wt_block_stage_destroy(WT_SESSION_IMPL *session, WT_BLOCK *block)
+{
+	WT_BLOCK_STAGE *batch;
+	u_int i, j;
+
+	for (i = 0; i < WT_ELEMENTS(block->stage_batch); ++i) {
+		batch = &block->stage_batch[i];
+		for (j = 0; j < batch->entries; ++j)
+			__wt_buf_free(session, &batch->bufs[j]);
+		batch->entries = 0;
+		batch->bytes = 0;
+		__wt_free(session, batch->reqs);
+		__wt_free(session, batch->bufs);
+	}
+	if (block->stage_cond != NULL) {
+		(void)__wt_cond_destroy(session, block->stage_cond);
+		block->stage_cond = NULL;
+	}
+}
+
 /*
  * __wt_block_write_off --
  *	Write a buffer into a block, returning the block's addr/size and
@@ -72,7 +369,7 @@ __wt_block_write_off(WT_SESSION_IMPL *session, WT_BLOCK *block,
 	WT_PAGE_HEADER *dsk;
 	off_t offset;
 	uint32_t align_size, size;
-	int compression_failed;
+	int compression_failed, flush, staged;
 	uint8_t *src, *dst;
 	size_t len, src_len, dst_len, result_len;
 
@@ -223,13 +520,34 @@ not_compressed:	/*
 	} else
 		blk->cksum = WT_BLOCK_CHECKSUM_NOT_SET;
 
+	/*
+	 * Allocate the block; if the checkpoint is staging its writes, copy
+	 * the block instead of writing it.  (Writes from callers holding the
+	 * lock are the checkpoint's own extent lists, written after staging
+	 * ends.)
+	 */
+	flush = staged = 0;
 	if (!locked)
 		__wt_spin_lock(session, &block->live_lock);
-	WT_ERR(__wt_block_alloc(session, block, &offset, (off_t)align_size));
+	ret = __wt_block_alloc(session, block, &offset, (off_t)align_size);
+	if (ret == 0 && !locked && block->stage) {
+		staged = 1;
+		if ((ret = __block_stage(
+		    session, block, offset, align_size, dsk)) != 0)
+			(void)__wt_block_off_free(
+			    session, block, offset, align_size);
+		else if (block->stage_cur->bytes >= WT_BLOCK_STAGE_MAX)
+			flush = 1;
+	}
 	if (!locked)
 		__wt_spin_unlock(session, &block->live_lock);
+	WT_ERR(ret);
+
+	/* Write a full batch without holding the lock. */
+	if (flush)
+		WT_ERR(__block_stage_flush(session, block));
 
-	if ((ret =
+	if (!staged && (ret =
 	    __wt_write(session, block->fh, offset, align_size, dsk)) != 0) {
 		if (!locked)
 			__wt_spin_lock(session, &block->live_lock);
@@ -241,6 +559,7 @@ not_compressed:	/*
 
 	WT_BSTAT_INCR(session, page_write);
 	WT_CSTAT_INCR(session, block_write);
+	session->write_bytes += align_size;
 
 	WT_VERBOSE_ERR(session, write,
 	    "%s (off %" PRIuMAX ", size %" PRIu32 ", cksum %" PRIu32 ")",
@@ -6,12 +6,13 @@
  */
 
 #include "wt_internal.h"
-#include "bloom.h"
 
 #define	WT_BLOOM_TABLE_CONFIG "key_format=r,value_format=1t,exclusive=true"
 
 static int __bloom_init(
     WT_SESSION_IMPL *, const char *, const char *, WT_BLOOM **);
+static int __bloom_load(WT_BLOOM *);
+static int __bloom_load_pages(WT_BLOOM *, WT_BLOOM_MEM *, int *);
 static int __bloom_setup(WT_BLOOM *, uint64_t, uint64_t, uint32_t, uint32_t);
 
 /*
@@ -39,6 +40,7 @@ __bloom_init(WT_SESSION_IMPL *session,
 	    "%s,%s", config == NULL ? "" : config, WT_BLOOM_TABLE_CONFIG);
 
 	bloom->session = session;
+	bloom->memp = &bloom->mem_private;
 
 	*bloomp = bloom;
 	return (0);
@@ -71,8 +73,11 @@ __bloom_setup(
 	bloom->k = k;
 	bloom->factor = factor;
 	if (n != 0) {
+		/* Round the filter up to a whole number of blocks. */
 		bloom->n = n;
 		bloom->m = bloom->n * bloom->factor;
+		bloom->m += WT_BLOOM_BLOCK_BITS - 1;
+		bloom->m -= bloom->m % WT_BLOOM_BLOCK_BITS;
 	} else {
 		bloom->m = m;
 		bloom->n = bloom->m / bloom->factor;
@@ -99,7 +104,8 @@ __wt_bloom_create(
 	WT_RET(__bloom_init(session, uri, config, &bloom));
 	WT_RET(__bloom_setup(bloom, count, 0, factor, k));
 
-	WT_RET(__bit_alloc(session, bloom->m, &bloom->bitstring));
+	WT_RET(__bit_alloc(
+	    session, bloom->m + WT_BLOOM_TRAILER_BITS, &bloom->bitstring));
 
 	*bloomp = bloom;
 	return (0);
@@ -109,11 +115,17 @@ __wt_bloom_create(
  * __wt_bloom_open --
  *	Open a Bloom filter object for use by a single session. The filter must
  *	have been created and finalized.
+ *
+ *	The filter is loaded into memory on first use: if memp is non-NULL,
+ *	the in-memory copy is shared through it by all handles on the filter,
+ *	and the caller frees it with __wt_bloom_mem_free once the filter can
+ *	no longer be opened.  The handle holds a cursor on the filter, so the
+ *	filter can't be dropped while the handle is open.
  */
 int
 __wt_bloom_open(WT_SESSION_IMPL *session,
     const char *uri, uint32_t factor, uint32_t k,
-    WT_CURSOR *owner, WT_BLOOM **bloomp)
+    WT_CURSOR *owner, WT_BLOOM_MEM **memp, WT_BLOOM **bloomp)
 {
 	WT_BLOOM *bloom;
 	WT_CURSOR *c;
@@ -129,6 +141,8 @@ __wt_bloom_open(WT_SESSION_IMPL *session,
 	WT_RET(c->get_key(c, &size));
 
 	bloom->c = c;
+	if (memp != NULL)
+		bloom->memp = memp;
 	WT_RET(__bloom_setup(bloom, 0, size, factor, k));
 
 	*bloomp = bloom;
@@ -142,17 +156,44 @@ __wt_bloom_open(WT_SESSION_IMPL *session,
 int
 __wt_bloom_insert(WT_BLOOM *bloom, WT_ITEM *key)
 {
-	uint64_t h1, h2;
-	uint32_t i;
+	WT_BLOOM_HASH bhash;
 
-	h1 = __wt_hash_fnv64(key->data, key->size);
-	h2 = __wt_hash_city64(key->data, key->size);
-	for (i = 0; i < bloom->k; i++, h1 += h2) {
-		__bit_set(bloom->bitstring, (uint32_t)(h1 % bloom->m));
-	}
+	__wt_bloom_hash(bloom, key, &bhash);
+	__wt_bloom_hash_insert(bloom, &bhash);
 	return (0);
 }
 
+/*
+ * __wt_bloom_hash_insert --
+ *	Adds a key, given by its hash values, to the Bloom filter.  Threads
+ *	can insert into the same filter concurrently.
+ */
+void
+__wt_bloom_hash_insert(WT_BLOOM *bloom, WT_BLOOM_HASH *bhash)
+{
+	uint64_t base, bit;
+	uint32_t a, b, i;
+	uint8_t mask, old, *p;
+
+	/*
+	 * The first hash chooses the block, the second hash generates the
+	 * probes within the block.
+	 */
+	base = (bhash->h1 % (bloom->m / WT_BLOOM_BLOCK_BITS)) *
+	    WT_BLOOM_BLOCK_BITS;
+	a = (uint32_t)bhash->h2;
+	b = (uint32_t)(bhash->h2 >> 32) | 1;
+	for (i = 0; i < bloom->k; i++, a += b) {
+		bit = base + a % WT_BLOOM_BLOCK_BITS;
+		p = &bloom->bitstring[__bit_byte(bit)];
+		mask = (uint8_t)__bit_mask(bit);
+		do {
+			old = *p;
+		} while ((old & mask) == 0 &&
+		    !WT_ATOMIC_CAS(*p, old, (uint8_t)(old | mask)));
+	}
+}
+
 /*
  * __wt_bloom_finalize --
  *	Writes the Bloom filter to stable storage. After calling finalize, only
@@ -164,29 +205,37 @@ __wt_bloom_finalize(WT_BLOOM *bloom)
 	WT_CURSOR *c;
 	WT_DECL_RET;
 	WT_ITEM values;
-	WT_SESSION *wt_session;
+	WT_SESSION_IMPL *session;
 	uint64_t i;
+	const char *cfg[] =
+	    API_CONF_DEFAULTS(session, open_cursor, "bulk=bitmap");
 
-	wt_session = (WT_SESSION *)bloom->session;
+	session = bloom->session;
 	WT_CLEAR(values);
 
+	/* Mark the filter's layout in the trailer. */
+	memcpy(bloom->bitstring + __bit_byte(bloom->m),
+	    WT_BLOOM_MAGIC, WT_BLOOM_TRAILER_BITS / 8);
+
 	/*
-	 * Create a bit table to store the bloom filter in.
-	 * TODO: should this call __wt_schema_create directly?
+	 * Create a bit table to store the bloom filter in.  Callers may hold
+	 * the schema lock already: LSM workers can't wait for it.
 	 */
-	WT_RET(wt_session->create(wt_session, bloom->uri, bloom->config));
-	WT_RET(wt_session->open_cursor(
-	    wt_session, bloom->uri, NULL, "bulk=bitmap", &c));
+	WT_WITH_SCHEMA_LOCK_OPT(session,
+	    ret = __wt_schema_create(session, bloom->uri, bloom->config));
+	WT_RET(ret);
+	WT_RET(__wt_open_cursor(session, bloom->uri, NULL, cfg, &c));
 
 	/* Add the entries from the array into the table. */
-	for (i = 0; i < bloom->m; i += values.size) {
+	for (i = 0; i < bloom->m + WT_BLOOM_TRAILER_BITS; i += values.size) {
 		values.data = bloom->bitstring + (i >> 3);
 		/*
 		 * Shave off some bytes for pure paranoia, in case WiredTiger
 		 * reserves some special sizes. Choose a value so that if
 		 * we do multiple inserts, it will be on an byte boundary.
 		 */
-		values.size = (uint32_t)WT_MIN(bloom->m - i, UINT32_MAX - 128);
+		values.size = (uint32_t)WT_MIN(
+		    bloom->m + WT_BLOOM_TRAILER_BITS - i, UINT32_MAX - 128);
 		c->set_value(c, &values);
 		WT_ERR(c->insert(c));
 	}
@@ -199,70 +248,230 @@ err:	WT_TRET(c->close(c));
 }
 
 /*
- * __wt_bloom_get --
- *	Tests whether the given key is in the Bloom filter.
- *	Returns zero if found, WT_NOTFOUND if not.
+ * __bloom_load_pages --
+ *	Copy a finalized Bloom filter's bits from the leaf pages of its file.
+ *	Filters are bulk-loaded and never updated: each leaf page's bit-field
+ *	is a run of the filter's bits, copied a byte at a time where the run
+ *	starts on a byte boundary.  Returns if the filter was copied, callers
+ *	read filters that aren't plain, unmodified files through the cursor.
  */
-int
-__wt_bloom_get(WT_BLOOM *bloom, WT_ITEM *key)
+static int
+__bloom_load_pages(WT_BLOOM *bloom, WT_BLOOM_MEM *mem, int *copiedp)
 {
+	WT_BTREE *saved_btree;
+	WT_DECL_RET;
+	WT_PAGE *page;
+	WT_SESSION_IMPL *session;
+	uint64_t bit, i, start;
+	uint8_t *bitf;
+
+	session = bloom->session;
+	*copiedp = 0;
+
+	if (!WT_PREFIX_MATCH(bloom->uri, "file:"))
+		return (0);
+
+	saved_btree = session->btree;
+	WT_SET_BTREE_IN_SESSION(
+	    session, ((WT_CURSOR_BTREE *)bloom->c)->btree);
+	if (session->btree->type != BTREE_COL_FIX ||
+	    session->btree->bitcnt != 1)
+		goto done;
+
+	page = NULL;
+	while ((ret = __wt_tree_walk(session, &page, 0)) == 0 &&
+	    page != NULL) {
+		if (page->type != WT_PAGE_COL_FIX)
+			continue;
+		start = page->u.col_fix.recno - 1;
+		if (page->modify != NULL || start + page->entries > mem->m) {
+			__wt_page_release(session, page);
+			goto done;
+		}
+		bitf = page->u.col_fix.bitf;
+		i = 0;
+		if (start % 8 == 0) {
+			i = page->entries - page->entries % 8;
+			memcpy(mem->bitstring + start / 8, bitf, (size_t)i / 8);
+		}
+		for (bit = start + i; i < page->entries; ++i, ++bit)
+			if (__bit_test(bitf, i))
+				__bit_set(mem->bitstring, bit);
+	}
+	if (ret == 0)
+		*copiedp = 1;
+
+done:	WT_SET_BTREE_IN_SESSION(session, saved_btree);
+	return (ret);
+}
+
+/*
+ * __bloom_load --
+ *	Read a finalized Bloom filter into memory.
+ */
+static int
+__bloom_load(WT_BLOOM *bloom)
+{
+	WT_BLOOM_MEM *mem;
+	WT_CACHE *cache;
 	WT_CURSOR *c;
 	WT_DECL_RET;
 	WT_SESSION *wt_session;
-	int result;
-	uint32_t i;
-	uint64_t h1, h2;
+	WT_SESSION_IMPL *session;
+	uint64_t recno, size;
 	uint8_t bit;
+	int copied;
 
-	WT_ASSERT(bloom->session, bloom->bitstring == NULL);
-
-	wt_session = (WT_SESSION *)bloom->session;
+	session = bloom->session;
+	wt_session = (WT_SESSION *)session;
+	mem = NULL;
 
 	/* Create a cursor on the first time through. */
-	if (bloom->c == NULL) {
+	if ((c = bloom->c) == NULL) {
 		WT_RET(wt_session->open_cursor(
 		    wt_session, bloom->uri, NULL, NULL, &c));
 		bloom->c = c;
-	} else
-		c = bloom->c;
+	}
+
+	/* The size of the filter is the largest record number. */
+	WT_ERR(c->reset(c));
+	WT_ERR(c->prev(c));
+	WT_ERR(c->get_key(c, &size));
+	WT_ERR(c->reset(c));
+
+	WT_ERR(__wt_calloc_def(session, 1, &mem));
+	WT_ERR(__bit_alloc(session, size, &mem->bitstring));
+	mem->size = sizeof(WT_BLOOM_MEM) + (size_t)__bitstr_size(size);
+	mem->m = size;
+	WT_ERR(__bloom_load_pages(bloom, mem, &copied));
+	if (!copied) {
+		memset(mem->bitstring, 0, (size_t)__bitstr_size(size));
+		while ((ret = c->next(c)) == 0) {
+			WT_ERR(c->get_key(c, &recno));
+			WT_ERR(c->get_value(c, &bit));
+			if (bit != 0)
+				__bit_set(mem->bitstring, recno - 1);
+		}
+		WT_ERR_NOTFOUND_OK(ret);
+		WT_ERR(c->reset(c));
+	}
 
 	/*
-	 * This comparison code is complex to avoid calculating the second
-	 * hash if possible.
+	 * Filters built with blocks end with a trailer, filters built before
+	 * blocks were introduced have no trailer.
 	 */
-	h1 = __wt_hash_fnv64(key->data, key->size);
+	if (size > WT_BLOOM_TRAILER_BITS &&
+	    (size - WT_BLOOM_TRAILER_BITS) % WT_BLOOM_BLOCK_BITS == 0 &&
+	    memcmp(mem->bitstring + __bit_byte(size - WT_BLOOM_TRAILER_BITS),
+	    WT_BLOOM_MAGIC, WT_BLOOM_TRAILER_BITS / 8) == 0) {
+		mem->m = size - WT_BLOOM_TRAILER_BITS;
+		mem->blocked = 1;
+	}
 
 	/*
-	 * Add 1 to the hash because Wired Tiger tables are 1 based, and the
-	 * original bitstring array was 0 based.
+	 * Publish the filter: if another handle beat us to it, use its copy.
+	 * The filter stays in memory until it is freed: eviction can't free
+	 * it, so it's counted separately from the cache's pages.
 	 */
-	c->set_key(c, (h1 % bloom->m) + 1);
-	WT_RET(c->search(c));
-	WT_RET(c->get_value(c, &bit));
-	if (bit == 0)
-		return (WT_NOTFOUND);
-	h2 = __wt_hash_city64(key->data, key->size);
-	result = 0;
-	for (i = 0, h1 += h2; i < bloom->k - 1; i++, h1 += h2) {
-		c->set_key(c, (h1 % bloom->m) + 1);
-		WT_ERR(c->search(c));
-		WT_ERR(c->get_value(c, &bit));
-
-		if (bit == 0) {
-			result = WT_NOTFOUND;
-			break;
-		}
-	}
-	WT_ERR(c->reset(c));
-	return (result);
+	if (!WT_ATOMIC_CAS(*bloom->memp, NULL, mem))
+		goto err;
+	cache = S2C(session)->cache;
+	(void)WT_ATOMIC_ADD(cache->bytes_bloom, mem->size);
+	return (0);
 
-err:	/* Don't return WT_NOTFOUND from a failed search. */
-	if (ret == WT_NOTFOUND)
-		ret = WT_ERROR;
-	__wt_err(bloom->session, ret, "Failed lookup in bloom filter.");
+err:	if (mem != NULL) {
+		__wt_free(session, mem->bitstring);
+		__wt_free(session, mem);
+	}
 	return (ret);
 }
 
+/*
+ * __wt_bloom_mem_free --
+ *	Discard the in-memory copy of a Bloom filter.
+ */
+void
+__wt_bloom_mem_free(WT_SESSION_IMPL *session, WT_BLOOM_MEM **memp)
+{
+	WT_BLOOM_MEM *mem;
+	WT_CACHE *cache;
+
+	if ((mem = *memp) == NULL)
+		return;
+	*memp = NULL;
+
+	if ((cache = S2C(session)->cache) != NULL)
+		(void)WT_ATOMIC_SUB(cache->bytes_bloom, mem->size);
+	__wt_free(session, mem->bitstring);
+	__wt_free(session, mem);
+}
+
+/*
+ * __wt_bloom_hash --
+ *	Calculate the hash values for a given key.
+ */
+void
+__wt_bloom_hash(WT_BLOOM *bloom, WT_ITEM *key, WT_BLOOM_HASH *bhash)
+{
+	WT_UNUSED(bloom);
+
+	bhash->h1 = __wt_hash_fnv64(key->data, key->size);
+	bhash->h2 = __wt_hash_city64(key->data, key->size);
+}
+
+/*
+ * __wt_bloom_hash_get --
+ *	Tests whether the key (as given by its hash values) is in the Bloom
+ *	filter.  Returns zero if found, WT_NOTFOUND if not.
+ */
+int
+__wt_bloom_hash_get(WT_BLOOM *bloom, WT_BLOOM_HASH *bhash)
+{
+	WT_BLOOM_MEM *mem;
+	uint64_t base, h1, h2;
+	uint32_t a, b, i;
+
+	WT_ASSERT(bloom->session, bloom->bitstring == NULL);
+
+	if ((mem = *bloom->memp) == NULL) {
+		WT_RET(__bloom_load(bloom));
+		mem = *bloom->memp;
+	}
+
+	h1 = bhash->h1;
+	h2 = bhash->h2;
+
+	if (mem->blocked) {
+		/* All of the probes are in a single block, see insert. */
+		base = (h1 % (mem->m / WT_BLOOM_BLOCK_BITS)) *
+		    WT_BLOOM_BLOCK_BITS;
+		a = (uint32_t)h2;
+		b = (uint32_t)(h2 >> 32) | 1;
+		for (i = 0; i < bloom->k; i++, a += b)
+			if (!__bit_test(mem->bitstring,
+			    base + a % WT_BLOOM_BLOCK_BITS))
+				return (WT_NOTFOUND);
+	} else
+		for (i = 0; i < bloom->k; i++, h1 += h2)
+			if (!__bit_test(mem->bitstring, h1 % mem->m))
+				return (WT_NOTFOUND);
+	return (0);
+}
+
+/*
+ * __wt_bloom_get --
+ *	Tests whether the given key is in the Bloom filter.
+ *	Returns zero if found, WT_NOTFOUND if not.
+ */
+int
+__wt_bloom_get(WT_BLOOM *bloom, WT_ITEM *key)
+{
+	WT_BLOOM_HASH bhash;
+
+	__wt_bloom_hash(bloom, key, &bhash);
+	return (__wt_bloom_hash_get(bloom, &bhash));
+}
+
 /*
  * __wt_bloom_close --
  *	Close the Bloom filter, release any resources.
@@ -277,6 +486,7 @@ __wt_bloom_close(WT_BLOOM *bloom)
 
 	if (bloom->c != NULL)
 		ret = bloom->c->close(bloom->c);
+	__wt_bloom_mem_free(session, &bloom->mem_private);
 	__wt_free(session, bloom->uri);
 	__wt_free(session, bloom->config);
 	__wt_free(session, bloom->bitstring);
@@ -36,6 +36,21 @@ __wt_cache_config(WT_CONNECTION_IMPL *conn, const char *cfg[])
 		cache->eviction_trigger = (u_int)cval.val;
 	WT_RET_NOTFOUND_OK(ret);
 
+	if ((ret = __wt_config_gets(
+	    session, cfg, "eviction_dirty_target", &cval)) == 0)
+		cache->eviction_dirty_target = (u_int)cval.val;
+	WT_RET_NOTFOUND_OK(ret);
+
+	if ((ret = __wt_config_gets(
+	    session, cfg, "eviction_dirty_trigger", &cval)) == 0)
+		cache->eviction_dirty_trigger = (u_int)cval.val;
+	WT_RET_NOTFOUND_OK(ret);
+
+	if ((ret =
+	    __wt_config_gets(session, cfg, "read_ahead_pages", &cval)) == 0)
+		cache->read_ahead_pages = (u_int)cval.val;
+	WT_RET_NOTFOUND_OK(ret);
+
 	return (0);
 }
 
@@ -48,7 +63,10 @@ __wt_cache_create(WT_CONNECTION_IMPL *conn, const char *cfg[])
 {
 	WT_CACHE *cache;
 	WT_DECL_RET;
+	WT_EVICT_WORKER *worker;
+	WT_READ_AHEAD_WORKER *ra_worker;
 	WT_SESSION_IMPL *session;
+	u_int i;
 
 	session = conn->default_session;
 
@@ -65,11 +83,44 @@ __wt_cache_create(WT_CONNECTION_IMPL *conn, const char *cfg[])
 	if (cache->eviction_target >= cache->eviction_trigger)
 		WT_ERR_MSG(session, EINVAL,
 		    "eviction target must be lower than the eviction trigger");
+	if (cache->eviction_dirty_target >= cache->eviction_dirty_trigger)
+		WT_ERR_MSG(session, EINVAL, "eviction dirty target must be "
+		    "lower than the eviction dirty trigger");
 
 	WT_ERR(__wt_cond_alloc(session,
 	    "cache eviction server", 0, &cache->evict_cond));
 	__wt_spin_init(session, &cache->evict_lock);
 
+	/* Allocate the eviction workers, their threads are started later. */
+	if (conn->evict_workers != 0) {
+		WT_ERR(__wt_calloc_def(
+		    session, conn->evict_workers, &cache->workers));
+		for (i = 0, worker = cache->workers;
+		    i < conn->evict_workers; i++, worker++) {
+			worker->id = i;
+			WT_ERR(__wt_cond_alloc(session,
+			    "cache eviction worker", 0, &worker->cond));
+			WT_ERR(__wt_stat_alloc_evict_worker_stats(
+			    session, &worker->stats));
+		}
+	}
+
+	/*
+	 * Allocate the read-ahead queue and workers, their threads are started
+	 * later.
+	 */
+	__wt_spin_init(session, &cache->read_ahead_lock);
+	TAILQ_INIT(&cache->read_ahead_qh);
+	if (conn->read_ahead_workers != 0) {
+		WT_ERR(__wt_cond_alloc(session,
+		    "cache read-ahead workers", 0, &cache->read_ahead_cond));
+		WT_ERR(__wt_calloc_def(session,
+		    conn->read_ahead_workers, &cache->read_ahead_workers));
+		for (i = 0, ra_worker = cache->read_ahead_workers;
+		    i < conn->read_ahead_workers; i++, ra_worker++)
+			ra_worker->id = i;
+	}
+
 	/*
 	 * We pull some values from the cache statistics (rather than have two
 	 * copies).   Set them.
@@ -94,6 +145,9 @@ __wt_cache_stats_update(WT_CONNECTION_IMPL *conn)
 	cache = conn->cache;
 
 	WT_STAT_SET(conn->stats, cache_bytes_max, conn->cache_size);
+	WT_STAT_SET(conn->stats, cache_bytes_bloom, cache->bytes_bloom);
+	WT_STAT_SET(
+	    conn->stats, cache_bytes_dirty, __wt_cache_bytes_dirty(cache));
 	WT_STAT_SET(
 	    conn->stats, cache_bytes_inuse, __wt_cache_bytes_inuse(cache));
 	WT_STAT_SET(
@@ -109,6 +163,9 @@ __wt_cache_destroy(WT_CONNECTION_IMPL *conn)
 {
 	WT_SESSION_IMPL *session;
 	WT_CACHE *cache;
+	WT_EVICT_WORKER *worker;
+	WT_READ_AHEAD_UNIT *unit;
+	u_int i;
 
 	session = conn->default_session;
 	cache = conn->cache;
@@ -120,5 +177,28 @@ __wt_cache_destroy(WT_CONNECTION_IMPL *conn)
 		(void)__wt_cond_destroy(session, cache->evict_cond);
 	__wt_spin_destroy(session, &cache->evict_lock);
 
+	if (cache->workers != NULL) {
+		for (i = 0, worker = cache->workers;
+		    i < conn->evict_workers; i++, worker++) {
+			if (worker->cond != NULL)
+				(void)__wt_cond_destroy(session, worker->cond);
+			__wt_free(session, worker->stats);
+		}
+		__wt_free(session, cache->workers);
+	}
+
+	/*
+	 * Closing a file drains its pages from the read-ahead queue, discard
+	 * anything left behind by a failed open.
+	 */
+	while ((unit = TAILQ_FIRST(&cache->read_ahead_qh)) != NULL) {
+		TAILQ_REMOVE(&cache->read_ahead_qh, unit, q);
+		__wt_free(session, unit);
+	}
+	if (cache->read_ahead_cond != NULL)
+		(void)__wt_cond_destroy(session, cache->read_ahead_cond);
+	__wt_spin_destroy(session, &cache->read_ahead_lock);
+	__wt_free(session, cache->read_ahead_workers);
+
 	__wt_free(session, conn->cache);
 }
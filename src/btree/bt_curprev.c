@@ -554,6 +554,13 @@ retry:	__cursor_func_init(cbt, 0);
 				break;
 		}
 
+		/*
+		 * A cursor moving from one leaf page to the next is scanning
+		 * the tree, read ahead of it.
+		 */
+		if (page != NULL && !discard)
+			LF_SET(WT_TREE_READ_AHEAD);
+
 		cbt->page = NULL;
 		do {
 			WT_ERR(__wt_tree_walk(session, &page, flags));
@@ -39,6 +39,10 @@ __wt_page_out(WT_SESSION_IMPL *session, WT_PAGE **pagep, uint32_t flags)
 
 	WT_ASSERT(session, !F_ISSET_ATOMIC(page, WT_PAGE_EVICT_LRU));
 
+	/* Count pages read ahead of a cursor scan that were never used. */
+	if (F_ISSET_ATOMIC(page, WT_PAGE_READ_AHEAD))
+		WT_CSTAT_INCR(session, cache_read_ahead_wasted);
+
 #ifdef HAVE_DIAGNOSTIC
 	{
 	WT_HAZARD *hp;
@@ -57,8 +61,11 @@ __wt_page_out(WT_SESSION_IMPL *session, WT_PAGE **pagep, uint32_t flags)
 		__wt_cache_page_evict(session, page);
 
 	/* Free the page modification information. */
-	if (page->modify != NULL)
+	if (page->modify != NULL) {
+		__wt_cache_dirty_decr(
+		    session, page, page->modify->bytes_dirty);
 		__free_page_modify(session, page);
+	}
 
 	switch (page->type) {
 	case WT_PAGE_COL_FIX:
@@ -77,8 +84,12 @@ __wt_page_out(WT_SESSION_IMPL *session, WT_PAGE **pagep, uint32_t flags)
 		break;
 	}
 
-	if (!LF_ISSET(WT_PAGE_FREE_IGNORE_DISK))	/* Disk image */
-		__wt_free(session, page->dsk);
+	if (!LF_ISSET(WT_PAGE_FREE_IGNORE_DISK)) {	/* Disk image */
+		if (page->dsk_pool_size != 0)
+			__wt_iobuf_put(session, page->dsk, page->dsk_pool_size);
+		else
+			__wt_free(session, page->dsk);
+	}
 
 	__wt_overwrite_and_free(session, page);
 }
@@ -129,6 +140,8 @@ __free_page_modify(WT_SESSION_IMPL *session, WT_PAGE *page)
 	/* Discard any objects the page was tracking plus associated memory. */
 	__wt_rec_track_discard(session, page);
 	__wt_free(session, mod->track);
+
+	__wt_spin_destroy(session, &mod->serial_lock);
 	__wt_free(session, page->modify);
 }
 
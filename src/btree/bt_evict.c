@@ -11,9 +11,10 @@ static void __evict_clear_tree_walk(WT_SESSION_IMPL *, WT_PAGE *);
 static int  __evict_file_request(WT_SESSION_IMPL *, int);
 static int  __evict_file_request_walk(WT_SESSION_IMPL *);
 static int  __evict_lru(WT_SESSION_IMPL *);
-static int  __evict_lru_cmp(const void *, const void *);
+static void __evict_lru_select(WT_EVICT_ENTRY *, u_int, u_int);
+static void __evict_lru_sort(WT_SESSION_IMPL *);
 static int  __evict_walk(WT_SESSION_IMPL *);
-static int  __evict_walk_file(WT_SESSION_IMPL *, u_int *);
+static int  __evict_walk_file(WT_SESSION_IMPL *, u_int *, u_int);
 static int  __evict_worker(WT_SESSION_IMPL *);
 
 /*
@@ -24,10 +25,17 @@ static int  __evict_worker(WT_SESSION_IMPL *);
 #define	WT_EVICT_INT_SKEW	(1<<20)	/* Prefer leaf pages over internal
 					   pages by this many increments of the
 					   read generation. */
+#define	WT_EVICT_DIRTY_SKEW	(1<<18)	/* Prefer clean pages over dirty pages
+					   (or the reverse, if there are too
+					   many dirty pages), by this many
+					   increments of the read generation. */
 #define	WT_EVICT_WALK_PER_FILE	 5	/* Pages to visit per file */
 #define	WT_EVICT_WALK_BASE	50	/* Pages tracked across file visits */
 #define	WT_EVICT_WALK_INCR     100	/* Pages added each walk */
 
+#define	WT_EVICT_CREDIT		1000	/* Walk credit for one page */
+#define	WT_EVICT_HOT_SKIP	10	/* Walks to skip hot files */
+
 /*
  * __evict_list_clr --
  *	Clear an entry in the LRU eviction list.
@@ -200,6 +208,59 @@ err:		__wt_err(session, ret, "eviction server error");
 	return (NULL);
 }
 
+/*
+ * __wt_cache_evict_worker --
+ *	Thread to help the eviction server evict pages from the cache: the
+ * server walks the files and queues pages, the workers drain the queue.
+ */
+void *
+__wt_cache_evict_worker(void *arg)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_EVICT_WORKER *worker;
+	WT_SESSION_IMPL *session;
+	uint64_t bytes_write, pages_evict, rec_usecs;
+
+	worker = arg;
+	session = worker->session;
+	conn = S2C(session);
+
+	while (F_ISSET(conn, WT_SERVER_RUN)) {
+		/* Don't rely on signals: check periodically. */
+		__wt_cond_wait(session, worker->cond, 100000);
+		if (!F_ISSET(conn, WT_SERVER_RUN))
+			break;
+
+		/* Evict pages until the queue is empty. */
+		bytes_write = session->write_bytes;
+		rec_usecs = session->rec_usecs;
+		for (pages_evict = 0;
+		    __wt_evict_lru_page(session, 0) == 0; ++pages_evict)
+			;
+		bytes_write = session->write_bytes - bytes_write;
+		rec_usecs = session->rec_usecs - rec_usecs;
+
+		WT_STAT_INCRV(worker->stats, pages_evict, pages_evict);
+		WT_STAT_INCRV(worker->stats, bytes_write, bytes_write);
+		WT_STAT_INCRV(worker->stats, rec_usecs, rec_usecs);
+		WT_CSTAT_INCRV(session, cache_evict_worker_pages, pages_evict);
+		WT_CSTAT_INCRV(session, cache_evict_worker_bytes, bytes_write);
+		WT_CSTAT_INCRV(session, cache_evict_worker_usecs, rec_usecs);
+	}
+
+	WT_VERBOSE_VOID(session, evictserver,
+	    "worker %u exiting: %" PRIu64 " pages evicted, %" PRIu64
+	    " bytes written, %" PRIu64 "us reconciling",
+	    worker->id, worker->stats->pages_evict.v,
+	    worker->stats->bytes_write.v, worker->stats->rec_usecs.v);
+
+	/* Close the worker's session and free its hazard array. */
+	(void)session->iface.close(&session->iface, NULL);
+	__wt_free(conn->default_session, session->hazard);
+
+	return (NULL);
+}
+
 /*
  * __evict_worker --
  *	Evict pages from memory.
@@ -209,7 +270,7 @@ __evict_worker(WT_SESSION_IMPL *session)
 {
 	WT_CACHE *cache;
 	WT_CONNECTION_IMPL *conn;
-	uint64_t bytes_inuse, bytes_max;
+	uint64_t bytes_dirty, bytes_inuse, bytes_max;
 	int loop;
 
 	conn = S2C(session);
@@ -229,12 +290,26 @@ __evict_worker(WT_SESSION_IMPL *session)
 		__wt_spin_unlock(session, &cache->evict_lock);
 
 		/*
-		 * Keep evicting until we hit the target cache usage.
+		 * Keep evicting until we hit the target cache usage and the
+		 * target dirty bytes.  If the dirty target is met, prefer to
+		 * evict clean pages, they don't have to be written.
 		 */
 		bytes_inuse = __wt_cache_bytes_inuse(cache);
+		bytes_dirty = __wt_cache_bytes_dirty(cache);
 		bytes_max = conn->cache_size;
-		if (bytes_inuse < (cache->eviction_target * bytes_max) / 100)
+		cache->evict_dirty = bytes_dirty >=
+		    (cache->eviction_dirty_target * bytes_max) / 100;
+		if (!cache->evict_dirty &&
+		    bytes_inuse < (cache->eviction_target * bytes_max) / 100)
 			break;
+		if (cache->evict_dirty)
+			WT_STAT_INCR(conn->stats, cache_evict_dirty);
+
+		/*
+		 * Eviction snapshots use the cached oldest transaction ID,
+		 * bring it up-to-date before each pass.
+		 */
+		__wt_txn_update_oldest(session);
 
 		WT_RET(__evict_lru(session));
 
@@ -243,7 +318,8 @@ __evict_worker(WT_SESSION_IMPL *session)
 		 * any progress at all, go back to sleep, it's not something
 		 * we can fix.
 		 */
-		if (__wt_cache_bytes_inuse(cache) >= bytes_inuse) {
+		if (__wt_cache_bytes_inuse(cache) >= bytes_inuse &&
+		    __wt_cache_bytes_dirty(cache) >= bytes_dirty) {
 			if (loop == 10) {
 				WT_STAT_INCR(conn->stats, cache_evict_slow);
 				WT_VERBOSE_RET(session, evictserver,
@@ -488,21 +564,27 @@ static int
 __evict_lru(WT_SESSION_IMPL *session)
 {
 	WT_CACHE *cache;
+	WT_CONNECTION_IMPL *conn;
+	u_int i;
 
-	cache = S2C(session)->cache;
+	conn = S2C(session);
+	cache = conn->cache;
 
 	/* Get some more pages to consider for eviction. */
 	WT_RET(__evict_walk(session));
 
-	/* Sort the list into LRU order and restart. */
+	/* Sort the best candidates into LRU order and restart. */
 	__wt_spin_lock(session, &cache->evict_lock);
-	qsort(cache->evict,
-	    cache->evict_entries, sizeof(WT_EVICT_ENTRY), __evict_lru_cmp);
+	__evict_lru_sort(session);
 	__evict_list_clr_all(session, WT_EVICT_WALK_BASE);
 
 	cache->evict_current = cache->evict;
 	__wt_spin_unlock(session, &cache->evict_lock);
 
+	/* Wake any eviction workers to help drain the queue. */
+	for (i = 0; i < conn->evict_workers; i++)
+		__wt_cond_signal(session, cache->workers[i].cond);
+
 	/* Reconcile and discard some pages. */
 	while (__wt_evict_lru_page(session, 0) == 0)
 		;
@@ -521,7 +603,8 @@ __evict_walk(WT_SESSION_IMPL *session)
 	WT_CACHE *cache;
 	WT_CONNECTION_IMPL *conn;
 	WT_DECL_RET;
-	u_int elem, file_count, i, retries;
+	uint64_t bytes_total;
+	u_int elem, file_count, i, max, retries;
 
 	conn = S2C(session);
 	cache = S2C(session)->cache;
@@ -545,6 +628,15 @@ __evict_walk(WT_SESSION_IMPL *session)
 		__wt_spin_unlock(session, &cache->evict_lock);
 	}
 
+	/*
+	 * Files earn credit in proportion to their share of the cache, and
+	 * are walked for as many candidates as they have credit, so a file
+	 * holding most of the cache supplies most of the candidates and a
+	 * file with a handful of pages is only occasionally visited.
+	 */
+	if ((bytes_total = __wt_cache_bytes_inuse(cache)) == 0)
+		bytes_total = 1;
+
 	/*
 	 * NOTE: we don't hold the schema lock: files can't be removed without
 	 * the eviction server being involved, and when we're here, we aren't
@@ -571,9 +663,29 @@ retry:	file_count = 0;
 		    btree->bulk_load_ok)
 			continue;
 
+		/*
+		 * Skip files where the last walk found only recently used
+		 * pages, for a while.  If we can't fill the eviction list
+		 * without them, they're walked on the retry.
+		 */
+		if (retries == 0 && btree->evict_hot_skip > 0) {
+			--btree->evict_hot_skip;
+			WT_CSTAT_INCR(session, cache_evict_tree_hot);
+			continue;
+		}
+
+		/* Add the file's share of the cache to its credit. */
+		btree->evict_credit += WT_EVICT_WALK_INCR * WT_EVICT_CREDIT *
+		    __wt_btree_bytes_inuse(btree) / bytes_total;
+		if (btree->evict_credit > WT_EVICT_WALK_INCR * WT_EVICT_CREDIT)
+			btree->evict_credit =
+			    WT_EVICT_WALK_INCR * WT_EVICT_CREDIT;
+		if ((max = (u_int)(btree->evict_credit / WT_EVICT_CREDIT)) == 0)
+			continue;
+
 		/* Reference the correct WT_BTREE handle. */
 		WT_SET_BTREE_IN_SESSION(session, btree);
-		ret = __evict_walk_file(session, &i);
+		ret = __evict_walk_file(session, &i, max);
 		WT_CLEAR_BTREE_IN_SESSION(session);
 
 		if (ret != 0 || i == cache->evict_entries)
@@ -597,25 +709,31 @@ err:		__wt_spin_unlock(session, &cache->evict_lock);
  *	Get a few page eviction candidates from a single underlying file.
  */
 static int
-__evict_walk_file(WT_SESSION_IMPL *session, u_int *slotp)
+__evict_walk_file(WT_SESSION_IMPL *session, u_int *slotp, u_int max)
 {
 	WT_BTREE *btree;
 	WT_CACHE *cache;
 	WT_DECL_RET;
 	WT_EVICT_ENTRY *end, *evict, *start;
 	WT_PAGE *page;
-	int restarts;
+	u_int queued;
+	int hot, restarts;
 
 	btree = session->btree;
 	cache = S2C(session)->cache;
 	start = cache->evict + *slotp;
-	end = start + WT_EVICT_WALK_PER_FILE;
+	end = start + max;
 	if (end > cache->evict + cache->evict_entries)
 		end = cache->evict + cache->evict_entries;
 
 	/*
 	 * Get some more eviction candidate pages.
+	 *
+	 * Track whether all of the leaf pages we see were used since the last
+	 * time the eviction list was sorted, that is, they're newer than any
+	 * candidate then considered for eviction.
 	 */
+	hot = cache->evict_horizon != 0;
 	for (evict = start, restarts = 0;
 	    evict < end && ret == 0;
 	    ret = __wt_tree_walk(session, &btree->evict_page, WT_TREE_EVICT)) {
@@ -633,6 +751,11 @@ __evict_walk_file(WT_SESSION_IMPL *session, u_int *slotp)
 			continue;
 		}
 
+		if (page->type != WT_PAGE_ROW_INT &&
+		    page->type != WT_PAGE_COL_INT &&
+		    page->read_gen <= cache->evict_horizon)
+			hot = 0;
+
 		/*
 		 * Root pages can't be evicted, nor can internal pages expected
 		 * to be merged into their parents.  Use the EVICT_LRU flag to
@@ -662,7 +785,25 @@ __evict_walk_file(WT_SESSION_IMPL *session, u_int *slotp)
 		    "select: %p, size %" PRIu32, page, page->memory_footprint);
 	}
 
-	*slotp += (u_int)(evict - start);
+	/*
+	 * Charge the file for the candidates it supplied: if it couldn't use
+	 * all of its credit, it has nothing more to offer for now, start over.
+	 */
+	queued = (u_int)(evict - start);
+	if (queued < max)
+		btree->evict_credit = 0;
+	else
+		btree->evict_credit -= (uint64_t)queued * WT_EVICT_CREDIT;
+	if (hot && ret == 0)
+		btree->evict_hot_skip = WT_EVICT_HOT_SKIP;
+
+	WT_CSTAT_INCR(session, cache_evict_tree_walk);
+	if (queued != 0) {
+		WT_CSTAT_INCR(session, cache_evict_tree_supply);
+		WT_BSTAT_INCRV(session, page_evict_queued, queued);
+	}
+
+	*slotp += queued;
 	return (ret);
 }
 
@@ -674,10 +815,12 @@ static void
 __evict_get_page(
     WT_SESSION_IMPL *session, int is_app, WT_BTREE **btreep, WT_PAGE **pagep)
 {
+	struct timespec start, stop;
 	WT_CACHE *cache;
 	WT_EVICT_ENTRY *evict;
 	WT_REF *ref;
-	int candidates;
+	u_int spins;
+	int candidates, locked;
 
 	cache = S2C(session)->cache;
 	*btreep = NULL;
@@ -691,15 +834,27 @@ __evict_get_page(
 	 * without getting a page to evict, application threads assume there
 	 * are no more pages available and will attempt to wake the eviction
 	 * server.
+	 *
+	 * Only time the wait if the lock is contended, the uncontended case
+	 * should be cheap.
 	 */
-	for (;;) {
+	for (locked = 0, spins = 0;; ++spins) {
 		if (cache->evict_current == NULL ||
 		    cache->evict_current >= cache->evict + candidates)
-			return;
-		if (__wt_spin_trylock(session, &cache->evict_lock) == 0)
 			break;
+		if (__wt_spin_trylock(session, &cache->evict_lock) == 0) {
+			locked = 1;
+			break;
+		}
+		if (spins == 0)
+			(void)__wt_epoch(session, &start);
 		__wt_yield();
 	}
+	if (spins != 0 && __wt_epoch(session, &stop) == 0)
+		WT_CSTAT_INCRV(session,
+		    cache_evict_lock_wait, WT_TIMEDIFF(stop, start) / 1000);
+	if (!locked)
+		return;
 
 	/* Get the next page queued for eviction. */
 	while ((evict = cache->evict_current) != NULL &&
@@ -789,42 +944,114 @@ __wt_evict_lru_page(WT_SESSION_IMPL *session, int is_app)
 }
 
 /*
- * __evict_lru_cmp --
- *	Qsort function: sort the eviction array.
+ * __evict_lru_select --
+ *	Partially sort part of the eviction array: move the "count" candidates
+ * with the lowest scores to the front of the array, in no particular order.
  */
-static int
-__evict_lru_cmp(const void *a, const void *b)
+static void
+__evict_lru_select(WT_EVICT_ENTRY *evict, u_int entries, u_int count)
 {
-	WT_PAGE *a_page, *b_page;
-	uint64_t a_lru, b_lru;
+	WT_EVICT_ENTRY tmp;
+	uint64_t pivot;
+	u_int first, i, last, store;
+
+#define	WT_EVICT_SWAP(a, b) do {					\
+	tmp = evict[a];							\
+	evict[a] = evict[b];						\
+	evict[b] = tmp;							\
+} while (0)
 
 	/*
-	 * There may be NULL references in the array; sort them as greater than
-	 * anything else so they migrate to the end of the array.
+	 * A quickselect: partition the array around a pivot, then continue in
+	 * whichever side holds the boundary, until the pivot lands on it.
 	 */
-	a_page = ((WT_EVICT_ENTRY *)a)->page;
-	b_page = ((WT_EVICT_ENTRY *)b)->page;
-	if (a_page == NULL)
-		return (b_page == NULL ? 0 : 1);
-	if (b_page == NULL)
-		return (-1);
+	if (count >= entries)
+		return;
+	for (first = 0, last = entries - 1; first < last;) {
+		WT_EVICT_SWAP(first + (last - first) / 2, last);
+		pivot = evict[last].score;
+		for (store = i = first; i < last; ++i)
+			if (evict[i].score < pivot) {
+				WT_EVICT_SWAP(i, store);
+				++store;
+			}
+		WT_EVICT_SWAP(store, last);
+
+		if (store == count)
+			break;
+		if (store < count)
+			first = store + 1;
+		else
+			last = store - 1;
+	}
+}
+
+/*
+ * __evict_lru_sort --
+ *	Sort the best eviction candidates into LRU order.
+ */
+static void
+__evict_lru_sort(WT_SESSION_IMPL *session)
+{
+	WT_CACHE *cache;
+	WT_EVICT_ENTRY *evict, tmp;
+	WT_PAGE *page;
+	u_int entries, i, j;
+
+	cache = S2C(session)->cache;
+	evict = cache->evict;
 
 	/*
-	 * Sort by the LRU in ascending order.
+	 * Score the candidates, moving empty slots to the end of the array.
 	 *
-	 * Bias in favor of leaf pages.  Otherwise, we can waste time
-	 * considering parent pages for eviction while their child pages are
-	 * still in memory.
+	 * The score is the LRU read generation, biased in favor of leaf pages.
+	 * Otherwise, we can waste time considering parent pages for eviction
+	 * while their child pages are still in memory.  Bump the generation
+	 * by a small fixed amount: the idea being that if we have enough good
+	 * leaf page candidates, we should evict them first, but not completely
+	 * ignore an old internal page.
 	 *
-	 * Bump the LRU generation by a small fixed amount: the idea being that
-	 * if we have enough good leaf page candidates, we should evict them
-	 * first, but not completely ignore an old internal page.
+	 * Similarly, clean pages are biased over dirty pages, which have to be
+	 * written before they can be evicted, unless we're evicting because
+	 * there are too many dirty pages, then dirty pages are preferred.
+	 */
+	for (entries = i = 0; i < cache->evict_entries; ++i) {
+		if ((page = evict[i].page) == NULL)
+			continue;
+		evict[i].score = page->read_gen;
+		if (page->type == WT_PAGE_ROW_INT ||
+		    page->type == WT_PAGE_COL_INT)
+			evict[i].score += WT_EVICT_INT_SKEW;
+		if (__wt_page_is_modified(page) != cache->evict_dirty)
+			evict[i].score += WT_EVICT_DIRTY_SKEW;
+		if (i != entries) {
+			evict[entries] = evict[i];
+			evict[i].page = NULL;
+			evict[i].btree = WT_DEBUG_POINT;
+		}
+		++entries;
+	}
+
+	/*
+	 * Only the candidates at the front of the array are considered for
+	 * eviction, and only the candidates up to WT_EVICT_WALK_BASE are kept
+	 * for the next pass: rather than sorting the whole array, select the
+	 * entries to keep, then select and sort the entries to be considered.
+	 */
+	__evict_lru_select(evict, entries, WT_EVICT_WALK_BASE);
+	entries = WT_MIN(entries, WT_EVICT_WALK_BASE);
+	__evict_lru_select(evict, entries, WT_EVICT_GROUP);
+	entries = WT_MIN(entries, WT_EVICT_GROUP);
+	for (i = 1; i < entries; ++i) {
+		tmp = evict[i];
+		for (j = i; j > 0 && evict[j - 1].score > tmp.score; --j)
+			evict[j] = evict[j - 1];
+		evict[j] = tmp;
+	}
+
+	/*
+	 * Remember the newest candidate considered for eviction: files where
+	 * every page is newer have nothing to offer.
 	 */
-	a_lru = a_page->read_gen;
-	b_lru = b_page->read_gen;
-	if (a_page->type == WT_PAGE_ROW_INT || a_page->type == WT_PAGE_COL_INT)
-		a_lru += WT_EVICT_INT_SKEW;
-	if (b_page->type == WT_PAGE_ROW_INT || b_page->type == WT_PAGE_COL_INT)
-		b_lru += WT_EVICT_INT_SKEW;
-	return (a_lru > b_lru ? 1 : (a_lru < b_lru ? -1 : 0));
+	cache->evict_horizon = entries == 0 ? 0 : evict[entries - 1].score;
 }
@@ -380,7 +380,7 @@ __btree_tree_open_empty(WT_SESSION_IMPL *session, int created)
 	 * or it's actually modified.
 	 */
 	WT_ERR(__wt_page_modify_init(session, leaf));
-	__wt_page_modify_set(leaf);
+	__wt_page_modify_set(session, leaf);
 
 	btree->root_page = root;
 
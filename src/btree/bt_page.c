@@ -43,11 +43,19 @@ __wt_page_in_func(
 			WT_RET(__wt_cache_read(session, parent, ref));
 			continue;
 		case WT_REF_LOCKED:
+			/*
+			 * The page is being considered for eviction -- wait for
+			 * that to be resolved.
+			 */
+			break;
 		case WT_REF_READING:
 			/*
-			 * The page is being read or considered for eviction --
-			 * wait for that to be resolved.
+			 * The page is being read -- wait for that to be
+			 * resolved.  If the page is queued for read-ahead and
+			 * no worker has started reading it yet, read it here
+			 * rather than waiting.
 			 */
+			WT_RET(__wt_cache_read_ahead_steal(session, ref));
 			break;
 		case WT_REF_EVICT_WALK:
 		case WT_REF_MEM:
@@ -69,19 +77,10 @@ __wt_page_in_func(
 			page = ref->page;
 			WT_ASSERT(session, !WT_PAGE_IS_ROOT(page));
 
-			/*
-			 * Ensure the page doesn't have ancient updates on it.
-			 * If it did, reading the page could ignore committed
-			 * updates.  This should be extremely unlikely in real
-			 * applications, wait for eviction of the page to avoid
-			 * the issue.
-			 */
-			if (page->modify != NULL &&
-			    __wt_txn_ancient(session, page->modify->first_id)) {
-				page->read_gen = 0;
-				__wt_hazard_clear(session, page);
-				__wt_evict_server_wake(session);
-				break;
+			/* Count the first use of a read-ahead page. */
+			if (F_ISSET_ATOMIC(page, WT_PAGE_READ_AHEAD)) {
+				F_CLR_ATOMIC(page, WT_PAGE_READ_AHEAD);
+				WT_CSTAT_INCR(session, cache_read_ahead_hit);
 			}
 
 			/* Check if we need an autocommit transaction. */
@@ -387,9 +386,8 @@ __inmem_row_int(WT_SESSION_IMPL *session, WT_PAGE *page, size_t *inmem_sizep)
 				ref->txnid = WT_TXN_NONE;
 
 				WT_ERR(__wt_page_modify_init(session, page));
-				page->modify->first_id = WT_TXN_NONE;
 				if (btree->modified)
-					__wt_page_modify_set(page);
+					__wt_page_modify_set(session, page);
 			}
 
 			++ref;
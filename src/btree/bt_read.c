@@ -22,8 +22,7 @@ __cache_read_row_deleted(
 	btree = session->btree;
 
 	/*
-	 * Give the page a modify structure and set the transaction ID for the
-	 * first update to the page.
+	 * Give the page a modify structure.
 	 *
 	 * If the tree is already dirty and so will be written, mark the page
 	 * dirty.  (We'd like to free the deleted pages, but if the handle is
@@ -31,9 +30,8 @@ __cache_read_row_deleted(
 	 * able to do so.)
 	 */
 	WT_RET(__wt_page_modify_init(session, page));
-	page->modify->first_id = ref->txnid;
 	if (btree->modified)
-		__wt_page_modify_set(page);
+		__wt_page_modify_set(session, page);
 
 	/* Allocate the update array. */
 	WT_RET(__wt_calloc_def(session, page->entries, &upd_array));
@@ -56,16 +54,18 @@ __cache_read_row_deleted(
 }
 
 /*
- * __wt_cache_read --
- *	Read a page from the file.
+ * __cache_read --
+ *	Read a page from the file, once its state has been switched to
+ * WT_REF_READING.  Pages read ahead of a scan pass in the disk image, which
+ * becomes the page's (or is discarded on error).
  */
-int
-__wt_cache_read(WT_SESSION_IMPL *session, WT_PAGE *parent, WT_REF *ref)
+static int
+__cache_read(WT_SESSION_IMPL *session, WT_PAGE *parent,
+    WT_REF *ref, WT_PAGE_STATE previous_state, WT_ITEM *image)
 {
 	WT_DECL_RET;
 	WT_ITEM tmp;
 	WT_PAGE *page;
-	WT_PAGE_STATE previous_state;
 	uint32_t size;
 	const uint8_t *addr;
 
@@ -75,18 +75,12 @@ __wt_cache_read(WT_SESSION_IMPL *session, WT_PAGE *parent, WT_REF *ref)
 	 * Don't pass an allocated buffer to the underlying block read function,
 	 * force allocation of new memory of the appropriate size.
 	 */
-	WT_CLEAR(tmp);
-
-	/*
-	 * Attempt to set the state to WT_REF_READING; if successful, we've
-	 * won the race, read the page.
-	 */
-	if (WT_ATOMIC_CAS(ref->state, WT_REF_DISK, WT_REF_READING))
-		previous_state = WT_REF_DISK;
-	else if (WT_ATOMIC_CAS(ref->state, WT_REF_DELETED, WT_REF_READING))
-		previous_state = WT_REF_DELETED;
-	else
-		return (0);
+	if (image == NULL)
+		WT_CLEAR(tmp);
+	else {
+		tmp = *image;
+		WT_CLEAR(*image);
+	}
 
 	/*
 	 * Get the address: if there is no address, the page was deleted, but a
@@ -100,8 +94,9 @@ __wt_cache_read(WT_SESSION_IMPL *session, WT_PAGE *parent, WT_REF *ref)
 
 		WT_ERR(__wt_btree_leaf_create(session, parent, ref, &page));
 	} else {
-		/* Read the backing disk page. */
-		WT_ERR(__wt_bm_read(session, &tmp, addr, size));
+		/* Read the backing disk page, unless it's been read ahead. */
+		if (tmp.mem == NULL)
+			WT_ERR(__wt_bm_read(session, &tmp, addr, size));
 
 		/* Build the in-memory version of the page. */
 		WT_ERR(__wt_page_inmem(session, parent, ref, tmp.mem, &page));
@@ -109,10 +104,29 @@ __wt_cache_read(WT_SESSION_IMPL *session, WT_PAGE *parent, WT_REF *ref)
 		/* If the page was deleted, instantiate that information. */
 		if (previous_state == WT_REF_DELETED)
 			WT_ERR(__cache_read_row_deleted(session, ref, page));
+
+		/*
+		 * A disk image in a buffer from the pool of I/O buffers goes
+		 * back to the pool when the page is discarded; the cache
+		 * counts the whole buffer.
+		 */
+		if (F_ISSET(&tmp, WT_ITEM_POOLED)) {
+			page->dsk_pool_size = tmp.memsize;
+			__wt_cache_page_inmem_incr(
+			    session, page, tmp.memsize - page->dsk->size);
+		}
 	}
 
 	WT_VERBOSE_ERR(session, read,
-	    "page %p: %s", page, __wt_page_type_string(page->type));
+	    "page %p: %s%s", page, __wt_page_type_string(page->type),
+	    image != NULL ? " (read-ahead)" : "");
+
+	/*
+	 * Pages read ahead of a scan are flagged until first used, so we can
+	 * tell if read-ahead is useful.
+	 */
+	if (image != NULL)
+		F_SET_ATOMIC(page, WT_PAGE_READ_AHEAD);
 
 	ref->page = page;
 	WT_PUBLISH(ref->state, WT_REF_MEM);
@@ -131,3 +145,295 @@ err:	WT_PUBLISH(ref->state, previous_state);
 
 	return (ret);
 }
+
+/*
+ * __wt_cache_read --
+ *	Read a page from the file.
+ */
+int
+__wt_cache_read(WT_SESSION_IMPL *session, WT_PAGE *parent, WT_REF *ref)
+{
+	WT_PAGE_STATE previous_state;
+
+	/*
+	 * Attempt to set the state to WT_REF_READING; if successful, we've
+	 * won the race, read the page.
+	 */
+	if (WT_ATOMIC_CAS(ref->state, WT_REF_DISK, WT_REF_READING))
+		previous_state = WT_REF_DISK;
+	else if (WT_ATOMIC_CAS(ref->state, WT_REF_DELETED, WT_REF_READING))
+		previous_state = WT_REF_DELETED;
+	else
+		return (0);
+
+	return (__cache_read(session, parent, ref, previous_state, NULL));
+}
+
+/*
+ * __read_ahead_full --
+ *	Return if the cache is too full to read pages nobody has asked for yet.
+ */
+static inline int
+__read_ahead_full(WT_SESSION_IMPL *session)
+{
+	WT_CACHE *cache;
+	WT_CONNECTION_IMPL *conn;
+
+	conn = S2C(session);
+	cache = conn->cache;
+
+	return (__wt_cache_bytes_inuse(cache) >=
+	    (cache->eviction_target * conn->cache_size) / 100 ? 1 : 0);
+}
+
+/*
+ * __wt_cache_read_ahead --
+ *	A cursor scanning the tree has moved to a slot in an internal page:
+ * queue the on-disk pages in the following slots to be read into the cache
+ * by the read-ahead workers.
+ */
+int
+__wt_cache_read_ahead(
+    WT_SESSION_IMPL *session, WT_PAGE *parent, uint32_t slot, int prev)
+{
+	WT_CACHE *cache;
+	WT_CONNECTION_IMPL *conn;
+	WT_READ_AHEAD_UNIT *unit;
+	WT_REF *ref;
+	u_int i, queued;
+
+	conn = S2C(session);
+	cache = conn->cache;
+
+	if (conn->read_ahead_workers == 0 || __read_ahead_full(session))
+		return (0);
+
+	for (i = queued = 0; i < cache->read_ahead_pages; ++i) {
+		if (prev) {
+			if (slot == 0)
+				break;
+			--slot;
+		} else {
+			if (slot == parent->entries - 1)
+				break;
+			++slot;
+		}
+
+		/*
+		 * Only pages on disk are read ahead: switching the state to
+		 * WT_REF_READING keeps other threads from reading the page
+		 * and the parent from being evicted until the page is read.
+		 * Most of the slots will have been queued by an earlier
+		 * step of the scan, test before the atomic operation.
+		 */
+		ref = &parent->u.intl.t[slot];
+		if (ref->state != WT_REF_DISK ||
+		    !WT_ATOMIC_CAS(ref->state, WT_REF_DISK, WT_REF_READING))
+			continue;
+
+		if (__wt_calloc_def(session, 1, &unit) != 0) {
+			WT_PUBLISH(ref->state, WT_REF_DISK);
+			break;
+		}
+		unit->btree = session->btree;
+		unit->parent = parent;
+		unit->ref = ref;
+
+		__wt_spin_lock(session, &cache->read_ahead_lock);
+		TAILQ_INSERT_TAIL(&cache->read_ahead_qh, unit, q);
+		++cache->read_ahead_queued;
+		__wt_spin_unlock(session, &cache->read_ahead_lock);
+		++queued;
+	}
+
+	if (queued != 0) {
+		WT_CSTAT_INCRV(session, cache_read_ahead, queued);
+		__wt_cond_signal(session, cache->read_ahead_cond);
+	}
+	return (0);
+}
+
+/*
+ * __wt_cache_read_ahead_steal --
+ *	If a page being waited for is queued for read-ahead and no worker has
+ * started to read it, read it in the calling thread instead of waiting.
+ */
+int
+__wt_cache_read_ahead_steal(WT_SESSION_IMPL *session, WT_REF *ref)
+{
+	WT_CACHE *cache;
+	WT_DECL_RET;
+	WT_READ_AHEAD_UNIT *unit;
+
+	cache = S2C(session)->cache;
+
+	/* Avoid the lock if nothing is queued. */
+	if (cache->read_ahead_queued == 0)
+		return (0);
+
+	__wt_spin_lock(session, &cache->read_ahead_lock);
+	TAILQ_FOREACH(unit, &cache->read_ahead_qh, q)
+		if (unit->ref == ref) {
+			TAILQ_REMOVE(&cache->read_ahead_qh, unit, q);
+			--cache->read_ahead_queued;
+			break;
+		}
+	__wt_spin_unlock(session, &cache->read_ahead_lock);
+
+	if (unit == NULL)
+		return (0);
+
+	WT_ASSERT(session, unit->btree == session->btree);
+	ret = __cache_read(session, unit->parent, ref, WT_REF_DISK, NULL);
+	__wt_free(session, unit);
+	return (ret);
+}
+
+/*
+ * __wt_cache_read_ahead_drain --
+ *	Discard a tree's pages from the read-ahead queue, and wait for the
+ * read-ahead workers to finish reading pages in the tree.
+ */
+void
+__wt_cache_read_ahead_drain(WT_SESSION_IMPL *session)
+{
+	WT_BTREE *btree;
+	WT_CACHE *cache;
+	WT_READ_AHEAD_UNIT *next, *unit;
+
+	btree = session->btree;
+	cache = S2C(session)->cache;
+
+	/*
+	 * Workers count themselves in the tree with the queue locked, so none
+	 * can start on the tree once we have the lock.
+	 */
+	__wt_spin_lock(session, &cache->read_ahead_lock);
+	for (unit = TAILQ_FIRST(&cache->read_ahead_qh);
+	    unit != NULL; unit = next) {
+		next = TAILQ_NEXT(unit, q);
+		if (unit->btree == btree) {
+			TAILQ_REMOVE(&cache->read_ahead_qh, unit, q);
+			--cache->read_ahead_queued;
+			WT_PUBLISH(unit->ref->state, WT_REF_DISK);
+			__wt_free(session, unit);
+		}
+	}
+	__wt_spin_unlock(session, &cache->read_ahead_lock);
+
+	while (btree->read_ahead_count > 0)
+		__wt_yield();
+}
+
+/*
+ * __wt_cache_read_ahead_worker --
+ *	Thread to read pages queued ahead of cursor scans into the cache.
+ */
+void *
+__wt_cache_read_ahead_worker(void *arg)
+{
+	WT_BTREE *btree;
+	WT_CACHE *cache;
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_ITEM bufs[WT_READ_AHEAD_BATCH];
+	WT_READ_AHEAD_UNIT *unit, *units[WT_READ_AHEAD_BATCH];
+	WT_READ_AHEAD_WORKER *worker;
+	WT_SESSION_IMPL *session;
+	uint32_t addr_sizes[WT_READ_AHEAD_BATCH];
+	u_int i, limit, n;
+	const uint8_t *addrs[WT_READ_AHEAD_BATCH];
+
+	worker = arg;
+	session = worker->session;
+	conn = S2C(session);
+	cache = conn->cache;
+
+	while (F_ISSET(conn, WT_SERVER_RUN)) {
+		/*
+		 * Take a batch of pages in the same tree from the head of the
+		 * queue, sharing the queue with the other workers: one batch
+		 * read can then cover several pages, and the workers read the
+		 * batches in parallel.
+		 */
+		n = 0;
+		__wt_spin_lock(session, &cache->read_ahead_lock);
+		limit = cache->read_ahead_queued / conn->read_ahead_workers;
+		limit = WT_MAX(1, WT_MIN(limit, WT_READ_AHEAD_BATCH));
+		while (n < limit &&
+		    (unit = TAILQ_FIRST(&cache->read_ahead_qh)) != NULL &&
+		    (n == 0 || unit->btree == units[0]->btree)) {
+			TAILQ_REMOVE(&cache->read_ahead_qh, unit, q);
+			--cache->read_ahead_queued;
+			(void)WT_ATOMIC_ADD(unit->btree->read_ahead_count, 1);
+			units[n++] = unit;
+		}
+		__wt_spin_unlock(session, &cache->read_ahead_lock);
+
+		if (n == 0) {
+			/* Don't rely on signals: check periodically. */
+			__wt_cond_wait(session, cache->read_ahead_cond, 100000);
+			continue;
+		}
+
+		/*
+		 * If the cache has filled since the pages were queued, leave
+		 * the pages on disk: the scan will read them if it gets there,
+		 * and we'd only be adding work for eviction.  A failed read
+		 * also leaves the pages on disk, the scan will see the error
+		 * when it reads the page itself.
+		 */
+		btree = units[0]->btree;
+		WT_SET_BTREE_IN_SESSION(session, btree);
+		if (__read_ahead_full(session)) {
+			for (i = 0; i < n; ++i)
+				WT_PUBLISH(units[i]->ref->state, WT_REF_DISK);
+			worker->pages_skip += n;
+		} else {
+			for (i = 0; i < n; ++i) {
+				WT_CLEAR(bufs[i]);
+				__wt_get_addr(units[i]->parent,
+				    units[i]->ref, &addrs[i], &addr_sizes[i]);
+				WT_ASSERT(session, addrs[i] != NULL);
+			}
+			if ((ret = __wt_bm_read_batch(
+			    session, bufs, addrs, addr_sizes, n)) != 0) {
+				for (i = 0; i < n; ++i) {
+					WT_PUBLISH(
+					    units[i]->ref->state, WT_REF_DISK);
+					__wt_buf_free(session, &bufs[i]);
+				}
+				WT_VERBOSE_VOID(session, readserver,
+				    "read-ahead failed: %s",
+				    wiredtiger_strerror(ret));
+			} else
+				for (i = 0; i < n; ++i) {
+					if ((ret = __cache_read(session,
+					    units[i]->parent, units[i]->ref,
+					    WT_REF_DISK, &bufs[i])) == 0) {
+						++worker->pages_read;
+						continue;
+					}
+					WT_VERBOSE_VOID(session, readserver,
+					    "read-ahead failed: %s",
+					    wiredtiger_strerror(ret));
+				}
+		}
+		WT_CLEAR_BTREE_IN_SESSION(session);
+
+		for (i = 0; i < n; ++i) {
+			(void)WT_ATOMIC_SUB(btree->read_ahead_count, 1);
+			__wt_free(session, units[i]);
+		}
+	}
+
+	WT_VERBOSE_VOID(session, readserver,
+	    "read-ahead worker %u exiting: %" PRIu64 " pages read, %" PRIu64
+	    " skipped", worker->id, worker->pages_read, worker->pages_skip);
+
+	/* Close the worker's session and free its hazard array. */
+	(void)session->iface.close(&session->iface, NULL);
+	__wt_free(conn->default_session, session->hazard);
+
+	return (NULL);
+}
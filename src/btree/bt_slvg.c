@@ -1046,7 +1046,7 @@ __slvg_modify_init(WT_SESSION_IMPL *session, WT_PAGE *page)
 
 	/* The page is dirty. */
 	WT_RET(__wt_page_modify_init(session, page));
-	__wt_page_modify_set(page);
+	__wt_page_modify_set(session, page);
 
 	return (0);
 }
@@ -26,6 +26,10 @@ __wt_btree_stat_init(WT_SESSION_IMPL *session, uint32_t flags)
 
 	WT_RET(__wt_bm_stat(session));
 
+	WT_BSTAT_SET(
+	    session, file_bytes_dirty, __wt_btree_bytes_dirty(btree));
+	WT_BSTAT_SET(
+	    session, file_bytes_inuse, __wt_btree_bytes_inuse(btree));
 	WT_BSTAT_SET(session, file_allocsize, btree->allocsize);
 	WT_BSTAT_SET(session, file_fixed_len, btree->bitcnt);
 	WT_BSTAT_SET(session, file_maxintlpage, btree->maxintlpage);
@@ -22,7 +22,7 @@ __wt_bt_cache_force_write(WT_SESSION_IMPL *session)
 
 	/* Dirty the root page to ensure a write. */
 	WT_RET(__wt_page_modify_init(session, page));
-	__wt_page_modify_set(page);
+	__wt_page_modify_set(session, page);
 
 	return (0);
 }
@@ -71,6 +71,23 @@ __wt_bt_cache_flush(WT_SESSION_IMPL *session, WT_CKPT *ckptbase, int op)
 	 */
 	WT_PUBLISH(btree->ckpt, ckptbase);
 
+	/*
+	 * Checkpoints stage their writes in the block manager, so they can be
+	 * written in file order, adjacent blocks with a single call.  Writing
+	 * the root page writes the staged blocks; if something fails first,
+	 * they're written when the flush ends.
+	 */
+	if (op == WT_SYNC)
+		WT_ERR(__wt_bm_stage_start(session));
+
+	/*
+	 * Pages queued for read-ahead pin their parents in memory: if we're
+	 * discarding the file, take them off the queue and wait for any reads
+	 * in progress.
+	 */
+	if (op == WT_SYNC_DISCARD || op == WT_SYNC_DISCARD_NOWRITE)
+		__wt_cache_read_ahead_drain(session);
+
 	/*
 	 * Schedule and wake the eviction server, then wait for the eviction
 	 * server to wake us.
@@ -90,6 +107,8 @@ __wt_bt_cache_flush(WT_SESSION_IMPL *session, WT_CKPT *ckptbase, int op)
 		break;
 	}
 
-err:	btree->ckpt = NULL;
+err:	if (op == WT_SYNC)
+		WT_TRET(__wt_bm_stage_end(session));
+	btree->ckpt = NULL;
 	return (ret);
 }
@@ -95,7 +95,7 @@ __tree_walk_delete(
 	 * we write the tree.
 	 */
 	WT_ERR(__wt_page_modify_init(session, page));
-	__wt_page_modify_set(page);
+	__wt_page_modify_set(session, page);
 
 	*skipp = 1;
 
@@ -155,7 +155,7 @@ __wt_tree_walk(WT_SESSION_IMPL *session, WT_PAGE **pagep, uint32_t flags)
 	WT_PAGE *page, *t;
 	WT_REF *ref;
 	uint32_t slot;
-	int compact, discard, eviction, prev, set_read_gen, skip;
+	int compact, discard, eviction, prev, read_ahead, set_read_gen, skip;
 
 	btree = session->btree;
 
@@ -165,6 +165,7 @@ __wt_tree_walk(WT_SESSION_IMPL *session, WT_PAGE **pagep, uint32_t flags)
 	compact = LF_ISSET(WT_TREE_COMPACT) ? 1 : 0;
 	eviction = LF_ISSET(WT_TREE_EVICT) ? 1 : 0;
 	prev = LF_ISSET(WT_TREE_PREV) ? 1 : 0;
+	read_ahead = LF_ISSET(WT_TREE_READ_AHEAD) ? 1 : 0;
 
 	/*
 	 * Take a copy of any returned page; we have a hazard reference on the
@@ -281,6 +282,14 @@ descend:	for (;;) {
 					    ref->state == WT_REF_DISK ? 1 : 0;
 				}
 
+				/*
+				 * If a cursor is scanning the tree, queue the
+				 * pages after this one to be read ahead of it.
+				 */
+				if (read_ahead)
+					WT_RET(__wt_cache_read_ahead(
+					    session, page, slot, prev));
+
 				WT_RET(__wt_page_in(session, page, ref));
 				if (set_read_gen)
 					page->read_gen = 0;
@@ -27,11 +27,12 @@ __wt_col_modify(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, int op)
 	size_t ins_size, new_inshead_size, new_inslist_size, upd_size;
 	uint64_t recno;
 	u_int skipdepth;
-	int i, logged;
+	int i, is_remove, logged;
 
 	btree = cbt->btree;
 	page = cbt->page;
 	recno = cbt->iface.recno;
+	is_remove = op == 2;
 	logged = 0;
 
 	WT_ASSERT(session, op != 1);
@@ -81,11 +82,11 @@ __wt_col_modify(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, int op)
 	 */
 	if (cbt->compare == 0 && cbt->ins != NULL) {
 		/* Make sure the update can proceed. */
-		WT_ERR(__wt_update_check(session, page, cbt->ins->upd));
+		WT_ERR(__wt_txn_update_check(session, cbt->ins->upd));
 
 		/* Allocate the WT_UPDATE structure and transaction ID. */
 		WT_ERR(__wt_update_alloc(session, value, &upd, &upd_size));
-		WT_ERR(__wt_txn_modify(session, &upd->txnid));
+		WT_ERR(__wt_txn_modify(session, upd));
 		logged = 1;
 
 		/* Serialize the update. */
@@ -97,9 +98,6 @@ __wt_col_modify(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, int op)
 		if (upd_obsolete != NULL)
 			__wt_update_obsolete_free(session, page, upd_obsolete);
 	} else {
-		/* Make sure the update can proceed. */
-		WT_ERR(__wt_update_check(session, page, NULL));
-
 		/* There may be no insert list, allocate as necessary. */
 		new_inshead_size = new_inslist_size = 0;
 		if (op == 1) {
@@ -149,7 +147,7 @@ __wt_col_modify(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, int op)
 		WT_ERR(__col_insert_alloc(
 		    session, recno, skipdepth, &ins, &ins_size));
 		WT_ERR(__wt_update_alloc(session, value, &upd, &upd_size));
-		WT_ERR(__wt_txn_modify(session, &upd->txnid));
+		WT_ERR(__wt_txn_modify(session, upd));
 		logged = 1;
 		ins->upd = upd;
 		ins_size += upd_size;
@@ -171,15 +169,25 @@ __wt_col_modify(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, int op)
 
 			/* Put the new recno into the cursor. */
 			cbt->recno = WT_INSERT_RECNO(ins_copy);
-		} else
-			WT_ERR(__wt_insert_serial(session,
-			    page, cbt->write_gen,
+		} else if (new_inshead == NULL)
+			WT_ERR(__wt_insert_skiplist(session, page, *inshead,
+			    cbt->ins_stack, &ins, ins_size, skipdepth));
+		else
+			WT_ERR(__wt_insert_serial(session, page,
 			    inshead, cbt->ins_stack,
 			    &new_inslist, new_inslist_size,
 			    &new_inshead, new_inshead_size,
 			    &ins, ins_size, skipdepth));
 	}
 
+	/*
+	 * The update is linked into the tree: if logging it fails, the update
+	 * is rolled back with the rest of the transaction, don't free it here.
+	 */
+	logged = 0;
+	upd = NULL;
+	WT_ERR(__wt_txn_log_op(session, cbt, is_remove));
+
 	if (0) {
 err:		/*
 		 * Remove the update from the current transaction, so we don't
@@ -236,6 +236,7 @@ static int
 __rec_review(WT_SESSION_IMPL *session,
     WT_REF *ref, WT_PAGE *page, uint32_t flags, int top)
 {
+	struct timespec start, stop;
 	WT_DECL_RET;
 	WT_PAGE_MODIFY *mod;
 	WT_TXN *txn;
@@ -319,7 +320,10 @@ __rec_review(WT_SESSION_IMPL *session,
 	/* If the page is dirty, write it so we know the final state. */
 	if (__wt_page_is_modified(page) &&
 	    !F_ISSET(mod, WT_PM_REC_SPLIT_MERGE)) {
+		WT_RET(__wt_epoch(session, &start));
 		ret = __wt_rec_write(session, page, NULL, flags);
+		WT_TRET(__wt_epoch(session, &stop));
+		session->rec_usecs += WT_TIMEDIFF(stop, start) / 1000;
 
 		/* If there are unwritten changes on the page, give up. */
 		if (ret == 0 &&
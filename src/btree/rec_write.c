@@ -476,7 +476,7 @@ __wt_rec_write(WT_SESSION_IMPL *session,
 				break;
 		}
 		WT_RET(__wt_page_modify_init(session, page));
-		__wt_page_modify_set(page);
+		__wt_page_modify_set(session, page);
 
 		return (0);
 	}
@@ -524,7 +524,7 @@ __wt_rec_write(WT_SESSION_IMPL *session,
 	WT_VERBOSE_RET(session, reconcile,
 	    "root page split %p -> %p", page, page->modify->u.split);
 	page = page->modify->u.split;
-	__wt_page_modify_set(page);
+	__wt_page_modify_set(session, page);
 	F_CLR(page->modify, WT_PM_REC_SPLIT_MERGE);
 
 	WT_RET(__wt_rec_write(session, page, NULL, flags));
@@ -1384,7 +1384,7 @@ __wt_rec_bulk_wrapup(WT_CURSOR_BULK *cbulk)
 
 	/* Mark the page's parent dirty. */
 	WT_RET(__wt_page_modify_init(session, page->parent));
-	__wt_page_modify_set(page->parent);
+	__wt_page_modify_set(session, page->parent);
 
 	__wt_rec_destroy(session, &cbulk->reconcile);
 
@@ -3372,6 +3372,10 @@ err:			__wt_scr_free(&tkey);
 	if (!r->upd_skipped)
 		mod->disk_gen = r->orig_write_gen;
 
+	/* If the page is now clean, it's no longer counted as dirty. */
+	if (!__wt_page_is_modified(page))
+		__wt_cache_dirty_decr(session, page, mod->bytes_dirty);
+
 	return (0);
 }
 
@@ -67,11 +67,11 @@ __wt_row_modify(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, int is_remove)
 			upd_entry = &cbt->ins->upd;
 
 		/* Make sure the update can proceed. */
-		WT_ERR(__wt_update_check(session, page, *upd_entry));
+		WT_ERR(__wt_txn_update_check(session, *upd_entry));
 
 		/* Allocate the WT_UPDATE structure and transaction ID. */
 		WT_ERR(__wt_update_alloc(session, value, &upd, &upd_size));
-		WT_ERR(__wt_txn_modify(session, &upd->txnid));
+		WT_ERR(__wt_txn_modify(session, upd));
 		logged = 1;
 
 		/* Serialize the update. */
@@ -83,9 +83,6 @@ __wt_row_modify(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, int is_remove)
 		if (upd_obsolete != NULL)
 			__wt_update_obsolete_free(session, page, upd_obsolete);
 	} else {
-		/* Make sure the update can proceed. */
-		WT_ERR(__wt_update_check(session, page, NULL));
-
 		/*
 		 * Allocate insert array if necessary, and set the array
 		 * reference.
@@ -136,20 +133,39 @@ __wt_row_modify(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, int is_remove)
 		WT_ERR(__wt_row_insert_alloc(
 		    session, key, skipdepth, &ins, &ins_size));
 		WT_ERR(__wt_update_alloc(session, value, &upd, &upd_size));
-		WT_ERR(__wt_txn_modify(session, &upd->txnid));
+		WT_ERR(__wt_txn_modify(session, upd));
 		logged = 1;
 		ins->upd = upd;
 		ins_size += upd_size;
 		cbt->ins = ins;
 
-		/* Insert the WT_INSERT structure. */
-		WT_ERR(__wt_insert_serial(session, page, cbt->write_gen,
-		    inshead, cbt->ins_stack,
-		    &new_inslist, new_inslist_size,
-		    &new_inshead, new_inshead_size,
-		    &ins, ins_size, skipdepth));
+		/*
+		 * Insert the WT_INSERT structure: if the insert list existed
+		 * when we checked above, link the new item in without
+		 * serialization, otherwise call a serialized function to
+		 * create the list.  Don't re-check the list: if another thread
+		 * created it since, our stack references our private list head,
+		 * the serialized function sorts that out.
+		 */
+		if (new_inshead == NULL)
+			WT_ERR(__wt_insert_skiplist(session, page, *inshead,
+			    cbt->ins_stack, &ins, ins_size, skipdepth));
+		else
+			WT_ERR(__wt_insert_serial(session, page,
+			    inshead, cbt->ins_stack,
+			    &new_inslist, new_inslist_size,
+			    &new_inshead, new_inshead_size,
+			    &ins, ins_size, skipdepth));
 	}
 
+	/*
+	 * The update is linked into the tree: if logging it fails, the update
+	 * is rolled back with the rest of the transaction, don't free it here.
+	 */
+	logged = 0;
+	upd = NULL;
+	WT_ERR(__wt_txn_log_op(session, cbt, is_remove));
+
 	if (0) {
 err:		/*
 		 * Remove the update from the current transaction, so we don't
@@ -198,56 +214,175 @@ __wt_row_insert_alloc(WT_SESSION_IMPL *session,
 	return (0);
 }
 
+/*
+ * __insert_cmp --
+ *	Compare a new WT_INSERT item to an item already in an insert list.
+ */
+static inline int
+__insert_cmp(WT_SESSION_IMPL *session,
+    WT_PAGE *page, WT_INSERT *new_ins, WT_INSERT *ins, int *cmpp)
+{
+	WT_BTREE *btree;
+	WT_ITEM insert_key, new_key;
+
+	if (page->type != WT_PAGE_ROW_LEAF) {
+		*cmpp = WT_INSERT_RECNO(new_ins) == WT_INSERT_RECNO(ins) ? 0 :
+		    (WT_INSERT_RECNO(new_ins) < WT_INSERT_RECNO(ins) ? -1 : 1);
+		return (0);
+	}
+
+	btree = session->btree;
+	new_key.data = WT_INSERT_KEY(new_ins);
+	new_key.size = WT_INSERT_KEY_SIZE(new_ins);
+	insert_key.data = WT_INSERT_KEY(ins);
+	insert_key.size = WT_INSERT_KEY_SIZE(ins);
+	return (WT_BTREE_CMP(session, btree, &new_key, &insert_key, *cmpp));
+}
+
+/*
+ * __insert_link --
+ *	Link a new WT_INSERT item into an insert list, using compare-and-swap
+ *	at each skiplist level.
+ */
+static int
+__insert_link(WT_SESSION_IMPL *session, WT_PAGE *page,
+    WT_INSERT_HEAD *inshead, WT_INSERT ***ins_stack,
+    WT_INSERT *new_ins, u_int skipdepth)
+{
+	WT_INSERT **insp, *next, *tail;
+	u_int i;
+	int cmp;
+
+	/*
+	 * Items are never removed from an insert list while the page is in
+	 * memory, so the search stack is a valid starting point even if other
+	 * threads have inserted items since the search: they can only have
+	 * been added after the stack's entry at each level.  (If the search
+	 * found no list, the stack is cleared and we start from the head.)
+	 * Walk forward past any such items that sort before the new item, then
+	 * swap the new item into place; if the swap fails, another thread got
+	 * in first, repeat.
+	 *
+	 * Link the bottom level first: once an item is on the bottom level it
+	 * is in the list, the other levels only make searches faster.  If an
+	 * item with the same key was inserted since the search, the caller has
+	 * to search again and update the existing item instead.
+	 */
+	for (i = 0; i < skipdepth; i++) {
+		if ((insp = ins_stack[i]) == NULL)
+			insp = &inshead->head[i];
+		for (;;) {
+			while ((next = *insp) != NULL) {
+				WT_RET(__insert_cmp(
+				    session, page, new_ins, next, &cmp));
+				if (cmp < 0)
+					break;
+				if (cmp == 0) {
+					WT_ASSERT(session, i == 0);
+					WT_BSTAT_INCR(
+					    session, file_write_conflicts);
+					return (WT_RESTART);
+				}
+				insp = &next->next[i];
+			}
+			new_ins->next[i] = next;
+			if (WT_ATOMIC_CAS(*insp, next, new_ins))
+				break;
+			WT_BSTAT_INCR(session, file_insert_retries);
+		}
+
+		/*
+		 * If the new item is the last item at this level, update the
+		 * list's tail.  Another thread may be appending behind us: read
+		 * the tail before checking for a next item, if an item has been
+		 * appended, that thread is responsible for the tail.
+		 */
+		for (;;) {
+			WT_ORDERED_READ(tail, inshead->tail[i]);
+			if (new_ins->next[i] != NULL ||
+			    WT_ATOMIC_CAS(inshead->tail[i], tail, new_ins))
+				break;
+		}
+	}
+	return (0);
+}
+
+/*
+ * __wt_insert_skiplist --
+ *	Add a WT_INSERT entry to an existing insert list without serializing
+ *	the change.
+ */
+int
+__wt_insert_skiplist(WT_SESSION_IMPL *session, WT_PAGE *page,
+    WT_INSERT_HEAD *inshead, WT_INSERT ***ins_stack,
+    WT_INSERT **new_insp, size_t new_ins_size, u_int skipdepth)
+{
+	WT_RET(__insert_link(
+	    session, page, inshead, ins_stack, *new_insp, skipdepth));
+
+	/* The new item belongs to the page. */
+	*new_insp = NULL;
+	__wt_cache_page_inmem_incr(session, page, new_ins_size);
+
+	__wt_page_and_tree_modify_set(session, page);
+	return (0);
+}
+
 /*
  * __wt_insert_serial_func --
- *	Server function to add an WT_INSERT entry to the page.
+ *	Server function to add an WT_INSERT entry to the page, creating the
+ *	page's insert array or the insert list as necessary.
  */
 int
 __wt_insert_serial_func(WT_SESSION_IMPL *session, void *args)
 {
 	WT_INSERT *new_ins, ***ins_stack;
 	WT_INSERT_HEAD *inshead, **insheadp, **new_inslist, *new_inshead;
+	WT_INSERT_HEAD ***inslistp;
 	WT_PAGE *page;
-	uint32_t write_gen;
 	u_int i, skipdepth;
 
-	__wt_insert_unpack(args, &page, &write_gen, &insheadp,
+	__wt_insert_unpack(args, &page, &insheadp,
 	    &ins_stack, &new_inslist, &new_inshead, &new_ins, &skipdepth);
 
-	/* Check the page's write-generation. */
-	WT_RET(__wt_page_write_gen_check(session, page, write_gen));
+	/*
+	 * Our caller found no insert list (and possibly no insert array), but
+	 * another thread may have created them since: if so, switch to the
+	 * existing array and the existing list.
+	 */
+	inslistp = page->type == WT_PAGE_ROW_LEAF ?
+	    &page->u.row.ins : &page->modify->update;
+	if (new_inslist != NULL && *inslistp != NULL)
+		insheadp = *inslistp + (insheadp - new_inslist);
+	if ((inshead = *insheadp) != NULL) {
+		for (i = 0; i < skipdepth; i++)
+			ins_stack[i] = &inshead->head[i];
+		WT_RET(__insert_link(
+		    session, page, inshead, ins_stack, new_ins, skipdepth));
+		__wt_insert_new_ins_taken(session, args, page);
+		__wt_page_and_tree_modify_set(session, page);
+		return (0);
+	}
 
 	/*
-	 * Publish: First, point the new WT_INSERT item's skiplist references
-	 * to the next elements in the insert list, then flush memory.  Second,
-	 * update the skiplist elements that reference the new WT_INSERT item,
-	 * this ensures the list is never inconsistent.
+	 * The new list isn't yet visible to other threads, but the page lock
+	 * prevents any other thread creating a list in the same place.  Link
+	 * the new item into the list, then publish it.
 	 */
-	if ((inshead = *insheadp) == NULL)
-		inshead = new_inshead;
-	for (i = 0; i < skipdepth; i++)
-		new_ins->next[i] = *ins_stack[i];
-	WT_WRITE_BARRIER();
+	inshead = new_inshead;
 	for (i = 0; i < skipdepth; i++) {
-		if (inshead->tail[i] == NULL ||
-		    ins_stack[i] == &inshead->tail[i]->next[i])
-			inshead->tail[i] = new_ins;
-		*ins_stack[i] = new_ins;
+		new_ins->next[i] = NULL;
+		inshead->head[i] = inshead->tail[i] = new_ins;
 	}
-
 	__wt_insert_new_ins_taken(session, args, page);
 
 	/*
-	 * If the insert head does not yet have an insert list, our caller
-	 * passed us one.
-	 *
-	 * NOTE: it is important to do this after the item has been added to
-	 * the list.  Code can assume that if the list is set, it is non-empty.
+	 * NOTE: it is important to publish the list after the item has been
+	 * added to it.  Code can assume that if the list is set, it is
+	 * non-empty.
 	 */
-	if (*insheadp == NULL) {
-		WT_PUBLISH(*insheadp, new_inshead);
-		__wt_insert_new_inshead_taken(session, args, page);
-	}
+	WT_PUBLISH(*insheadp, new_inshead);
+	__wt_insert_new_inshead_taken(session, args, page);
 
 	/*
 	 * If the page does not yet have an insert array, our caller passed
@@ -256,42 +391,12 @@ __wt_insert_serial_func(WT_SESSION_IMPL *session, void *args)
 	 * NOTE: it is important to do this after publishing the list entry.
 	 * Code can assume that if the array is set, it is non-empty.
 	 */
-	if (page->type == WT_PAGE_ROW_LEAF) {
-		if (page->u.row.ins == NULL) {
-			page->u.row.ins = new_inslist;
-			__wt_insert_new_inslist_taken(session, args, page);
-		}
-	} else
-		if (page->modify->update == NULL) {
-			page->modify->update = new_inslist;
-			__wt_insert_new_inslist_taken(session, args, page);
-		}
-	__wt_page_and_tree_modify_set(session, page);
-	return (0);
-}
-
-/*
- * __wt_update_check --
- *	Check whether an update can proceed, and maintain the first txnid in
- *	the page->modify structure.
- */
-int
-__wt_update_check(WT_SESSION_IMPL *session, WT_PAGE *page, WT_UPDATE *next)
-{
-	WT_TXN *txn;
-
-	/* Before allocating anything, make sure this update is permitted. */
-	WT_RET(__wt_txn_update_check(session, next));
-
-	/*
-	 * Record the transaction ID for the first update to a page.
-	 * We don't care if this races: there is a buffer built into the
-	 * check for ancient updates.
-	 */
-	txn = &session->txn;
-	if (page->modify->first_id == WT_TXN_NONE && txn->id != WT_TXN_NONE)
-		page->modify->first_id = txn->id;
+	if (*inslistp == NULL) {
+		WT_PUBLISH(*inslistp, new_inslist);
+		__wt_insert_new_inslist_taken(session, args, page);
+	}
 
+	__wt_page_and_tree_modify_set(session, page);
 	return (0);
 }
 
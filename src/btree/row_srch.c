@@ -20,8 +20,14 @@ __wt_search_insert(WT_SESSION_IMPL *session,
 	WT_ITEM insert_key;
 	int cmp, i;
 
-	/* If there's no insert chain to search, we're done. */
-	if ((ret_ins = WT_SKIP_LAST(inshead)) == NULL) {
+	/*
+	 * If there's no insert chain to search, we're done.  Clear the stack:
+	 * if another thread creates the insert list before we insert into it,
+	 * the insert starts from the list's head.
+	 */
+	if (WT_SKIP_LAST(inshead) == NULL) {
+		for (i = 0; i < WT_SKIP_MAXDEPTH; i++)
+			cbt->ins_stack[i] = NULL;
 		cbt->ins = NULL;
 		return (0);
 	}
@@ -29,14 +35,11 @@ __wt_search_insert(WT_SESSION_IMPL *session,
 	btree = session->btree;
 
 	/* Fast-path appends. */
+	ret_ins = __wt_skip_last_stack(inshead, cbt->ins_stack);
 	insert_key.data = WT_INSERT_KEY(ret_ins);
 	insert_key.size = WT_INSERT_KEY_SIZE(ret_ins);
 	(void)WT_BTREE_CMP(session, btree, srch_key, &insert_key, cmp);
 	if (cmp >= 0) {
-		for (i = WT_SKIP_MAXDEPTH - 1; i >= 0; i--)
-			cbt->ins_stack[i] = (inshead->tail[i] != NULL) ?
-			    &inshead->tail[i]->next[i] :
-			    &inshead->head[i];
 		cbt->compare = -cmp;
 		cbt->ins = ret_ins;
 		return (0);
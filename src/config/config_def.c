@@ -83,18 +83,23 @@ __wt_confchk_connection_open_session[] = {
 
 const char *
 __wt_confdfl_connection_reconfigure =
-	"cache_size=100MB,error_prefix=,eviction_target=80,"
-	"eviction_trigger=95,verbose=";
+	"cache_size=100MB,error_prefix=,eviction_dirty_target=60,"
+	"eviction_dirty_trigger=80,eviction_target=80,eviction_trigger=95,"
+	"read_ahead_pages=8,verbose=";
 
 WT_CONFIG_CHECK
 __wt_confchk_connection_reconfigure[] = {
 	{ "cache_size", "int", "min=1MB,max=10TB" },
 	{ "error_prefix", "string", NULL },
+	{ "eviction_dirty_target", "int", "min=5,max=99" },
+	{ "eviction_dirty_trigger", "int", "min=5,max=99" },
 	{ "eviction_target", "int", "min=10,max=99" },
 	{ "eviction_trigger", "int", "min=10,max=99" },
+	{ "read_ahead_pages", "int", "min=0,max=1000" },
 	{ "verbose", "list", "choices=[\"block\",\"ckpt\",\"evict\","
-	    "\"evictserver\",\"fileops\",\"hazard\",\"lsm\",\"mutex\",\"read\","
-	    "\"readserver\",\"reconcile\",\"salvage\",\"verify\",\"write\"]" },
+	    "\"evictserver\",\"fileops\",\"hazard\",\"log\",\"lsm\",\"mutex\","
+	    "\"read\",\"readserver\",\"reconcile\",\"salvage\",\"verify\","
+	    "\"write\"]" },
 	{ NULL, NULL, NULL }
 };
 
@@ -110,13 +115,15 @@ __wt_confchk_cursor_close[] = {
 const char *
 __wt_confdfl_file_meta =
 	"allocation_size=512B,block_compressor=,cache_resident=0,checkpoint=,"
-	"checksum=,collator=,columns=,dictionary=0,format=btree,huffman_key=,"
-	"huffman_value=,internal_item_max=0,internal_key_truncate=,"
-	"internal_page_max=2KB,key_format=u,key_gap=10,leaf_item_max=0,"
-	"leaf_page_max=1MB,lsm_bloom=,lsm_bloom_bit_count=8,lsm_bloom_config="
-	",lsm_bloom_hash_count=4,lsm_bloom_newest=0,lsm_bloom_oldest=0,"
-	"lsm_chunk_size=2MB,lsm_merge_max=15,prefix_compression=,split_pct=75"
-	",value_format=u,version=(major=0,minor=0)";
+	"checkpoint_lsn=,checksum=,collator=,columns=,dictionary=0,"
+	"format=btree,huffman_key=,huffman_value=,internal_item_max=0,"
+	"internal_key_truncate=,internal_page_max=2KB,key_format=u,key_gap=10"
+	",leaf_item_max=0,leaf_page_max=1MB,lsm_bloom=,lsm_bloom_bit_count=8,"
+	"lsm_bloom_config=,lsm_bloom_hash_count=4,lsm_bloom_newest=0,"
+	"lsm_bloom_oldest=0,lsm_chunk_size=2MB,lsm_merge_max=15,"
+	"lsm_merge_policy=tiered,lsm_stall_chunks=50,lsm_stall_size=0,"
+	"lsm_throttle_chunks=20,lsm_throttle_size=0,prefix_compression=,"
+	"split_pct=75,value_format=u,version=(major=0,minor=0)";
 
 WT_CONFIG_CHECK
 __wt_confchk_file_meta[] = {
@@ -124,6 +131,7 @@ __wt_confchk_file_meta[] = {
 	{ "block_compressor", "string", NULL },
 	{ "cache_resident", "boolean", NULL },
 	{ "checkpoint", "string", NULL },
+	{ "checkpoint_lsn", "string", NULL },
 	{ "checksum", "boolean", NULL },
 	{ "collator", "string", NULL },
 	{ "columns", "list", NULL },
@@ -146,6 +154,11 @@ __wt_confchk_file_meta[] = {
 	{ "lsm_bloom_oldest", "boolean", NULL },
 	{ "lsm_chunk_size", "int", "min=512K,max=500MB" },
 	{ "lsm_merge_max", "int", "min=2,max=100" },
+	{ "lsm_merge_policy", "string", "choices=[\"leveled\",\"tiered\"]" },
+	{ "lsm_stall_chunks", "int", "min=0" },
+	{ "lsm_stall_size", "int", "min=0" },
+	{ "lsm_throttle_chunks", "int", "min=0" },
+	{ "lsm_throttle_size", "int", "min=0" },
 	{ "prefix_compression", "boolean", NULL },
 	{ "split_pct", "int", "min=25,max=100" },
 	{ "value_format", "format", NULL },
@@ -232,8 +245,10 @@ __wt_confdfl_session_create =
 	"key_format=u,key_gap=10,leaf_item_max=0,leaf_page_max=1MB,lsm_bloom="
 	",lsm_bloom_bit_count=8,lsm_bloom_config=,lsm_bloom_hash_count=4,"
 	"lsm_bloom_newest=0,lsm_bloom_oldest=0,lsm_chunk_size=2MB,"
-	"lsm_merge_max=15,prefix_compression=,source=,split_pct=75,type=file,"
-	"value_format=u,value_format=u";
+	"lsm_merge_max=15,lsm_merge_policy=tiered,lsm_stall_chunks=50,"
+	"lsm_stall_size=0,lsm_throttle_chunks=20,lsm_throttle_size=0,"
+	"prefix_compression=,source=,split_pct=75,type=file,value_format=u,"
+	"value_format=u";
 
 WT_CONFIG_CHECK
 __wt_confchk_session_create[] = {
@@ -266,6 +281,11 @@ __wt_confchk_session_create[] = {
 	{ "lsm_bloom_oldest", "boolean", NULL },
 	{ "lsm_chunk_size", "int", "min=512K,max=500MB" },
 	{ "lsm_merge_max", "int", "min=2,max=100" },
+	{ "lsm_merge_policy", "string", "choices=[\"leveled\",\"tiered\"]" },
+	{ "lsm_stall_chunks", "int", "min=0" },
+	{ "lsm_stall_size", "int", "min=0" },
+	{ "lsm_throttle_chunks", "int", "min=0" },
+	{ "lsm_throttle_size", "int", "min=0" },
 	{ "prefix_compression", "boolean", NULL },
 	{ "source", "string", NULL },
 	{ "split_pct", "int", "min=25,max=100" },
@@ -401,31 +421,48 @@ __wt_confchk_table_meta[] = {
 
 const char *
 __wt_confdfl_wiredtiger_open =
-	"buffer_alignment=-1,cache_size=100MB,create=0,direct_io=,"
-	"error_prefix=,eviction_target=80,eviction_trigger=95,extensions=,"
-	"hazard_max=1000,logging=0,lsm_merge=,multiprocess=0,session_max=50,"
-	"sync=,transactional=,use_environment_priv=0,verbose=";
+	"buffer_alignment=-1,buffer_pool_size=16MB,cache_size=100MB,create=0,"
+	"direct_io=,error_prefix=,eviction_dirty_target=60,"
+	"eviction_dirty_trigger=80,eviction_target=80,eviction_trigger=95,"
+	"eviction_workers=0,extensions=,hazard_max=1000,io_backend=sync,"
+	"io_threads=4,log_file_max=100MB,logging=0,lsm_flush_workers=2,"
+	"lsm_merge=,lsm_merge_workers=2,multiprocess=0,read_ahead_pages=8,"
+	"read_ahead_workers=2,session_max=50,sync=,transactional=,"
+	"use_environment_priv=0,verbose=";
 
 WT_CONFIG_CHECK
 __wt_confchk_wiredtiger_open[] = {
 	{ "buffer_alignment", "int", "min=-1,max=1MB" },
+	{ "buffer_pool_size", "int", "min=0,max=1GB" },
 	{ "cache_size", "int", "min=1MB,max=10TB" },
 	{ "create", "boolean", NULL },
 	{ "direct_io", "list", "choices=[\"data\",\"log\"]" },
 	{ "error_prefix", "string", NULL },
+	{ "eviction_dirty_target", "int", "min=5,max=99" },
+	{ "eviction_dirty_trigger", "int", "min=5,max=99" },
 	{ "eviction_target", "int", "min=10,max=99" },
 	{ "eviction_trigger", "int", "min=10,max=99" },
+	{ "eviction_workers", "int", "min=0,max=20" },
 	{ "extensions", "list", NULL },
 	{ "hazard_max", "int", "min=15" },
+	{ "io_backend", "string", "choices=[\"sync\",\"io_uring\","
+	    "\"threads\"]" },
+	{ "io_threads", "int", "min=1,max=64" },
+	{ "log_file_max", "int", "min=100KB,max=2GB" },
 	{ "logging", "boolean", NULL },
+	{ "lsm_flush_workers", "int", "min=1,max=20" },
 	{ "lsm_merge", "boolean", NULL },
+	{ "lsm_merge_workers", "int", "min=1,max=20" },
 	{ "multiprocess", "boolean", NULL },
+	{ "read_ahead_pages", "int", "min=0,max=1000" },
+	{ "read_ahead_workers", "int", "min=0,max=20" },
 	{ "session_max", "int", "min=1" },
 	{ "sync", "boolean", NULL },
 	{ "transactional", "boolean", NULL },
 	{ "use_environment_priv", "boolean", NULL },
 	{ "verbose", "list", "choices=[\"block\",\"ckpt\",\"evict\","
-	    "\"evictserver\",\"fileops\",\"hazard\",\"lsm\",\"mutex\",\"read\","
-	    "\"readserver\",\"reconcile\",\"salvage\",\"verify\",\"write\"]" },
+	    "\"evictserver\",\"fileops\",\"hazard\",\"log\",\"lsm\",\"mutex\","
+	    "\"read\",\"readserver\",\"reconcile\",\"salvage\",\"verify\","
+	    "\"write\"]" },
 	{ NULL, NULL, NULL }
 };
@@ -290,6 +290,7 @@ __conn_close(WT_CONNECTION *wt_conn, const char *config)
 {
 	WT_CONNECTION_IMPL *conn;
 	WT_DECL_RET;
+	WT_LSN ckpt_lsn;
 	WT_NAMED_COLLATOR *ncoll;
 	WT_NAMED_COMPRESSOR *ncomp;
 	WT_NAMED_DATA_SOURCE *ndsrc;
@@ -325,6 +326,17 @@ __conn_close(WT_CONNECTION *wt_conn, const char *config)
 	/* Close open btree handles. */
 	WT_TRET(__wt_conn_btree_discard(conn));
 
+	/*
+	 * Closing the btree handles wrote all of their changes: if that worked,
+	 * recovery doesn't need anything in the log written so far.
+	 */
+	if (ret == 0 && conn->log != NULL) {
+		__wt_log_ckpt_lsn(session, &ckpt_lsn);
+		WT_TRET(__wt_meta_checkpoint_lsn_set(session, &ckpt_lsn));
+		if (ret == 0)
+			WT_TRET(__wt_log_archive(session, &ckpt_lsn));
+	}
+
 	/* Free memory for collators */
 	while ((ncoll = TAILQ_FIRST(&conn->collqh)) != NULL)
 		__conn_remove_collator(conn, ncoll);
@@ -733,6 +745,7 @@ __conn_verbose_config(WT_SESSION_IMPL *session, const char *cfg[])
 		{ "evictserver",WT_VERB_evictserver },
 		{ "fileops",	WT_VERB_fileops },
 		{ "hazard",	WT_VERB_hazard },
+		{ "log",	WT_VERB_log },
 		{ "lsm",	WT_VERB_lsm },
 		{ "mutex",	WT_VERB_mutex },
 		{ "read",	WT_VERB_read },
@@ -846,11 +859,32 @@ wiredtiger_open(const char *home, WT_EVENT_HANDLER *event_handler,
 
 	WT_ERR(__wt_config_gets(session, cfg, "hazard_max", &cval));
 	conn->hazard_max = (uint32_t)cval.val;
-	WT_ERR(__wt_config_gets(session, cfg, "session_max", &cval));
-	conn->session_size = (uint32_t)cval.val + WT_NUM_INTERNAL_SESSIONS;
+	WT_ERR(__wt_config_gets(session, cfg, "eviction_workers", &cval));
+	conn->evict_workers = (u_int)cval.val;
+	WT_ERR(__wt_config_gets(session, cfg, "io_backend", &cval));
+	if (WT_STRING_MATCH("io_uring", cval.str, cval.len))
+		conn->io_backend = WT_IO_BACKEND_URING;
+	else if (WT_STRING_MATCH("threads", cval.str, cval.len))
+		conn->io_backend = WT_IO_BACKEND_THREADS;
+	else
+		conn->io_backend = WT_IO_BACKEND_SYNC;
+	WT_ERR(__wt_config_gets(session, cfg, "io_threads", &cval));
+	conn->io_threads = (u_int)cval.val;
+	WT_ERR(__wt_config_gets(session, cfg, "lsm_flush_workers", &cval));
+	conn->lsm_flush_workers = (u_int)cval.val;
 	WT_ERR(__wt_config_gets(session, cfg, "lsm_merge", &cval));
 	if (cval.val)
 		F_SET(conn, WT_CONN_LSM_MERGE);
+	WT_ERR(__wt_config_gets(session, cfg, "lsm_merge_workers", &cval));
+	conn->lsm_merge_workers = (u_int)cval.val;
+	WT_ERR(__wt_config_gets(session, cfg, "read_ahead_workers", &cval));
+	conn->read_ahead_workers = (u_int)cval.val;
+	WT_ERR(__wt_config_gets(session, cfg, "session_max", &cval));
+	conn->session_size = (uint32_t)cval.val + WT_NUM_INTERNAL_SESSIONS +
+	    conn->evict_workers + conn->lsm_flush_workers +
+	    conn->lsm_merge_workers + conn->read_ahead_workers;
+	if (conn->io_backend != WT_IO_BACKEND_SYNC)
+		conn->session_size += conn->io_threads;
 	WT_ERR(__wt_config_gets(session, cfg, "sync", &cval));
 	if (cval.val)
 		F_SET(conn, WT_CONN_SYNC);
@@ -863,8 +897,7 @@ wiredtiger_open(const char *home, WT_EVENT_HANDLER *event_handler,
 
 	WT_ERR(__wt_config_gets(session, cfg, "logging", &cval));
 	if (cval.val != 0)
-		WT_ERR(__wt_open(
-		   session, WT_LOG_FILENAME, 1, 0, 0, &conn->log_fh));
+		F_SET(conn, WT_CONN_LOGGING);
 
 	/* Configure direct I/O and buffer alignment. */
 	WT_ERR(__wt_config_gets(session, cfg, "buffer_alignment", &cval));
@@ -888,6 +921,26 @@ wiredtiger_open(const char *home, WT_EVENT_HANDLER *event_handler,
 			goto err;
 	}
 
+	/*
+	 * Direct I/O transfers must be aligned in memory and on disk: blocks
+	 * follow the file's description sector, so the buffer alignment must
+	 * divide its size.  Allocation sizes are checked when files open.
+	 */
+	if (conn->buffer_alignment != 0 &&
+	    !__wt_ispo2((uint32_t)conn->buffer_alignment))
+		WT_ERR_MSG(session, EINVAL,
+		    "buffer_alignment must be a power of two");
+	if (FLD_ISSET(conn->direct_io, WT_DIRECTIO_DATA) &&
+	    (conn->buffer_alignment == 0 ||
+	    WT_BLOCK_DESC_SECTOR % conn->buffer_alignment != 0))
+		WT_ERR_MSG(session, EINVAL,
+		    "direct_io=[data] requires a buffer_alignment that divides "
+		    "%d, the size of a file's description sector",
+		    WT_BLOCK_DESC_SECTOR);
+
+	WT_ERR(__wt_config_gets(session, cfg, "buffer_pool_size", &cval));
+	WT_ERR(__wt_iobuf_open(conn, (uint64_t)cval.val));
+
 	/* Load any extensions referenced in the config. */
 	WT_ERR(__wt_config_gets(session, cfg, "extensions", &cval));
 	WT_ERR(__wt_config_subinit(session, &subconfig, &cval));
@@ -915,6 +968,10 @@ wiredtiger_open(const char *home, WT_EVENT_HANDLER *event_handler,
 	WT_ERR(__wt_open_session(conn, 1, NULL, NULL, &conn->default_session));
 	session = conn->default_session;
 
+	/* Open the log. */
+	if (F_ISSET(conn, WT_CONN_LOGGING))
+		WT_ERR(__wt_log_open(session, cfg));
+
 	/*
 	 * Check on the turtle and metadata files, creating them if necessary
 	 * (which avoids application threads racing to create the metadata file
@@ -936,6 +993,10 @@ wiredtiger_open(const char *home, WT_EVENT_HANDLER *event_handler,
 	/* If there's a hot-backup file, load it. */
 	WT_ERR(__wt_metadata_load_backup(session));
 
+	/* If logging, replay the log from the last checkpoint. */
+	if (conn->log != NULL)
+		WT_ERR(__wt_txn_recover(session));
+
 	/*
 	 * XXX LSM initialization.
 	 * This is structured so that it could be moved to an extension.
@@ -26,6 +26,7 @@ __wt_connection_init(WT_CONNECTION_IMPL *conn)
 	TAILQ_INIT(&conn->compqh);		/* Compressor list */
 
 	TAILQ_INIT(&conn->lsmqh);		/* WT_LSM_TREE list */
+	TAILQ_INIT(&conn->lsm_flushqh);		/* LSM flush queue */
 
 	/* Statistics. */
 	WT_RET(__wt_stat_alloc_connection_stats(session, &conn->stats));
@@ -33,6 +34,7 @@ __wt_connection_init(WT_CONNECTION_IMPL *conn)
 	/* Locks. */
 	__wt_spin_init(session, &conn->api_lock);
 	__wt_spin_init(session, &conn->fh_lock);
+	__wt_spin_init(session, &conn->lsm_flush_lock);
 	__wt_spin_init(session, &conn->metadata_lock);
 	__wt_spin_init(session, &conn->schema_lock);
 	__wt_spin_init(session, &conn->serial_lock);
@@ -63,9 +65,6 @@ __wt_connection_destroy(WT_CONNECTION_IMPL *conn)
 	if (conn->lock_fh != NULL)
 		(void)__wt_close(session, conn->lock_fh);
 
-	if (conn->log_fh != NULL)
-		(void)__wt_close(session, conn->log_fh);
-
 	/* Remove from the list of connections. */
 	__wt_spin_lock(session, &__wt_process.spinlock);
 	TAILQ_REMOVE(&__wt_process.connqh, conn, q);
@@ -73,10 +72,14 @@ __wt_connection_destroy(WT_CONNECTION_IMPL *conn)
 
 	__wt_spin_destroy(session, &conn->api_lock);
 	__wt_spin_destroy(session, &conn->fh_lock);
+	__wt_spin_destroy(session, &conn->lsm_flush_lock);
 	__wt_spin_destroy(session, &conn->metadata_lock);
 	__wt_spin_destroy(session, &conn->schema_lock);
 	__wt_spin_destroy(session, &conn->serial_lock);
 
+	/* Discard the pool of I/O buffers. */
+	__wt_iobuf_close(conn);
+
 	/* Free allocated memory. */
 	__wt_free(session, conn->home);
 	__wt_free(session, conn->sessions);
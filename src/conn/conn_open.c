@@ -15,7 +15,10 @@ int
 __wt_connection_open(WT_CONNECTION_IMPL *conn, const char *cfg[])
 {
 	WT_DECL_RET;
+	WT_EVICT_WORKER *worker;
+	WT_READ_AHEAD_WORKER *ra_worker;
 	WT_SESSION_IMPL *evict_session, *session;
+	u_int i;
 
 	/* Default session. */
 	session = conn->default_session;
@@ -40,6 +43,9 @@ __wt_connection_open(WT_CONNECTION_IMPL *conn, const char *cfg[])
 	/* Start worker threads. */
 	F_SET(conn, WT_SERVER_RUN);
 
+	/* Start the batched I/O backend, the server threads may use it. */
+	WT_ERR(__wt_io_open(conn));
+
 	/*
 	 * Start the eviction thread.
 	 *
@@ -52,6 +58,26 @@ __wt_connection_open(WT_CONNECTION_IMPL *conn, const char *cfg[])
 	WT_ERR(__wt_thread_create(
 	    &conn->cache_evict_tid, __wt_cache_evict_server, evict_session));
 
+	/* Start the eviction worker threads, each with its own session. */
+	for (i = 0, worker = conn->cache->workers;
+	    i < conn->evict_workers; i++, worker++) {
+		WT_ERR(
+		    __wt_open_session(conn, 1, NULL, NULL, &worker->session));
+		worker->session->name = "eviction-worker";
+		WT_ERR(__wt_thread_create(
+		    &worker->tid, __wt_cache_evict_worker, worker));
+	}
+
+	/* Start the read-ahead worker threads, each with its own session. */
+	for (i = 0, ra_worker = conn->cache->read_ahead_workers;
+	    i < conn->read_ahead_workers; i++, ra_worker++) {
+		WT_ERR(__wt_open_session(
+		    conn, 1, NULL, NULL, &ra_worker->session));
+		ra_worker->session->name = "read-ahead-worker";
+		WT_ERR(__wt_thread_create(&ra_worker->tid,
+		    __wt_cache_read_ahead_worker, ra_worker));
+	}
+
 	return (0);
 
 err:	(void)__wt_connection_close(conn);
@@ -68,16 +94,22 @@ __wt_connection_close(WT_CONNECTION_IMPL *conn)
 	WT_SESSION_IMPL *session;
 	WT_DECL_RET;
 	WT_DLH *dlh;
+	WT_EVICT_WORKER *worker;
 	WT_FH *fh;
+	WT_READ_AHEAD_WORKER *ra_worker;
+	u_int i;
 
 	session = conn->default_session;
 
+	/* Write anything buffered in the log, and close it. */
+	WT_TRET(__wt_log_close(session));
+
 	/*
-	 * Complain if files weren't closed (ignoring the lock and logging
-	 * files, we'll close them in a minute.
+	 * Complain if files weren't closed (ignoring the lock file, we'll
+	 * close it in a minute.
 	 */
 	TAILQ_FOREACH(fh, &conn->fhqh, q) {
-		if (fh == conn->lock_fh || fh == conn->log_fh)
+		if (fh == conn->lock_fh)
 			continue;
 
 		__wt_errx(session,
@@ -86,12 +118,31 @@ __wt_connection_close(WT_CONNECTION_IMPL *conn)
 		fh = TAILQ_FIRST(&conn->fhqh);
 	}
 
-	/* Shut down the server threads. */
+	/*
+	 * Shut down the server threads.  The eviction workers use the eviction
+	 * server's queue, shut them down first.
+	 */
 	F_CLR(conn, WT_SERVER_RUN);
+	if (conn->cache != NULL && conn->cache->workers != NULL)
+		for (i = 0, worker = conn->cache->workers;
+		    i < conn->evict_workers; i++, worker++) {
+			if (worker->tid == 0)
+				continue;
+			__wt_cond_signal(session, worker->cond);
+			WT_TRET(__wt_thread_join(worker->tid));
+		}
 	if (conn->cache_evict_tid != 0) {
 		__wt_evict_server_wake(session);
 		WT_TRET(__wt_thread_join(conn->cache_evict_tid));
 	}
+	if (conn->cache != NULL && conn->cache->read_ahead_workers != NULL) {
+		__wt_cond_signal(session, conn->cache->read_ahead_cond);
+		for (i = 0, ra_worker = conn->cache->read_ahead_workers;
+		    i < conn->read_ahead_workers; i++, ra_worker++)
+			if (ra_worker->tid != 0)
+				WT_TRET(__wt_thread_join(ra_worker->tid));
+	}
+	WT_TRET(__wt_io_close(conn));
 
 	/* Discard the cache. */
 	__wt_cache_destroy(conn);
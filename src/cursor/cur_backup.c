@@ -131,6 +131,7 @@ __wt_curbackup_open(WT_SESSION_IMPL *session,
 		__wt_cursor_notsup,	/* search */
 		(int (*)		/* search-near */
 		    (WT_CURSOR *, int *))__wt_cursor_notsup,
+		NULL,			/* search-batch */
 		__wt_cursor_notsup,	/* insert */
 		__wt_cursor_notsup,	/* update */
 		__wt_cursor_notsup,	/* remove */
@@ -41,6 +41,7 @@ __wt_curconfig_open(WT_SESSION_IMPL *session,
 		__wt_cursor_notsup,	/* search */
 					/* search-near */
 		(int (*)(WT_CURSOR *, int *))__wt_cursor_notsup,
+		NULL,			/* search-batch */
 		__wt_cursor_notsup,	/* insert */
 		__wt_cursor_notsup,	/* update */
 		__wt_cursor_notsup,	/* remove */
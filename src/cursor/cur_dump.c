@@ -306,6 +306,7 @@ __wt_curdump_create(WT_CURSOR *child, WT_CURSOR *owner, WT_CURSOR **cursorp)
 		__curdump_reset,
 		__curdump_search,
 		__curdump_search_near,
+		NULL,			/* search-batch */
 		__curdump_insert,
 		__curdump_update,
 		__curdump_remove,
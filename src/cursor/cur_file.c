@@ -294,6 +294,7 @@ __wt_curfile_create(WT_SESSION_IMPL *session,
 		__curfile_reset,
 		__curfile_search,
 		__curfile_search_near,
+		NULL,			/* search-batch */
 		__curfile_insert,
 		__curfile_update,
 		__curfile_remove,
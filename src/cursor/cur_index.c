@@ -353,6 +353,7 @@ __wt_curindex_open(WT_SESSION_IMPL *session,
 		__curindex_reset,
 		__curindex_search,
 		__curindex_search_near,
+		NULL,			/* search-batch */
 		__wt_cursor_notsup,	/* insert */
 		__wt_cursor_notsup,	/* update */
 		__wt_cursor_notsup,	/* remove */
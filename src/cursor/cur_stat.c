@@ -337,6 +337,38 @@ __curstat_file_init(WT_SESSION_IMPL *session,
 	return (0);
 }
 
+/*
+ * __curstat_evict_worker_init --
+ *	Initialize the statistics for an eviction worker thread.
+ */
+static int
+__curstat_evict_worker_init(WT_SESSION_IMPL *session,
+    const char *uri, WT_CURSOR_STAT *cst, uint32_t flags)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_EVICT_WORKER *worker;
+	long id;
+	const char *p;
+	char *endp;
+
+	conn = S2C(session);
+
+	p = uri + strlen("statistics:evict_worker:");
+	id = strtol(p, &endp, 10);
+	if (*p == '\0' || *endp != '\0' ||
+	    id < 0 || id >= (long)conn->evict_workers)
+		return (__wt_bad_object_type(session, uri));
+	worker = &conn->cache->workers[id];
+
+	cst->btree = NULL;
+	cst->notpositioned = 1;
+	cst->stats_first = (WT_STATS *)worker->stats;
+	cst->stats_count = sizeof(WT_EVICT_WORKER_STATS) / sizeof(WT_STATS);
+	cst->clear_func = LF_ISSET(WT_STATISTICS_CLEAR) ?
+	    __wt_stat_clear_evict_worker_stats : NULL;
+	return (0);
+}
+
 /*
  * __curstat_lsm_init --
  *	Initialize the statistics for a LSM tree.
@@ -389,6 +421,7 @@ __wt_curstat_open(WT_SESSION_IMPL *session,
 		__curstat_search,
 					/* search-near */
 		(int (*)(WT_CURSOR *, int *))__wt_cursor_notsup,
+		NULL,			/* search-batch */
 		__wt_cursor_notsup,	/* insert */
 		__wt_cursor_notsup,	/* update */
 		__wt_cursor_notsup,	/* remove */
@@ -435,6 +468,8 @@ __wt_curstat_open(WT_SESSION_IMPL *session,
 	else if (WT_PREFIX_MATCH(uri, "statistics:file:"))
 		WT_ERR(__curstat_file_init(session,
 		    uri + strlen("statistics:"), cfg, cst, flags));
+	else if (WT_PREFIX_MATCH(uri, "statistics:evict_worker:"))
+		WT_ERR(__curstat_evict_worker_init(session, uri, cst, flags));
 	else if (WT_PREFIX_MATCH(uri, "statistics:lsm:"))
 		WT_ERR(__curstat_lsm_init(session,
 		    uri + strlen("statistics:"), cst, flags));
@@ -52,6 +52,8 @@ __wt_cursor_set_notsup(WT_CURSOR *cursor)
 	cursor->reset = __wt_cursor_noop;
 	cursor->search = __wt_cursor_notsup;
 	cursor->search_near = (int (*)(WT_CURSOR *, int *))__wt_cursor_notsup;
+	cursor->search_batch = (int (*)(WT_CURSOR *,
+	    WT_ITEM *, WT_ITEM *, int *, size_t))__wt_cursor_notsup;
 	cursor->insert = __wt_cursor_notsup;
 	cursor->update = __wt_cursor_notsup;
 	cursor->remove = __wt_cursor_notsup;
@@ -141,6 +143,24 @@ __wt_cursor_set_raw_key(WT_CURSOR *cursor, WT_ITEM *key)
 		F_CLR(cursor, WT_CURSTD_RAW);
 }
 
+/*
+ * __wt_cursor_set_raw_value --
+ *	Temporarily force raw mode in a cursor to set a canonical copy of
+ * the value.
+ */
+void
+__wt_cursor_set_raw_value(WT_CURSOR *cursor, WT_ITEM *value)
+{
+	int raw_set;
+
+	raw_set = F_ISSET(cursor, WT_CURSTD_RAW) ? 1 : 0;
+	if (!raw_set)
+		F_SET(cursor, WT_CURSTD_RAW);
+	cursor->set_value(cursor, value);
+	if (!raw_set)
+		F_CLR(cursor, WT_CURSTD_RAW);
+}
+
 /*
  * __wt_cursor_get_keyv --
  *	WT_CURSOR->get_key worker function.
@@ -477,6 +497,9 @@ __wt_cursor_init(WT_CURSOR *cursor,
 	if (cursor->search_near == NULL)
 		cursor->search_near =
 		    (int (*)(WT_CURSOR *, int *))__wt_cursor_notsup;
+	if (cursor->search_batch == NULL)
+		cursor->search_batch = (int (*)(WT_CURSOR *,
+		    WT_ITEM *, WT_ITEM *, int *, size_t))__wt_cursor_notsup;
 	if (cursor->insert == NULL)
 		cursor->insert = __wt_cursor_notsup;
 	if (cursor->update == NULL)
@@ -719,6 +719,7 @@ __wt_curtable_open(WT_SESSION_IMPL *session,
 		__curtable_reset,
 		__curtable_search,
 		__curtable_search_near,
+		NULL,			/* search-batch */
 		__curtable_insert,
 		__curtable_update,
 		__curtable_remove,
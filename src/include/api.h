@@ -107,6 +107,8 @@ struct __wt_session_impl {
 
 	void	*reconcile;		/* Reconciliation information */
 
+	WT_IO_SESSION *io;		/* Batched I/O information */
+
 	WT_REF **excl;			/* Eviction exclusive list */
 	u_int	 excl_next;		/* Next empty slot */
 	size_t	 excl_allocated;	/* Bytes allocated */
@@ -120,6 +122,9 @@ struct __wt_session_impl {
 
 	uint32_t id;			/* Offset in conn->session_array */
 
+	uint64_t write_bytes;		/* Bytes written to files */
+	uint64_t rec_usecs;		/* Time reconciling for eviction */
+
 	uint32_t flags;
 
 	/*
@@ -171,7 +176,9 @@ struct __wt_named_data_source {
 
 /*
  * Allocate some additional slots for internal sessions.  There is a default
- * session for each connection, plus a session for the eviction thread.
+ * session for each connection, plus a session for the eviction thread.  Each
+ * eviction worker thread and LSM flush and merge worker thread has a session
+ * as well, allocated in addition to these.
  */
 #define	WT_NUM_INTERNAL_SESSIONS	2
 
@@ -188,9 +195,10 @@ struct __wt_connection_impl {
 
 	WT_SPINLOCK api_lock;		/* Connection API spinlock */
 	WT_SPINLOCK fh_lock;		/* File handle queue spinlock */
+	WT_SPINLOCK lsm_flush_lock;	/* LSM flush queue spinlock */
 	WT_SPINLOCK metadata_lock;	/* Metadata spinlock */
 	WT_SPINLOCK schema_lock;	/* Schema operation spinlock */
-	WT_SPINLOCK serial_lock;	/* Serial function call spinlock */
+	WT_SPINLOCK serial_lock;	/* File sync request spinlock */
 
 	int ckpt_backup;		/* Backup: don't delete checkpoints */
 
@@ -204,10 +212,19 @@ struct __wt_connection_impl {
 
 	pthread_t cache_evict_tid;	/* Cache eviction server thread ID */
 
+	WT_LSM_WORKER *lsm_workers;	/* LSM merge worker threads */
+	WT_LSM_WORKER *lsm_flushers;	/* LSM flush worker threads */
+	WT_CONDVAR *lsm_flush_cond;	/* LSM flush workers wait */
+
+	int	    io_backend;		/* Batched I/O backend */
+	WT_IO_POOL *io_pool;		/* Batched I/O threads */
+
 					/* Locked: btree list */
 	TAILQ_HEAD(__wt_btree_qh, __wt_btree) btqh;
 					/* Locked: LSM handle list. */
 	TAILQ_HEAD(__wt_lsm_qh, __wt_lsm_tree) lsmqh;
+					/* Locked: LSM chunks to flush */
+	TAILQ_HEAD(__wt_lsm_flush_qh, __wt_lsm_flush_unit) lsm_flushqh;
 					/* Locked: file list */
 	TAILQ_HEAD(__wt_fh_qh, __wt_fh) fhqh;
 
@@ -230,6 +247,11 @@ struct __wt_connection_impl {
 	 */
 	WT_SESSION_IMPL	*sessions;	/* Session reference */
 	uint32_t	 session_size;	/* Session array size */
+	u_int		 evict_workers;	/* Eviction worker threads */
+	u_int		 lsm_flush_workers;	/* LSM flush worker threads */
+	u_int		 lsm_merge_workers;	/* LSM merge worker threads */
+	u_int		 read_ahead_workers;	/* Read-ahead worker threads */
+	u_int		 io_threads;	/* Batched I/O threads */
 	uint32_t	 session_cnt;	/* Session count */
 
 	/*
@@ -245,7 +267,7 @@ struct __wt_connection_impl {
 
 	WT_CONNECTION_STATS *stats;	/* Connection statistics */
 
-	WT_FH	   *log_fh;		/* Logging file handle */
+	WT_LOG	   *log;		/* Write-ahead log */
 
 					/* Locked: collator list */
 	TAILQ_HEAD(__wt_coll_qh, __wt_named_collator) collqh;
@@ -261,6 +283,7 @@ struct __wt_connection_impl {
 
 	/* If non-zero, all buffers used for I/O will be aligned to this. */
 	size_t buffer_alignment;
+	WT_IOBUF_POOL *iobuf_pool;	/* Aligned I/O buffers for reuse */
 
 	uint32_t direct_io;
 	uint32_t verbose;
@@ -385,7 +408,10 @@ extern WT_PROCESS __wt_process;
  * DO NOT EDIT: automatically built by dist/api_flags.py.
  * API flags section: BEGIN
  */
-#define	WT_CONN_LSM_MERGE				0x00000008
+#define	WT_CONN_LOGGING					0x00000040
+#define	WT_CONN_LSM_FLUSHERS				0x00000020
+#define	WT_CONN_LSM_MERGE				0x00000010
+#define	WT_CONN_LSM_WORKERS				0x00000008
 #define	WT_CONN_SYNC					0x00000004
 #define	WT_CONN_TRANSACTIONAL				0x00000002
 #define	WT_DIRECTIO_DATA				0x00000002
@@ -396,12 +422,13 @@ extern WT_PROCESS __wt_process;
 #define	WT_SESSION_INTERNAL				0x00000004
 #define	WT_SESSION_SALVAGE_QUIET_ERR			0x00000002
 #define	WT_SESSION_SCHEMA_LOCKED			0x00000001
-#define	WT_VERB_block					0x00002000
-#define	WT_VERB_ckpt					0x00001000
-#define	WT_VERB_evict					0x00000800
-#define	WT_VERB_evictserver				0x00000400
-#define	WT_VERB_fileops					0x00000200
-#define	WT_VERB_hazard					0x00000100
+#define	WT_VERB_block					0x00004000
+#define	WT_VERB_ckpt					0x00002000
+#define	WT_VERB_evict					0x00001000
+#define	WT_VERB_evictserver				0x00000800
+#define	WT_VERB_fileops					0x00000400
+#define	WT_VERB_hazard					0x00000200
+#define	WT_VERB_log					0x00000100
 #define	WT_VERB_lsm					0x00000080
 #define	WT_VERB_mutex					0x00000040
 #define	WT_VERB_read					0x00000020
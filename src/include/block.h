@@ -132,6 +132,19 @@ struct __wt_block_ckpt {
 	uint64_t write_gen;			/* Write generation */
 };
 
+/*
+ * WT_BLOCK_STAGE --
+ *	A batch of staged checkpoint writes, sorted by file offset.
+ */
+struct __wt_block_stage {
+	WT_IO_REQ *reqs;		/* Staged writes */
+	size_t	   reqs_alloc;
+	WT_ITEM	  *bufs;		/* Staged write buffers */
+	size_t	   bufs_alloc;
+	u_int	   entries;		/* Staged write count */
+	uint64_t   bytes;		/* Staged write bytes */
+};
+
 /*
  * WT_BLOCK --
  *	Encapsulation of the standard WiredTiger block manager.
@@ -150,6 +163,15 @@ struct __wt_block {
 
 	WT_COMPRESSOR *compressor;	/* Page compressor */
 
+				/* Checkpoint write staging */
+	int	   stage;		/* If staging writes */
+	off_t	   stage_next;		/* Offset following the last write */
+	WT_BLOCK_STAGE stage_batch[2];	/* Staged and written batches */
+	WT_BLOCK_STAGE *stage_cur;	/* Batch being staged */
+	WT_BLOCK_STAGE * volatile stage_flight;	/* Batch being written */
+	WT_CONDVAR *stage_cond;		/* Batch written condition */
+	int	   stage_error;		/* Batch write error */
+
 				/* Salvage support */
 	int	slvg;			/* If performing salvage */
 	off_t	slvg_off;		/* Salvage file offset */
@@ -231,6 +253,10 @@ struct __wt_block_header {
 	 * the result of corruption in the file.  If a page happens to checksum
 	 * to this special bit pattern, we bump it by one during reads and
 	 * writes to avoid ambiguity.
+	 *
+	 * Checksums are CRC32C, computed with the SSE4.2 crc32 instruction on
+	 * CPUs that have it, and with tables otherwise: both compute the same
+	 * value, so files move freely between machines.
 	 */
 #define	WT_BLOCK_CHECKSUM_NOT_SET	0xA5C35A3C
 	uint32_t cksum;			/* 12-15: checksum */
@@ -262,3 +288,20 @@ struct __wt_block_header {
  * a difference in terms of compression efficiency.
  */
 #define	WT_BLOCK_COMPRESS_SKIP	64
+
+/*
+ * WT_BLOCK_READ_BATCH --
+ *	The most blocks read with a single batch of I/O: larger batches are
+ * split, bounding the scratch buffers held at once.
+ */
+#define	WT_BLOCK_READ_BATCH	16
+
+/*
+ * WT_BLOCK_STAGE_MAX --
+ *	The most bytes of checkpoint writes staged before they're written.
+ * WT_BLOCK_STAGE_EXTENT --
+ *	The smallest available extent a checkpoint prefers to allocate from
+ * rather than extending the file.
+ */
+#define	WT_BLOCK_STAGE_MAX	(8 * WT_MEGABYTE)
+#define	WT_BLOCK_STAGE_EXTENT	WT_MEGABYTE
@@ -10,6 +10,37 @@
  *      http://code.google.com/p/cityhash-c/
  */
 
+/*
+ * Bloom filters are built with a blocked layout: the first hash selects a
+ * block of bits the size of a cache line, and all of the probes for a key
+ * land in that block.  Filters are persisted as a fixed-length column-store
+ * bit table, followed by a trailer marking the layout; filters without the
+ * trailer were built without blocks, every probe is anywhere in the filter.
+ */
+#define	WT_BLOOM_BLOCK_BITS	(WT_CACHE_LINE_ALIGNMENT * 8)
+#define	WT_BLOOM_MAGIC		"WTBloom1"	/* Blocked layout trailer */
+#define	WT_BLOOM_TRAILER_BITS	64
+
+/*
+ * WT_BLOOM_MEM --
+ *	The in-memory copy of a finalized Bloom filter, shared by all of the
+ * handles open on the filter.
+ */
+struct __wt_bloom_mem {
+	uint8_t *bitstring;	/* The filter's bits */
+	uint64_t m;		/* The number of slots in the bit string. */
+	size_t size;		/* Bytes of memory held */
+	int blocked;		/* Probes are in a single block */
+};
+
+/*
+ * WT_BLOOM_HASH --
+ *	A key's hash values, computed once and probed in any number of filters.
+ */
+struct __wt_bloom_hash {
+	uint64_t h1, h2;
+};
+
 struct __wt_bloom {
 	const char *uri;
 	char *config;
@@ -17,6 +48,9 @@ struct __wt_bloom {
 	WT_SESSION_IMPL *session;
 	WT_CURSOR *c;
 
+	WT_BLOOM_MEM **memp;	/* The finalized filter, once loaded */
+	WT_BLOOM_MEM *mem_private;
+
 	uint32_t k;		/* The number of hash functions used. */
 	uint32_t factor;	/* The number of bits per item inserted. */
 	uint64_t m;		/* The number of slots in the bit string. */
@@ -119,6 +119,23 @@ struct __wt_page_modify {
 	 */
 	uint32_t disk_gen;
 
+	/*
+	 * Bytes charged to the cache's count of dirty bytes: the page's memory
+	 * footprint when it was first modified, adjusted as the page changes
+	 * size, and released when the page is written or discarded.
+	 */
+	uint32_t bytes_dirty;
+
+	/*
+	 * Modifications to a page are serialized by the page's own lock: the
+	 * lock is held while new update structures are linked into the page's
+	 * lists, and while insert lists are created.  Threads of control
+	 * modifying different pages never contend.  Inserts into existing
+	 * insert lists don't take the lock or check the write generation, the
+	 * new item is linked into the skiplist with compare-and-swap.
+	 */
+	WT_SPINLOCK serial_lock;
+
 	union {
 		WT_PAGE *split;		/* Resulting split */
 		WT_ADDR	 replace;	/* Resulting replacement */
@@ -171,11 +188,6 @@ struct __wt_page_modify {
 	} *track;			/* Array of tracked objects */
 	uint32_t track_entries;		/* Total track slots */
 
-	wt_txnid_t first_id;		/* Earliest transactional update, used
-					 * to avoid errors from transaction ID
-					 * wraparound.
-					 */
-
 #define	WT_PM_REC_EMPTY		0x01	/* Reconciliation: page empty */
 #define	WT_PM_REC_REPLACE	0x02	/* Reconciliation: page replaced */
 #define	WT_PM_REC_SPLIT		0x04	/* Reconciliation: page split */
@@ -282,6 +294,13 @@ struct __wt_page {
 	/* Memory attached to the page. */
 	uint32_t memory_footprint;
 
+	/*
+	 * If the page's disk image is a buffer from the connection's pool of
+	 * I/O buffers, its size: the buffer returns to the pool when the page
+	 * is discarded.
+	 */
+	uint32_t dsk_pool_size;
+
 #define	WT_PAGE_INVALID		0	/* Invalid page */
 #define	WT_PAGE_BLOCK_MANAGER	1	/* Block-manager page */
 #define	WT_PAGE_COL_FIX		2	/* Col-store fixed-len leaf */
@@ -294,6 +313,7 @@ struct __wt_page {
 
 #define	WT_PAGE_BUILD_KEYS	0x01	/* Keys have been built in memory */
 #define	WT_PAGE_EVICT_LRU	0x02	/* Page is on the LRU queue */
+#define	WT_PAGE_READ_AHEAD	0x04	/* Read ahead, not yet used */
 	uint8_t flags_atomic;		/* Atomic flags, use F_*_ATOMIC */
 };
 
@@ -539,6 +559,10 @@ struct __wt_ikey {
  * list.
  */
 struct __wt_update {
+	wt_txnid_t txnid;		/* update transaction */
+
+	WT_UPDATE *next;		/* forward-linked list */
+
 	/*
 	 * We use the maximum size as an is-deleted flag, which means we can't
 	 * store 4GB objects; I'd rather do that than increase the size of this
@@ -547,14 +571,18 @@ struct __wt_update {
 #define	WT_UPDATE_DELETED_ISSET(upd)	((upd)->size == UINT32_MAX)
 #define	WT_UPDATE_DELETED_SET(upd)	((upd)->size = UINT32_MAX)
 	uint32_t size;			/* update length */
-	wt_txnid_t txnid;		/* update transaction */
-
-	WT_UPDATE *next;		/* forward-linked list */
 
 	/* The untyped value immediately follows the WT_UPDATE structure. */
 #define	WT_UPDATE_DATA(upd)						\
 	((void *)((uint8_t *)(upd) + sizeof(WT_UPDATE)))
-};
+} WT_GCC_ATTRIBUTE((packed));
+
+/*
+ * WT_UPDATE is packed: there's no trailing padding after the size field so
+ * the 64-bit transaction ID costs 4 bytes per update rather than 8.  Updates
+ * are allocated individually, so the ID and next pointer stay aligned.
+ */
+#define	WT_UPDATE_SIZE	20
 
 /*
  * WT_INSERT --
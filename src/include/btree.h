@@ -120,6 +120,13 @@ struct __wt_btree {
 
 	WT_PAGE *evict_page;		/* Eviction thread's location */
 	volatile uint32_t lru_count;	/* Count of threads in LRU eviction */
+	volatile uint32_t read_ahead_count;/* Count of read-ahead reads */
+	uint64_t evict_credit;		/* Eviction walk credit */
+	u_int	 evict_hot_skip;	/* Eviction walks to skip, hot tree */
+
+	uint64_t bytes_inmem;		/* Bytes in the cache */
+	uint64_t bytes_evict;		/* Bytes discarded by eviction */
+	uint64_t bytes_dirty;		/* Dirty bytes in the cache */
 
 	WT_BTREE_STATS *stats;		/* Btree statistics */
 
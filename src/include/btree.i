@@ -5,6 +5,46 @@
  * See the file LICENSE for redistribution information.
  */
 
+/*
+ * __wt_cache_dirty_incr --
+ *	Increment a dirty page's dirty byte count, and the cache's and tree's.
+ */
+static inline void
+__wt_cache_dirty_incr(WT_SESSION_IMPL *session, WT_PAGE *page, size_t size)
+{
+	(void)WT_ATOMIC_ADD(page->modify->bytes_dirty, WT_STORE_SIZE(size));
+	(void)WT_ATOMIC_ADD(S2C(session)->cache->bytes_dirty, size);
+	if (session->btree != NULL)
+		(void)WT_ATOMIC_ADD(session->btree->bytes_dirty, size);
+}
+
+/*
+ * __wt_cache_dirty_decr --
+ *	Decrement a page's dirty byte count, and the cache's and tree's.
+ */
+static inline void
+__wt_cache_dirty_decr(WT_SESSION_IMPL *session, WT_PAGE *page, size_t size)
+{
+	uint32_t decr, orig;
+
+	/*
+	 * The page's count can be cleared by another thread as the page is
+	 * reconciled: never take away more than the page has, and only adjust
+	 * the cache and tree by what we took from the page, so they remain the
+	 * sum of the pages' counts.
+	 */
+	do {
+		orig = page->modify->bytes_dirty;
+		decr = WT_MIN(orig, WT_STORE_SIZE(size));
+	} while (decr != 0 &&
+	    !WT_ATOMIC_CAS(page->modify->bytes_dirty, orig, orig - decr));
+	if (decr == 0)
+		return;
+	(void)WT_ATOMIC_SUB(S2C(session)->cache->bytes_dirty, decr);
+	if (session->btree != NULL)
+		(void)WT_ATOMIC_SUB(session->btree->bytes_dirty, decr);
+}
+
 /*
  * __wt_cache_page_inmem_incr --
  *	Increment a page's memory footprint in the cache.
@@ -14,7 +54,11 @@ __wt_cache_page_inmem_incr(
     WT_SESSION_IMPL *session, WT_PAGE *page, size_t size)
 {
 	(void)WT_ATOMIC_ADD(S2C(session)->cache->bytes_inmem, size);
+	if (session->btree != NULL)
+		(void)WT_ATOMIC_ADD(session->btree->bytes_inmem, size);
 	(void)WT_ATOMIC_ADD(page->memory_footprint, WT_STORE_SIZE(size));
+	if (page->modify != NULL && page->modify->bytes_dirty != 0)
+		__wt_cache_dirty_incr(session, page, size);
 }
 
 /*
@@ -26,7 +70,11 @@ __wt_cache_page_inmem_decr(
     WT_SESSION_IMPL *session, WT_PAGE *page, size_t size)
 {
 	(void)WT_ATOMIC_SUB(S2C(session)->cache->bytes_inmem, size);
+	if (session->btree != NULL)
+		(void)WT_ATOMIC_SUB(session->btree->bytes_inmem, size);
 	(void)WT_ATOMIC_SUB(page->memory_footprint, WT_STORE_SIZE(size));
+	if (page->modify != NULL && page->modify->bytes_dirty != 0)
+		__wt_cache_dirty_decr(session, page, size);
 }
 
 /*
@@ -44,6 +92,8 @@ __wt_cache_page_read(WT_SESSION_IMPL *session, WT_PAGE *page, size_t size)
 
 	(void)WT_ATOMIC_ADD(cache->pages_read, 1);
 	(void)WT_ATOMIC_ADD(cache->bytes_read, size);
+	if (session->btree != NULL)
+		(void)WT_ATOMIC_ADD(session->btree->bytes_inmem, size);
 	(void)WT_ATOMIC_ADD(page->memory_footprint, WT_STORE_SIZE(size));
 }
 
@@ -62,6 +112,9 @@ __wt_cache_page_evict(WT_SESSION_IMPL *session, WT_PAGE *page)
 
 	(void)WT_ATOMIC_ADD(cache->pages_evict, 1);
 	(void)WT_ATOMIC_ADD(cache->bytes_evict, page->memory_footprint);
+	if (session->btree != NULL)
+		(void)WT_ATOMIC_ADD(
+		    session->btree->bytes_evict, page->memory_footprint);
 
 	page->memory_footprint = 0;
 }
@@ -112,6 +165,52 @@ __wt_cache_bytes_inuse(WT_CACHE *cache)
 	return (bytes_in > bytes_out ? bytes_in - bytes_out : 0);
 }
 
+/*
+ * __wt_cache_bytes_dirty --
+ *	Return the number of dirty bytes in the cache.
+ */
+static inline uint64_t
+__wt_cache_bytes_dirty(WT_CACHE *cache)
+{
+	uint64_t bytes_dirty;
+
+	/*
+	 * The count is adjusted without locking, and can briefly go "negative"
+	 * as threads race to dirty and clean a page.
+	 */
+	bytes_dirty = cache->bytes_dirty;
+	return ((int64_t)bytes_dirty < 0 ? 0 : bytes_dirty);
+}
+
+/*
+ * __wt_btree_bytes_dirty --
+ *	Return the number of dirty bytes a tree has in the cache.
+ */
+static inline uint64_t
+__wt_btree_bytes_dirty(WT_BTREE *btree)
+{
+	uint64_t bytes_dirty;
+
+	/* See the comment in __wt_cache_bytes_dirty. */
+	bytes_dirty = btree->bytes_dirty;
+	return ((int64_t)bytes_dirty < 0 ? 0 : bytes_dirty);
+}
+
+/*
+ * __wt_btree_bytes_inuse --
+ *	Return the number of bytes a tree has in the cache.
+ */
+static inline uint64_t
+__wt_btree_bytes_inuse(WT_BTREE *btree)
+{
+	uint64_t bytes_in, bytes_out;
+
+	/* See the comment in __wt_cache_bytes_inuse. */
+	bytes_in = btree->bytes_inmem;
+	bytes_out = btree->bytes_evict;
+	return (bytes_in > bytes_out ? bytes_in - bytes_out : 0);
+}
+
 /*
  * __wt_page_modify_init --
  *	A page is about to be modified, allocate the modification structure.
@@ -125,13 +224,16 @@ __wt_page_modify_init(WT_SESSION_IMPL *session, WT_PAGE *page)
 		return (0);
 
 	WT_RET(__wt_calloc_def(session, 1, &modify));
+	__wt_spin_init(session, &modify->serial_lock);
 
 	/*
 	 * Multiple threads of control may be searching and deciding to modify
 	 * a page, if we don't do the update, discard the memory.
 	 */
-	if (!WT_ATOMIC_CAS(page->modify, NULL, modify))
+	if (!WT_ATOMIC_CAS(page->modify, NULL, modify)) {
+		__wt_spin_destroy(session, &modify->serial_lock);
 		__wt_free(session, modify);
+	}
 	return (0);
 }
 
@@ -140,8 +242,10 @@ __wt_page_modify_init(WT_SESSION_IMPL *session, WT_PAGE *page)
  *	Mark the page dirty.
  */
 static inline void
-__wt_page_modify_set(WT_PAGE *page)
+__wt_page_modify_set(WT_SESSION_IMPL *session, WT_PAGE *page)
 {
+	uint32_t size;
+
 	/*
 	 * Publish: there must be a barrier to ensure all changes to the page
 	 * are flushed before we update the page's write generation, otherwise
@@ -150,8 +254,23 @@ __wt_page_modify_set(WT_PAGE *page)
 	 */
 	WT_WRITE_BARRIER();
 
-	/* The page is dirty if the disk and write generations differ. */
-	++page->modify->write_gen;
+	/*
+	 * The page is dirty if the disk and write generations differ.  Inserts
+	 * into existing insert lists aren't serialized, increment atomically.
+	 */
+	(void)WT_ATOMIC_ADD(page->modify->write_gen, 1);
+
+	/*
+	 * If the page was clean, charge its memory footprint to the cache's
+	 * dirty bytes; if we race with another thread, only one succeeds.
+	 */
+	if (page->modify->bytes_dirty == 0 &&
+	    (size = page->memory_footprint) != 0 &&
+	    WT_ATOMIC_CAS(page->modify->bytes_dirty, 0, size)) {
+		(void)WT_ATOMIC_ADD(S2C(session)->cache->bytes_dirty, size);
+		if (session->btree != NULL)
+			(void)WT_ATOMIC_ADD(session->btree->bytes_dirty, size);
+	}
 }
 
 /*
@@ -171,7 +290,7 @@ __wt_page_and_tree_modify_set(WT_SESSION_IMPL *session, WT_PAGE *page)
 	 */
 	btree->modified = 1;
 
-	__wt_page_modify_set(page);
+	__wt_page_modify_set(session, page);
 }
 
 /*
@@ -403,6 +522,35 @@ __wt_skip_choose_depth(void)
 	return (d);
 }
 
+/*
+ * __wt_skip_last_stack --
+ *	Return the last item in a non-empty insert list, and set a skiplist
+ *	stack for appending an item after it.
+ */
+static inline WT_INSERT *
+__wt_skip_last_stack(WT_INSERT_HEAD *inshead, WT_INSERT ***ins_stack)
+{
+	WT_INSERT *ins, *next;
+	int i;
+
+	/*
+	 * Inserts into existing lists aren't serialized, and the tails are
+	 * updated after items are linked in: a tail may lag behind the end of
+	 * its list, and a higher-level tail may be ahead of the bottom-level
+	 * tail.  Every item on a higher level was first linked into the bottom
+	 * level, so read the higher-level tails, then walk the bottom level to
+	 * its end: the returned item sorts after every item in the stack.
+	 */
+	for (i = WT_SKIP_MAXDEPTH - 1; i > 0; i--)
+		ins_stack[i] = (inshead->tail[i] != NULL) ?
+		    &inshead->tail[i]->next[i] : &inshead->head[i];
+	WT_READ_BARRIER();
+	for (ins = inshead->tail[0]; (next = ins->next[0]) != NULL; ins = next)
+		;
+	ins_stack[0] = &ins->next[0];
+	return (ins);
+}
+
 /*
  * __wt_btree_lex_compare --
  *	Lexicographic comparison routine.
@@ -12,8 +12,54 @@
 struct __wt_evict_entry {
 	WT_BTREE *btree;			/* Enclosing btree object */
 	WT_PAGE	 *page;				/* Page to flush/evict */
+	uint64_t  score;			/* LRU sort key */
 };
 
+/*
+ * WT_EVICT_WORKER --
+ *	Encapsulation of an eviction worker thread.
+ */
+struct __wt_evict_worker {
+	WT_SESSION_IMPL *session;		/* Worker's session */
+	pthread_t	 tid;			/* Worker's thread */
+	WT_CONDVAR	*cond;			/* Worker's wakeup */
+	u_int		 id;			/* Worker's number */
+
+	WT_EVICT_WORKER_STATS *stats;		/* Worker's statistics */
+};
+
+/*
+ * WT_READ_AHEAD_UNIT --
+ *	A page queued to be read into the cache ahead of a cursor scan: the
+ * page's state is WT_REF_READING until a read-ahead worker reads it, or the
+ * unit is taken back off the queue.
+ */
+struct __wt_read_ahead_unit {
+	WT_BTREE *btree;			/* Enclosing btree object */
+	WT_PAGE	 *parent;			/* Parent page */
+	WT_REF	 *ref;				/* Page to read */
+	TAILQ_ENTRY(__wt_read_ahead_unit) q;
+};
+
+/*
+ * WT_READ_AHEAD_WORKER --
+ *	Encapsulation of a read-ahead worker thread.
+ */
+struct __wt_read_ahead_worker {
+	WT_SESSION_IMPL *session;		/* Worker's session */
+	pthread_t	 tid;			/* Worker's thread */
+	u_int		 id;			/* Worker's number */
+
+	uint64_t	 pages_read;		/* Pages read */
+	uint64_t	 pages_skip;		/* Pages skipped, cache full */
+};
+
+/*
+ * WT_READ_AHEAD_BATCH --
+ *	The most queued pages a read-ahead worker reads with one batch of I/O.
+ */
+#define	WT_READ_AHEAD_BATCH	8
+
 /*
  * WiredTiger cache structure.
  */
@@ -30,12 +76,26 @@ struct __wt_cache {
 	uint64_t bytes_inmem;		/* Bytes/pages created in memory */
 	uint64_t bytes_evict;		/* Bytes/pages discarded by eviction */
 	uint64_t pages_evict;
+	uint64_t bytes_dirty;		/* Bytes in modified pages */
+	uint64_t bytes_bloom;		/* Bytes in loaded Bloom filters */
 
 	/*
 	 * Read information.
 	 */
 	uint32_t   read_gen;		/* Page read generation (LRU) */
 
+	/*
+	 * Read-ahead information.
+	 */
+	WT_SPINLOCK read_ahead_lock;	/* Read-ahead queue spinlock */
+	WT_CONDVAR *read_ahead_cond;	/* Read-ahead workers wait */
+	u_int read_ahead_pages;		/* Pages to read ahead of a scan */
+	volatile uint32_t read_ahead_queued;	/* Pages in the queue */
+
+	WT_READ_AHEAD_WORKER *read_ahead_workers;
+					/* Locked: pages to read */
+	TAILQ_HEAD(__wt_read_ahead_qh, __wt_read_ahead_unit) read_ahead_qh;
+
 	/*
 	 * Eviction thread information.
 	 */
@@ -44,6 +104,11 @@ struct __wt_cache {
 
 	u_int eviction_trigger;		/* Percent to trigger eviction. */
 	u_int eviction_target;		/* Percent to end eviction */
+	u_int eviction_dirty_trigger;	/* Percent dirty to trigger eviction */
+	u_int eviction_dirty_target;	/* Percent dirty to end eviction */
+	int   evict_dirty;		/* Evicting to reduce dirty bytes */
+
+	WT_EVICT_WORKER *workers;	/* Eviction worker threads */
 
 	/*
 	 * LRU eviction list information.
@@ -53,6 +118,7 @@ struct __wt_cache {
 	size_t   evict_allocated;	/* LRU list bytes allocated */
 	uint32_t evict_entries;		/* LRU list eviction slots */
 	u_int    evict_file_next;	/* LRU: next file to search */
+	uint64_t evict_horizon;		/* LRU: newest candidate considered */
 
 	/*
 	 * Sync/flush request information.
@@ -14,7 +14,7 @@ __wt_eviction_check(WT_SESSION_IMPL *session, int *read_lockoutp, int wake)
 {
 	WT_CACHE *cache;
 	WT_CONNECTION_IMPL *conn;
-	uint64_t bytes_inuse, bytes_max;
+	uint64_t bytes_dirty, bytes_inuse, bytes_max;
 
 	conn = S2C(session);
 	cache = conn->cache;
@@ -30,8 +30,15 @@ __wt_eviction_check(WT_SESSION_IMPL *session, int *read_lockoutp, int wake)
 	if (read_lockoutp != NULL)
 		*read_lockoutp = (bytes_inuse > bytes_max);
 
-	/* Wake eviction when we're over the trigger cache size. */
-	if (wake && bytes_inuse >= (cache->eviction_trigger * bytes_max) / 100)
+	/*
+	 * Wake eviction when we're over the trigger cache size, or the dirty
+	 * trigger size: don't wait for the cache to fill with dirty pages that
+	 * must be written before they can be evicted.
+	 */
+	bytes_dirty = __wt_cache_bytes_dirty(cache);
+	if (wake &&
+	    (bytes_inuse >= (cache->eviction_trigger * bytes_max) / 100 ||
+	    bytes_dirty >= (cache->eviction_dirty_trigger * bytes_max) / 100))
 		__wt_evict_server_wake(session);
 }
 
@@ -65,17 +65,22 @@ __col_insert_search(
 	uint64_t ins_recno;
 	int cmp, i;
 
-	/* If there's no insert chain to search, we're done. */
-	if ((ret_ins = WT_SKIP_LAST(inshead)) == NULL)
+	/*
+	 * If there's no insert chain to search, we're done.  Clear the stack
+	 * if there's no list at all: if another thread creates the list before
+	 * we insert into it, the insert starts from the list's head.
+	 */
+	if ((ret_ins = WT_SKIP_LAST(inshead)) == NULL) {
+		if (inshead == NULL)
+			for (i = 0; i < WT_SKIP_MAXDEPTH; i++)
+				ins_stack[i] = NULL;
 		return (NULL);
+	}
 
 	/* Fast path appends. */
-	if (recno >= WT_INSERT_RECNO(ret_ins)) {
-		for (i = 0; i < WT_SKIP_MAXDEPTH; i++)
-			ins_stack[i] = (inshead->tail[i] != NULL) ?
-			    &inshead->tail[i]->next[i] : &inshead->head[i];
+	ret_ins = __wt_skip_last_stack(inshead, ins_stack);
+	if (recno >= WT_INSERT_RECNO(ret_ins))
 		return (ret_ins);
-	}
 
 	/*
 	 * The insert list is a skip list: start at the highest skip level, then
@@ -48,6 +48,7 @@ extern int __wt_block_checkpoint(WT_SESSION_IMPL *session,
     WT_CKPT *ckptbase);
 extern int __wt_block_checkpoint_resolve(WT_SESSION_IMPL *session,
     WT_BLOCK *block);
+extern void __wt_cksum_init(void);
 extern uint32_t __wt_cksum(const void *chunk, size_t len);
 extern int __wt_block_compact_skip( WT_SESSION_IMPL *session,
     WT_BLOCK *block,
@@ -157,11 +158,18 @@ extern int __wt_bm_read(WT_SESSION_IMPL *session,
     WT_ITEM *buf,
     const uint8_t *addr,
     uint32_t addr_size);
+extern int __wt_bm_read_batch(WT_SESSION_IMPL *session,
+    WT_ITEM *bufs,
+    const uint8_t **addrs,
+    uint32_t *addr_sizes,
+    u_int n);
 extern int __wt_bm_write_size(WT_SESSION_IMPL *session, uint32_t *sizep);
 extern int __wt_bm_write( WT_SESSION_IMPL *session,
     WT_ITEM *buf,
     uint8_t *addr,
     uint32_t *addr_size);
+extern int __wt_bm_stage_start(WT_SESSION_IMPL *session);
+extern int __wt_bm_stage_end(WT_SESSION_IMPL *session);
 extern int __wt_bm_stat(WT_SESSION_IMPL *session);
 extern int __wt_bm_salvage_start(WT_SESSION_IMPL *session);
 extern int __wt_bm_salvage_next(WT_SESSION_IMPL *session,
@@ -198,6 +206,12 @@ extern int __wt_block_read_off(WT_SESSION_IMPL *session,
     off_t offset,
     uint32_t size,
     uint32_t cksum);
+extern int __wt_block_read_batch(WT_SESSION_IMPL *session,
+    WT_BLOCK *block,
+    WT_ITEM *bufs,
+    const uint8_t **addrs,
+    uint32_t *addr_sizes,
+    u_int n);
 extern int __wt_block_salvage_start(WT_SESSION_IMPL *session, WT_BLOCK *block);
 extern int __wt_block_salvage_end(WT_SESSION_IMPL *session, WT_BLOCK *block);
 extern int __wt_block_salvage_next( WT_SESSION_IMPL *session,
@@ -237,6 +251,17 @@ extern int __wt_block_write(WT_SESSION_IMPL *session,
     WT_ITEM *buf,
     uint8_t *addr,
     uint32_t *addr_size);
+extern void __wt_block_stage_start(WT_SESSION_IMPL *session, WT_BLOCK *block);
+extern int __wt_block_stage_end(WT_SESSION_IMPL *session, WT_BLOCK *block);
+extern int __wt_block_stage_read( WT_SESSION_IMPL *session,
+    WT_BLOCK *block,
+    off_t offset,
+    uint32_t size);
+extern void __wt_block_stage_discard( WT_SESSION_IMPL *session,
+    WT_BLOCK *block,
+    off_t offset,
+    off_t size);
+extern void __wt_block_stage_destroy(WT_SESSION_IMPL *session, WT_BLOCK *block);
 extern int __wt_block_write_off(WT_SESSION_IMPL *session,
     WT_BLOCK *block,
     WT_ITEM *buf,
@@ -256,9 +281,16 @@ extern int __wt_bloom_open(WT_SESSION_IMPL *session,
     uint32_t factor,
     uint32_t k,
     WT_CURSOR *owner,
+    WT_BLOOM_MEM **memp,
     WT_BLOOM **bloomp);
 extern int __wt_bloom_insert(WT_BLOOM *bloom, WT_ITEM *key);
+extern void __wt_bloom_hash_insert(WT_BLOOM *bloom, WT_BLOOM_HASH *bhash);
 extern int __wt_bloom_finalize(WT_BLOOM *bloom);
+extern void __wt_bloom_mem_free(WT_SESSION_IMPL *session, WT_BLOOM_MEM **memp);
+extern void __wt_bloom_hash(WT_BLOOM *bloom,
+    WT_ITEM *key,
+    WT_BLOOM_HASH *bhash);
+extern int __wt_bloom_hash_get(WT_BLOOM *bloom, WT_BLOOM_HASH *bhash);
 extern int __wt_bloom_get(WT_BLOOM *bloom, WT_ITEM *key);
 extern int __wt_bloom_close(WT_BLOOM *bloom);
 extern int __wt_bloom_drop(WT_BLOOM *bloom, const char *config);
@@ -317,6 +349,7 @@ extern void __wt_evict_list_clr_page(WT_SESSION_IMPL *session, WT_PAGE *page);
 extern void __wt_evict_server_wake(WT_SESSION_IMPL *session);
 extern int __wt_sync_file_serial_func(WT_SESSION_IMPL *session, void *args);
 extern void *__wt_cache_evict_server(void *arg);
+extern void *__wt_cache_evict_worker(void *arg);
 extern int __wt_evict_lru_page(WT_SESSION_IMPL *session, int is_app);
 extern int __wt_btree_create(WT_SESSION_IMPL *session, const char *filename);
 extern int __wt_btree_truncate(WT_SESSION_IMPL *session, const char *filename);
@@ -374,6 +407,13 @@ extern int __wt_page_inmem(WT_SESSION_IMPL *session,
 extern int __wt_cache_read(WT_SESSION_IMPL *session,
     WT_PAGE *parent,
     WT_REF *ref);
+extern int __wt_cache_read_ahead( WT_SESSION_IMPL *session,
+    WT_PAGE *parent,
+    uint32_t slot,
+    int prev);
+extern int __wt_cache_read_ahead_steal(WT_SESSION_IMPL *session, WT_REF *ref);
+extern void __wt_cache_read_ahead_drain(WT_SESSION_IMPL *session);
+extern void *__wt_cache_read_ahead_worker(void *arg);
 extern int __wt_kv_return(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt);
 extern int __wt_bt_salvage( WT_SESSION_IMPL *session,
     WT_CKPT *ckptbase,
@@ -458,7 +498,6 @@ extern int __wt_row_ikey_alloc(WT_SESSION_IMPL *session,
     const void *key,
     uint32_t size,
     void *ikeyp);
-extern int __wt_row_key_serial_func(WT_SESSION_IMPL *session, void *args);
 extern int __wt_row_modify(WT_SESSION_IMPL *session,
     WT_CURSOR_BTREE *cbt,
     int is_remove);
@@ -467,10 +506,14 @@ extern int __wt_row_insert_alloc(WT_SESSION_IMPL *session,
     u_int skipdepth,
     WT_INSERT **insp,
     size_t *ins_sizep);
-extern int __wt_insert_serial_func(WT_SESSION_IMPL *session, void *args);
-extern int __wt_update_check(WT_SESSION_IMPL *session,
+extern int __wt_insert_skiplist(WT_SESSION_IMPL *session,
     WT_PAGE *page,
-    WT_UPDATE *next);
+    WT_INSERT_HEAD *inshead,
+    WT_INSERT ***ins_stack,
+    WT_INSERT **new_insp,
+    size_t new_ins_size,
+    u_int skipdepth);
+extern int __wt_insert_serial_func(WT_SESSION_IMPL *session, void *args);
 extern int __wt_update_alloc(WT_SESSION_IMPL *session,
     WT_ITEM *value,
     WT_UPDATE **updp,
@@ -669,6 +712,7 @@ extern int __wt_cursor_get_key(WT_CURSOR *cursor, ...);
 extern void __wt_cursor_set_key(WT_CURSOR *cursor, ...);
 extern int __wt_cursor_get_raw_key(WT_CURSOR *cursor, WT_ITEM *key);
 extern void __wt_cursor_set_raw_key(WT_CURSOR *cursor, WT_ITEM *key);
+extern void __wt_cursor_set_raw_value(WT_CURSOR *cursor, WT_ITEM *value);
 extern int __wt_cursor_get_keyv(WT_CURSOR *cursor, uint32_t flags, va_list ap);
 extern void __wt_cursor_set_keyv(WT_CURSOR *cursor, uint32_t flags, va_list ap);
 extern int __wt_cursor_get_value(WT_CURSOR *cursor, ...);
@@ -694,7 +738,62 @@ extern int __wt_curtable_open(WT_SESSION_IMPL *session,
     const char *uri,
     const char *cfg[],
     WT_CURSOR **cursorp);
-extern int __wt_log_put(WT_SESSION_IMPL *session, WT_LOGREC_DESC *recdesc, ...);
+extern int __wt_log_extract_lognum( WT_SESSION_IMPL *session,
+    const char *name,
+    uint32_t *idp);
+extern int __wt_log_open_file( WT_SESSION_IMPL *session,
+    uint32_t id,
+    int ok_create,
+    WT_FH **fhp);
+extern uint32_t __wt_log_record_size(uint32_t len);
+extern int __wt_logrec_alloc(WT_SESSION_IMPL *session,
+    size_t size,
+    WT_ITEM **logrecp);
+extern void __wt_logrec_free(WT_SESSION_IMPL *session, WT_ITEM **logrecp);
+extern int __wt_logrec_init(WT_SESSION_IMPL *session,
+    WT_ITEM *logrec,
+    size_t size);
+extern int __wt_logrec_pack(WT_SESSION_IMPL *session,
+    WT_ITEM *logrec,
+    uint32_t rectype,
+    WT_LOGREC_DESC *recdesc,
+    ...);
+extern int __wt_logop_pack(WT_SESSION_IMPL *session,
+    WT_ITEM *logrec,
+    uint32_t optype,
+    WT_LOGREC_DESC *recdesc,
+    ...);
+extern int __wt_log_unpack(WT_SESSION_IMPL *session,
+    const uint8_t **pp,
+    const uint8_t *end,
+    WT_LOGREC_DESC *recdesc,
+    ...);
+extern int __wt_logrec_read(WT_SESSION_IMPL *session,
+    const uint8_t **pp,
+    const uint8_t *end,
+    uint32_t *rectypep);
+extern int __wt_logop_read(WT_SESSION_IMPL *session,
+    const uint8_t **pp,
+    const uint8_t *end,
+    uint32_t *optypep,
+    uint32_t *opsizep);
+extern int __wt_log_flush(WT_SESSION_IMPL *session, WT_LSN *lsn, int dosync);
+extern int __wt_log_write(WT_SESSION_IMPL *session,
+    WT_ITEM *logrec,
+    WT_LSN *lsnp,
+    WT_TXN_SYNC sync);
+extern void __wt_log_ckpt_lsn(WT_SESSION_IMPL *session, WT_LSN *lsnp);
+extern int __wt_log_checkpoint(WT_SESSION_IMPL *session, WT_LSN *ckpt_lsn);
+extern int __wt_log_archive(WT_SESSION_IMPL *session, WT_LSN *lsnp);
+extern int __wt_log_scan(WT_SESSION_IMPL *session,
+    WT_LSN *lsnp,
+    int (*func)(WT_SESSION_IMPL *,
+    WT_ITEM *,
+    WT_LSN *,
+    void *),
+    void *cookie);
+extern int __wt_log_open(WT_SESSION_IMPL *session, const char *cfg[]);
+extern int __wt_log_close(WT_SESSION_IMPL *session);
 extern int __wt_log_vprintf(WT_SESSION_IMPL *session,
     const char *fmt,
     va_list ap);
@@ -703,10 +802,18 @@ extern int __wt_log_printf(WT_SESSION_IMPL *session,
     ...) WT_GCC_ATTRIBUTE((format (printf,
     2,
     3)));
-extern WT_LOGREC_DESC __wt_logdesc_debug;
-extern int __wt_clsm_init_merge(WT_CURSOR *cursor,
-    int start_chunk,
-    int nchunks);
+extern WT_LOGREC_DESC __wt_logdesc_rec_file_header;
+extern WT_LOGREC_DESC __wt_logdesc_rec_checkpoint;
+extern WT_LOGREC_DESC __wt_logdesc_rec_commit;
+extern WT_LOGREC_DESC __wt_logdesc_rec_debug;
+extern WT_LOGREC_DESC __wt_logdesc_op_col_put;
+extern WT_LOGREC_DESC __wt_logdesc_op_col_remove;
+extern WT_LOGREC_DESC __wt_logdesc_op_row_put;
+extern WT_LOGREC_DESC __wt_logdesc_op_row_remove;
+extern int __wt_clsm_init_merge( WT_CURSOR *cursor,
+    WT_LSM_CHUNK **chunks,
+    int nchunks,
+    int minor);
 extern int __wt_clsm_open(WT_SESSION_IMPL *session,
     const char *uri,
     WT_CURSOR *owner,
@@ -727,6 +834,7 @@ extern int __wt_lsm_meta_write(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree);
 extern int __wt_lsm_stat_init( WT_SESSION_IMPL *session,
     WT_LSM_TREE *lsm_tree,
     uint32_t flags);
+extern void __wt_lsm_chunk_free(WT_SESSION_IMPL *session, WT_LSM_CHUNK *chunk);
 extern int __wt_lsm_tree_close_all(WT_SESSION_IMPL *session);
 extern int __wt_lsm_tree_bloom_name( WT_SESSION_IMPL *session,
     WT_LSM_TREE *lsm_tree,
@@ -740,6 +848,7 @@ extern int __wt_lsm_tree_setup_chunk(WT_SESSION_IMPL *session,
     WT_LSM_TREE *lsm_tree,
     int i,
     WT_LSM_CHUNK *chunk,
+    const char *config,
     int create_bloom);
 extern int __wt_lsm_tree_create(WT_SESSION_IMPL *session,
     const char *uri,
@@ -753,6 +862,8 @@ extern void __wt_lsm_tree_release(WT_SESSION_IMPL *session,
     WT_LSM_TREE *lsm_tree);
 extern int __wt_lsm_tree_switch( WT_SESSION_IMPL *session,
     WT_LSM_TREE *lsm_tree);
+extern void __wt_lsm_tree_throttle(WT_SESSION_IMPL *session,
+    WT_LSM_TREE *lsm_tree);
 extern int __wt_lsm_tree_drop( WT_SESSION_IMPL *session,
     const char *name,
     const char *cfg[]);
@@ -769,11 +880,20 @@ extern int __wt_lsm_tree_worker(WT_SESSION_IMPL *session,
     const char *[]),
     const char *cfg[],
     uint32_t open_flags);
-extern void *__wt_lsm_worker(void *arg);
-extern void *__wt_lsm_checkpoint_worker(void *arg);
-extern int __wt_lsm_copy_chunks(WT_SESSION_IMPL *session,
+extern int __wt_lsm_merge_workers_start(WT_SESSION_IMPL *session);
+extern int __wt_lsm_merge_workers_stop(WT_SESSION_IMPL *session);
+extern int __wt_lsm_flush_workers_start(WT_SESSION_IMPL *session);
+extern int __wt_lsm_flush_workers_stop(WT_SESSION_IMPL *session);
+extern int __wt_lsm_flush_queue( WT_SESSION_IMPL *session,
     WT_LSM_TREE *lsm_tree,
-    WT_LSM_WORKER_COOKIE *cookie);
+    WT_LSM_CHUNK *chunk);
+extern void __wt_lsm_flush_purge(WT_SESSION_IMPL *session,
+    WT_LSM_TREE *lsm_tree);
+extern int __wt_lsm_schema_lock( WT_SESSION_IMPL *session,
+    WT_LSM_TREE *lsm_tree,
+    uint32_t pool);
+extern void *__wt_lsm_merge_worker(void *arg);
+extern void *__wt_lsm_flush_worker(void *arg);
 extern int __wt_metadata_get(WT_SESSION *session,
     const char *uri,
     const char **valuep);
@@ -794,6 +914,8 @@ extern int __wt_meta_checkpoint_last_name( WT_SESSION_IMPL *session,
     const char **namep);
 extern int __wt_meta_checkpoint_clear(WT_SESSION_IMPL *session,
     const char *fname);
+extern int __wt_meta_checkpoint_lsn(WT_SESSION_IMPL *session, WT_LSN *lsnp);
+extern int __wt_meta_checkpoint_lsn_set(WT_SESSION_IMPL *session, WT_LSN *lsn);
 extern int __wt_meta_ckptlist_get( WT_SESSION_IMPL *session,
     const char *fname,
     WT_CKPT **ckptbasep);
@@ -841,6 +963,11 @@ extern int __wt_calloc(WT_SESSION_IMPL *session,
     size_t number,
     size_t size,
     void *retp);
+extern int __wt_calloc_aligned(WT_SESSION_IMPL *session,
+    size_t number,
+    size_t size,
+    size_t alignment,
+    void *retp);
 extern int __wt_realloc(WT_SESSION_IMPL *session,
     size_t *bytes_allocated_ret,
     size_t bytes_to_allocate,
@@ -855,6 +982,13 @@ extern int __wt_strndup(WT_SESSION_IMPL *session,
     void *retp);
 extern int __wt_strdup(WT_SESSION_IMPL *session, const char *str, void *retp);
 extern void __wt_free_int(WT_SESSION_IMPL *session, void *p_arg);
+extern int __wt_dirlist(WT_SESSION_IMPL *session,
+    const char *prefix,
+    char ***dirlistp,
+    u_int *countp);
+extern void __wt_dirlist_free(WT_SESSION_IMPL *session,
+    char **entries,
+    u_int count);
 extern int __wt_dlopen(WT_SESSION_IMPL *session,
     const char *path,
     WT_DLH **dlhp);
@@ -872,6 +1006,12 @@ extern int __wt_bytelock(WT_FH *fhp, off_t byte, int lock);
 extern int __wt_fsync(WT_SESSION_IMPL *session, WT_FH *fh);
 extern int __wt_ftruncate(WT_SESSION_IMPL *session, WT_FH *fh, off_t len);
 extern int __wt_getline(WT_SESSION_IMPL *session, WT_ITEM *buf, FILE *fp);
+extern int __wt_read_batch(WT_SESSION_IMPL *session, WT_IO_REQ *reqs, u_int n);
+extern int __wt_write_batch(WT_SESSION_IMPL *session, WT_IO_REQ *reqs, u_int n);
+extern void __wt_io_session_destroy(WT_SESSION_IMPL *session);
+extern void *__wt_io_worker(void *arg);
+extern int __wt_io_open(WT_CONNECTION_IMPL *conn);
+extern int __wt_io_close(WT_CONNECTION_IMPL *conn);
 extern int __wt_cond_alloc(WT_SESSION_IMPL *session,
     const char *name,
     int is_signalled,
@@ -1183,6 +1323,10 @@ extern int __wt_huffman_decode(WT_SESSION_IMPL *session,
     const uint8_t *from_arg,
     uint32_t from_len,
     WT_ITEM *to_buf);
+extern int __wt_iobuf_get(WT_SESSION_IMPL *session, size_t size, WT_ITEM *buf);
+extern void __wt_iobuf_put(WT_SESSION_IMPL *session, void *p, size_t memsize);
+extern int __wt_iobuf_open(WT_CONNECTION_IMPL *conn, uint64_t bytes_max);
+extern void __wt_iobuf_close(WT_CONNECTION_IMPL *conn);
 extern uint32_t __wt_nlpo2_round(uint32_t v);
 extern uint32_t __wt_nlpo2(uint32_t v);
 extern int __wt_ispo2(uint32_t v);
@@ -1235,11 +1379,15 @@ extern void __wt_stat_clear_btree_stats(WT_STATS *stats_arg);
 extern int __wt_stat_alloc_connection_stats(WT_SESSION_IMPL *session,
     WT_CONNECTION_STATS **statsp);
 extern void __wt_stat_clear_connection_stats(WT_STATS *stats_arg);
+extern int __wt_stat_alloc_evict_worker_stats(WT_SESSION_IMPL *session,
+    WT_EVICT_WORKER_STATS **statsp);
+extern void __wt_stat_clear_evict_worker_stats(WT_STATS *stats_arg);
 extern int __wt_stat_alloc_lsm_stats(WT_SESSION_IMPL *session,
     WT_LSM_STATS **statsp);
 extern void __wt_stat_clear_lsm_stats(WT_STATS *stats_arg);
 extern int __wt_txnid_cmp(const void *v1, const void *v2);
 extern void __wt_txn_release_snapshot(WT_SESSION_IMPL *session);
+extern void __wt_txn_update_oldest(WT_SESSION_IMPL *session);
 extern void __wt_txn_get_oldest(WT_SESSION_IMPL *session);
 extern void __wt_txn_get_snapshot( WT_SESSION_IMPL *session,
     wt_txnid_t my_id,
@@ -1255,3 +1403,8 @@ extern int __wt_txn_global_init(WT_CONNECTION_IMPL *conn, const char *cfg[]);
 extern void __wt_txn_global_destroy(WT_CONNECTION_IMPL *conn);
 extern int __wt_txn_checkpoint(WT_SESSION_IMPL *session, const char *cfg[]);
 extern int __wt_checkpoint(WT_SESSION_IMPL *session, const char *cfg[]);
+extern int __wt_txn_log_op(WT_SESSION_IMPL *session,
+    WT_CURSOR_BTREE *cbt,
+    int is_remove);
+extern int __wt_txn_log_commit(WT_SESSION_IMPL *session);
+extern int __wt_txn_recover(WT_SESSION_IMPL *session);
@@ -5,20 +5,99 @@
  * See the file LICENSE for redistribution information.
  */
 
-#define	WT_LOG_FILENAME	"WiredTiger.log"		/* Log file name */
-
-/* Logging subsystem declarations. */
-typedef enum {
-	WT_LOGREC_INT16,
-	WT_LOGREC_UINT16,
-	WT_LOGREC_INT32,
-	WT_LOGREC_UINT32,
-	WT_LOGREC_INT64,
-	WT_LOGREC_UINT64,
-	WT_LOGREC_STRING,
-} WT_LOGREC_FIELDTYPE;
-
-typedef struct {
+#define	WT_LOG_FILENAME	"WiredTigerLog"		/* Log file name prefix */
+
+#define	WT_LOG_MAGIC		0x101064	/* Log file magic number */
+#define	WT_LOG_VERSION		1		/* Log file version */
+
+/*
+ * Log records are aligned in the log file, the record header is read with a
+ * single aligned access.
+ */
+#define	WT_LOG_ALIGN		8
+
+/*
+ * The log buffer is written when it grows past this size, even if no commit
+ * has asked for it to be written.
+ */
+#define	WT_LOG_BUFFER_MAX	(256 * 1024)
+
+/* Log files are read sequentially in chunks of this size during recovery. */
+#define	WT_LOG_READ_SIZE	(1024 * 1024)
+
+/*
+ * WT_LSN --
+ *	A log sequence number: a log file number and an offset in that file.
+ */
+struct __wt_lsn {
+	uint32_t file;			/* Log file number */
+	off_t	 offset;		/* Log file offset */
+};
+
+/*
+ * Compare two LSNs, return -1 if lsn1 < lsn2, 0 if equal, 1 if lsn1 > lsn2.
+ */
+#define	WT_LSN_CMP(lsn1, lsn2)						\
+	((lsn1)->file != (lsn2)->file ?					\
+	((lsn1)->file < (lsn2)->file ? -1 : 1) :			\
+	((lsn1)->offset != (lsn2)->offset ?				\
+	((lsn1)->offset < (lsn2)->offset ? -1 : 1) : 0))
+
+/*
+ * WT_LOG_RECORD --
+ *	The header of a log record.  The record body is a packed record type
+ * followed by the type-specific fields, described in dist/log_data.py.
+ */
+struct __wt_log_record {
+	uint32_t len;			/* 00-03: Record length, unpadded */
+	uint32_t checksum;		/* 04-07: Checksum of the record */
+	uint8_t  unused[8];		/* 08-15: Padding */
+	uint8_t	 record[0];		/* Beginning of actual data */
+};
+
+/*
+ * WT_LOG --
+ *	The write-ahead log.
+ *
+ * Committing transactions copy their records into the active log buffer
+ * under the log spinlock, which is only held long enough to allocate space
+ * and copy.  Writing the log is serialized by the write lock: the thread
+ * holding it swaps the active buffer with the (empty) spare, and writes and
+ * optionally syncs everything copied in so far.  Threads that copied their
+ * records in while a write was in progress wait for the write lock, and
+ * the first of them writes all of their records together: one write and
+ * one sync covers a group of concurrent commits.
+ *
+ * Committing transactions hold the checkpoint lock for reading from when
+ * their commit record is written until their updates are visible: the
+ * checkpoint lock is held for writing while a checkpoint chooses its LSN and
+ * takes its snapshot, so every commit before the checkpoint LSN is in the
+ * checkpoint, and every commit after it will be replayed by recovery.
+ */
+struct __wt_log {
+	WT_SPINLOCK	lock;		/* Locked: buffer and LSN allocation */
+	WT_RWLOCK      *write_lock;	/* Locked: writing/syncing the log */
+	WT_RWLOCK      *ckpt_lock;	/* Locked: checkpoint LSN and commit */
+
+	WT_FH	       *log_fh;		/* Current log file handle */
+	off_t		log_file_max;	/* Maximum log file size */
+
+	WT_LSN		alloc_lsn;	/* Next LSN to allocate */
+	WT_LSN		buf_lsn;	/* LSN of the active buffer's start */
+	WT_LSN		write_lsn;	/* End of the last write */
+	WT_LSN		sync_lsn;	/* End of the last sync */
+	WT_LSN		first_lsn;	/* First record in the current file */
+
+	WT_ITEM		buf[2];		/* Log buffers */
+	u_int		active;		/* Active log buffer */
+};
+
+/*
+ * WT_LOGREC_DESC --
+ *	A description of a log record or log operation type, the pack format
+ * and the names of the fields, generated from dist/log_data.py.
+ */
+struct __wt_logrec_desc {
 	const char *fmt;
 	const char *fields[];
-} WT_LOGREC_DESC;
+};
@@ -1,7 +1,143 @@
 /* DO NOT EDIT: automatically built by dist/log.py. */
 
+/* Log record types. */
+#define	WT_LOGREC_INVALID	0
+#define	WT_LOGREC_FILE_HEADER	1
+#define	WT_LOGREC_CHECKPOINT	2
+#define	WT_LOGREC_COMMIT	3
+#define	WT_LOGREC_DEBUG	4
+
+/* Log operation types. */
+#define	WT_LOGOP_INVALID	0
+#define	WT_LOGOP_COL_PUT	1
+#define	WT_LOGOP_COL_REMOVE	2
+#define	WT_LOGOP_ROW_PUT	3
+#define	WT_LOGOP_ROW_REMOVE	4
+
+static inline int
+__wt_logrec_file_header_pack(WT_SESSION_IMPL *session, WT_ITEM *logrec,
+    uint32_t magic, uint32_t version)
+{
+	return (__wt_logrec_pack(session, logrec, WT_LOGREC_FILE_HEADER,
+	    &__wt_logdesc_rec_file_header, magic, version));
+}
+
+static inline int
+__wt_logrec_file_header_unpack(WT_SESSION_IMPL *session, const uint8_t **pp,
+    const uint8_t *end, uint32_t *magicp, uint32_t *versionp)
+{
+	return (__wt_log_unpack(session, pp, end, &__wt_logdesc_rec_file_header,
+	    magicp, versionp));
+}
+
+static inline int
+__wt_logrec_checkpoint_pack(WT_SESSION_IMPL *session, WT_ITEM *logrec,
+    uint32_t ckpt_file, uint64_t ckpt_offset)
+{
+	return (__wt_logrec_pack(session, logrec, WT_LOGREC_CHECKPOINT,
+	    &__wt_logdesc_rec_checkpoint, ckpt_file, ckpt_offset));
+}
+
+static inline int
+__wt_logrec_checkpoint_unpack(WT_SESSION_IMPL *session, const uint8_t **pp,
+    const uint8_t *end, uint32_t *ckpt_filep, uint64_t *ckpt_offsetp)
+{
+	return (__wt_log_unpack(session, pp, end, &__wt_logdesc_rec_checkpoint,
+	    ckpt_filep, ckpt_offsetp));
+}
+
+static inline int
+__wt_logrec_commit_pack(WT_SESSION_IMPL *session, WT_ITEM *logrec,
+    uint64_t txnid)
+{
+	return (__wt_logrec_pack(session, logrec, WT_LOGREC_COMMIT,
+	    &__wt_logdesc_rec_commit, txnid));
+}
+
+static inline int
+__wt_logrec_commit_unpack(WT_SESSION_IMPL *session, const uint8_t **pp,
+    const uint8_t *end, uint64_t *txnidp)
+{
+	return (__wt_log_unpack(session, pp, end, &__wt_logdesc_rec_commit,
+	    txnidp));
+}
+
+static inline int
+__wt_logrec_debug_pack(WT_SESSION_IMPL *session, WT_ITEM *logrec,
+    const char *message)
+{
+	return (__wt_logrec_pack(session, logrec, WT_LOGREC_DEBUG,
+	    &__wt_logdesc_rec_debug, message));
+}
+
+static inline int
+__wt_logrec_debug_unpack(WT_SESSION_IMPL *session, const uint8_t **pp,
+    const uint8_t *end, const char **messagep)
+{
+	return (__wt_log_unpack(session, pp, end, &__wt_logdesc_rec_debug,
+	    messagep));
+}
+
+static inline int
+__wt_logop_col_put_pack(WT_SESSION_IMPL *session, WT_ITEM *logrec,
+    const char *uri, uint64_t recno, WT_ITEM *value)
+{
+	return (__wt_logop_pack(session, logrec, WT_LOGOP_COL_PUT,
+	    &__wt_logdesc_op_col_put, uri, recno, value));
+}
+
+static inline int
+__wt_logop_col_put_unpack(WT_SESSION_IMPL *session, const uint8_t **pp,
+    const uint8_t *end, const char **urip, uint64_t *recnop, WT_ITEM *valuep)
+{
+	return (__wt_log_unpack(session, pp, end, &__wt_logdesc_op_col_put,
+	    urip, recnop, valuep));
+}
+
+static inline int
+__wt_logop_col_remove_pack(WT_SESSION_IMPL *session, WT_ITEM *logrec,
+    const char *uri, uint64_t recno)
+{
+	return (__wt_logop_pack(session, logrec, WT_LOGOP_COL_REMOVE,
+	    &__wt_logdesc_op_col_remove, uri, recno));
+}
+
+static inline int
+__wt_logop_col_remove_unpack(WT_SESSION_IMPL *session, const uint8_t **pp,
+    const uint8_t *end, const char **urip, uint64_t *recnop)
+{
+	return (__wt_log_unpack(session, pp, end, &__wt_logdesc_op_col_remove,
+	    urip, recnop));
+}
+
+static inline int
+__wt_logop_row_put_pack(WT_SESSION_IMPL *session, WT_ITEM *logrec,
+    const char *uri, WT_ITEM *key, WT_ITEM *value)
+{
+	return (__wt_logop_pack(session, logrec, WT_LOGOP_ROW_PUT,
+	    &__wt_logdesc_op_row_put, uri, key, value));
+}
+
+static inline int
+__wt_logop_row_put_unpack(WT_SESSION_IMPL *session, const uint8_t **pp,
+    const uint8_t *end, const char **urip, WT_ITEM *keyp, WT_ITEM *valuep)
+{
+	return (__wt_log_unpack(session, pp, end, &__wt_logdesc_op_row_put,
+	    urip, keyp, valuep));
+}
+
+static inline int
+__wt_logop_row_remove_pack(WT_SESSION_IMPL *session, WT_ITEM *logrec,
+    const char *uri, WT_ITEM *key)
+{
+	return (__wt_logop_pack(session, logrec, WT_LOGOP_ROW_REMOVE,
+	    &__wt_logdesc_op_row_remove, uri, key));
+}
+
 static inline int
-__wt_logput_debug(WT_SESSION_IMPL *session, const char * message)
+__wt_logop_row_remove_unpack(WT_SESSION_IMPL *session, const uint8_t **pp,
+    const uint8_t *end, const char **urip, WT_ITEM *keyp)
 {
-	return (__wt_log_put(session, &__wt_logdesc_debug, message));
+	return (__wt_log_unpack(session, pp, end, &__wt_logdesc_op_row_remove,
+	    urip, keyp));
 }
@@ -18,10 +18,15 @@ struct __wt_cursor_lsm {
 	int nchunks;
 	WT_BLOOM **blooms;
 	WT_CURSOR **cursors;
+	WT_LSM_CHUNK **chunks;		/* Chunks for key range checks */
 	WT_CURSOR *current;     	/* The current cursor for iteration */
+	int *heap;			/* Chunk cursors in iteration order */
+	int *heap_dup;			/* Heap slots on the current key */
 
 	WT_LSM_CHUNK *primary_chunk;	/* The current primary chunk. */
 
+	WT_ITEM batch_values;		/* Values returned by search_batch */
+
 #define	WT_CLSM_ITERATE_NEXT    0x01    /* Forward iteration */
 #define	WT_CLSM_ITERATE_PREV    0x02    /* Backward iteration */
 #define	WT_CLSM_MERGE           0x04    /* Merge cursor, don't update. */
@@ -39,12 +44,18 @@ struct __wt_cursor_lsm {
 struct __wt_lsm_chunk {
 	const char *uri;		/* Data source for this chunk. */
 	const char *bloom_uri;		/* URI of Bloom filter, if any. */
+	WT_BLOOM_MEM *bloom_mem;	/* In-memory Bloom filter, if loaded. */
+	WT_BLOOM *bloom_build;		/* Bloom filter filled in by writes. */
 	uint64_t count;			/* Approximate count of records. */
-	uint32_t generation;		/* Merge generation. */
+	uint64_t size;			/* Approximate size in bytes. */
+	uint32_t generation;		/* Merge generation, or level. */
+	WT_ITEM key_min, key_max;	/* Key range, if known. */
 
 	uint32_t ncursor;		/* Cursors with the chunk as primary. */
 #define	WT_LSM_CHUNK_ONDISK	0x01
 #define	WT_LSM_CHUNK_BLOOM	0x02
+#define	WT_LSM_CHUNK_MERGING	0x04
+#define	WT_LSM_CHUNK_RANGE	0x08
 	uint32_t flags;
 };
 
@@ -79,11 +90,13 @@ struct __wt_lsm_tree {
 #define	WT_LSM_BLOOM_OFF				0x00000004
 #define	WT_LSM_BLOOM_OLDEST				0x00000008
 	uint32_t bloom;			/* Bloom creation policy. */
-
-	WT_SESSION_IMPL *worker_session;/* Passed to thread_create */
-	pthread_t worker_tid;		/* LSM worker thread */
-	WT_SESSION_IMPL *ckpt_session;	/* For checkpoint worker */
-	pthread_t ckpt_tid;		/* LSM checkpoint worker thread */
+#define	WT_LSM_MERGE_LEVELED				0x00000001
+#define	WT_LSM_MERGE_TIERED				0x00000002
+	uint32_t merge_policy;		/* Merge policy. */
+	uint32_t throttle_chunks;	/* Unmerged chunks to slow writes */
+	uint32_t stall_chunks;		/* Unmerged chunks to stop writes */
+	uint64_t throttle_size;		/* Unmerged bytes to slow writes */
+	uint64_t stall_size;		/* Unmerged bytes to stop writes */
 
 	int nchunks;			/* Number of active chunks */
 	int last;			/* Last allocated ID. */
@@ -95,11 +108,126 @@ struct __wt_lsm_tree {
 	int nold_chunks;		/* Number of old chunks */
 	int old_avail;			/* Available old chunk slots */
 
+	volatile uint32_t flush_threads;/* Flush workers using the tree */
+	uint64_t merge_progress;	/* Time of the last merge progress */
+	uint64_t merge_idle;		/* Time the merge workers went idle */
+	uint64_t merge_idle_gen;	/* Disk generation when idle */
+
+	uint32_t unmerged_chunks;	/* Chunks waiting to be merged */
+	uint64_t unmerged_size;		/* Bytes waiting to be merged */
+	volatile uint64_t throttle_sleep;/* Delay per write, microseconds */
+	volatile int throttle_stall;	/* Writes wait for merges */
+
 #define	WT_LSM_TREE_WORKING	0x01
 #define	WT_LSM_TREE_OPEN	0x02
 	uint32_t flags;
 };
 
+/*
+ * WT_LSM_CMP --
+ *	Compare two keys using the tree's collator.
+ */
+#define	WT_LSM_CMP(s, lsm_tree, k1, k2, cmp)				\
+	(((lsm_tree)->collator == NULL) ?				\
+	(((cmp) = __wt_btree_lex_compare((k1), (k2))), 0) :		\
+	(lsm_tree)->collator->compare((lsm_tree)->collator,		\
+	    &(s)->iface, (k1), (k2), &(cmp)))
+
+/*
+ * WT_LSM_LEVEL_FANOUT --
+ *	With the leveled merge policy, the number of chunks each level of the
+ * tree holds before chunks are merged into the next level is this constant
+ * raised to the power of the level.
+ */
+#define	WT_LSM_LEVEL_FANOUT	10
+
+/*
+ * WT_LSM_MERGE_DICTIONARY --
+ *	The number of values remembered in the value dictionary of a chunk
+ * written by a merge, unless the tree's configuration sets a size.
+ */
+#define	WT_LSM_MERGE_DICTIONARY	100
+
+/*
+ * WT_LSM_THROTTLE_MAX --
+ *	The delay added to each write to an LSM tree, in microseconds, as the
+ * chunks waiting to be merged approach the tree's limit for stopping writes.
+ */
+#define	WT_LSM_THROTTLE_MAX	1000
+
+/*
+ * WT_LSM_WORKER_RUN --
+ *	Whether work in a tree should continue: a tree being closed, or the
+ * connection's pool of workers (WT_CONN_LSM_WORKERS for merges,
+ * WT_CONN_LSM_FLUSHERS for flushes) shutting down, abandons work in progress.
+ */
+#define	WT_LSM_WORKER_RUN(session, lsm_tree, pool)			\
+	(F_ISSET(S2C(session), pool) &&					\
+	F_ISSET(lsm_tree, WT_LSM_TREE_WORKING))
+#define	WT_LSM_MERGE_RUN(session, lsm_tree)				\
+	WT_LSM_WORKER_RUN(session, lsm_tree, WT_CONN_LSM_WORKERS)
+
+/*
+ * WT_LSM_WITH_SCHEMA_LOCK --
+ *	Acquire the schema lock for a worker in one of the connection's pools
+ * and perform an operation.  Closing a tree holds the schema lock while it
+ * waits for the workers to leave the tree, so the workers can't block on the
+ * lock: they give up with EINTR if the tree stops working.
+ */
+#define	WT_LSM_WITH_SCHEMA_LOCK(session, lsm_tree, pool, ret, op) do {	\
+	if (((ret) =							\
+	    __wt_lsm_schema_lock(session, lsm_tree, pool)) == 0) {	\
+		(op);							\
+		F_CLR(session, WT_SESSION_SCHEMA_LOCKED);		\
+		__wt_spin_unlock(session, &S2C(session)->schema_lock);	\
+	}								\
+} while (0)
+
+/*
+ * WT_LSM_RANGE --
+ *	The range of keys held by a set of chunks.
+ */
+struct __wt_lsm_range {
+	WT_ITEM *min, *max;		/* Bounds, NULL if unbounded */
+	int empty;			/* No keys */
+};
+
+/*
+ * WT_LSM_OLDER --
+ *	What a minor merge knows about a chunk older than the chunks it merges:
+ * a deleted record can only be dropped if no older chunk could hold its key.
+ */
+struct __wt_lsm_older {
+	WT_ITEM key_min, key_max;	/* Key range, if known */
+	int range;			/* Key range is known */
+	char *bloom_uri;		/* Bloom filter URI, if any */
+	WT_BLOOM *bloom;		/* Bloom filter, if open */
+};
+
+/*
+ * WT_LSM_WORKER --
+ *	A thread in one of the connection's pools of LSM workers.
+ */
+struct __wt_lsm_worker {
+	WT_SESSION_IMPL *session;	/* Worker's session */
+	pthread_t	 tid;		/* Worker's thread */
+	u_int		 id;		/* Worker's number */
+
+	uint64_t	 flushes;	/* Chunks flushed */
+	uint64_t	 merges;	/* Merges completed */
+};
+
+/*
+ * WT_LSM_FLUSH_UNIT --
+ *	A chunk that has become read-only, waiting in the connection's queue
+ * to be written to disk by the LSM flush workers.
+ */
+struct __wt_lsm_flush_unit {
+	WT_LSM_TREE *lsm_tree;		/* Tree the chunk belongs to */
+	WT_LSM_CHUNK *chunk;		/* Chunk to flush */
+	TAILQ_ENTRY(__wt_lsm_flush_unit) q;
+};
+
 /*
  * WT_LSM_DATA_SOURCE --
  *	Implementation of the WT_DATA_SOURCE interface for LSM.
@@ -109,13 +237,3 @@ struct __wt_lsm_data_source {
 
 	WT_RWLOCK *rwlock;
 };
-
-/*
- * WT_LSM_WORKER_COOKIE --
- *	State for an LSM worker thread.
- */
-struct __wt_lsm_worker_cookie {
-    WT_LSM_CHUNK **chunk_array;
-    size_t chunk_alloc;
-    int nchunks;
-};
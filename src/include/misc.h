@@ -15,6 +15,13 @@
 #define	WT_TERABYTE	(1099511627776)
 #define	WT_PETABYTE	(1125899906842624)
 
+#define	WT_CACHE_LINE_ALIGNMENT	64	/* Cache line size, in bytes */
+
+/* Elapsed time between two struct timespec values, in nanoseconds. */
+#define	WT_TIMEDIFF(end, begin)						\
+	((uint64_t)((end).tv_sec - (begin).tv_sec) * WT_BILLION +	\
+	(uint64_t)(end).tv_nsec - (uint64_t)(begin).tv_nsec)
+
 /*
  * Sizes that cannot be larger than 2**32 are stored in uint32_t fields in
  * common structures to save space.  To minimize conversions from size_t to
@@ -178,6 +185,7 @@
 #define	WT_TREE_DISCARD	0x02			/* Discarding */
 #define	WT_TREE_EVICT	0x04			/* Eviction */
 #define	WT_TREE_PREV	0x08			/* Backward walk */
+#define	WT_TREE_READ_AHEAD	0x10		/* Read ahead of a scan */
 
 /*
  * In diagnostic mode we track the locations from which hazard references and
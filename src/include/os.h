@@ -36,6 +36,146 @@ struct __wt_fh {
 
 	char	*name;				/* File name */
 	int	fd;				/* POSIX file handle */
+	int	direct_io;			/* O_DIRECT */
 
 	u_int	refcnt;				/* Reference count */
 };
+
+/*
+ * WT_IO_ALIGNED --
+ *	Direct I/O transfers must be aligned in memory and in the file to the
+ * connection's buffer alignment.
+ */
+#define	WT_IO_ALIGNED(session, fh, offset, bytes, buf)			\
+	(!(fh)->direct_io ||						\
+	((uintptr_t)(buf) | (uintptr_t)(offset) | (uintptr_t)(bytes)) %	\
+	S2C(session)->buffer_alignment == 0)
+
+/*
+ * WT_IO_REQ --
+ *	A read or write in a batch of file I/O requests.
+ */
+struct __wt_io_req {
+	WT_FH	*fh;				/* File handle */
+	off_t	 offset;			/* File offset */
+	uint32_t bytes;				/* Bytes to transfer */
+	void	*buf;				/* Memory buffer */
+};
+
+/*
+ * WT_IO_RUN --
+ *	Requests in a batch that address adjacent bytes of the same file and
+ * are transferred by a single system call.
+ */
+struct __wt_io_run {
+	WT_FH	*fh;				/* File handle */
+	off_t	 offset;			/* File offset */
+	size_t	 bytes;				/* Total bytes */
+	struct iovec *iov;			/* Memory buffers */
+	int	 iovcnt;
+	int	 write;				/* Write, else read */
+	int	 error;				/* Error, if any */
+
+	WT_IO_SESSION *io;			/* Owning session's state */
+	TAILQ_ENTRY(__wt_io_run) q;		/* I/O thread queue */
+};
+
+/*
+ * WT_IO_IOV_MAX --
+ *	The most requests merged into a single system call.
+ */
+#define	WT_IO_IOV_MAX		64
+
+/*
+ * WT_IO_URING_ENTRIES --
+ *	The submission queue size of a session's io_uring.
+ */
+#define	WT_IO_URING_ENTRIES	32
+
+/*
+ * WT_IO_URING --
+ *	A Linux io_uring: the submission and completion queues are shared with
+ * the kernel.
+ */
+struct __wt_io_uring {
+	int	 fd;				/* Ring file descriptor */
+
+	void	*sq_mem, *cq_mem, *sqes;	/* Mapped regions */
+	size_t	 sq_len, cq_len, sqes_len;
+
+	volatile uint32_t *sq_head, *sq_tail;	/* Submission queue */
+	uint32_t *sq_array;
+	uint32_t  sq_mask, sq_entries;
+
+	volatile uint32_t *cq_head, *cq_tail;	/* Completion queue */
+	void	 *cqes;
+	uint32_t  cq_mask;
+};
+
+/*
+ * WT_IO_SESSION --
+ *	A session's batched I/O state, allocated on first use.
+ */
+struct __wt_io_session {
+	WT_IO_REQ **sorted;			/* Requests in file order */
+	WT_IO_RUN  *runs;			/* Merged requests */
+	struct iovec *iov;			/* Memory for the runs */
+	size_t	    sorted_alloc, runs_alloc, iov_alloc;
+
+	WT_CONDVAR *cond;			/* I/O threads finished */
+	uint32_t    pending;			/* Locked: runs not finished */
+
+	WT_IO_URING *ring;			/* io_uring, if configured */
+};
+
+/*
+ * WT_IO_WORKER --
+ *	A thread in the connection's pool of I/O threads.
+ */
+struct __wt_io_worker {
+	WT_SESSION_IMPL *session;		/* Worker's session */
+	pthread_t	 tid;			/* Worker's thread */
+	WT_CONDVAR	*cond;			/* Worker's wakeup */
+	u_int		 id;			/* Worker's number */
+
+	uint64_t	 runs;			/* System calls issued */
+};
+
+/*
+ * WT_IO_POOL --
+ *	The connection's pool of I/O threads, serving batched I/O for the
+ * threads backend.
+ */
+struct __wt_io_pool {
+	WT_SPINLOCK	 lock;			/* Queue spinlock */
+	WT_IO_WORKER	*workers;		/* I/O threads */
+	u_int		 nworkers;
+	u_int		 next;			/* Next worker to wake */
+
+					/* Locked: runs to issue */
+	TAILQ_HEAD(__wt_io_qh, __wt_io_run) qh;
+};
+
+/* Batched I/O backends. */
+#define	WT_IO_BACKEND_SYNC	0		/* Calling thread */
+#define	WT_IO_BACKEND_THREADS	1		/* Pool of I/O threads */
+#define	WT_IO_BACKEND_URING	2		/* Linux io_uring */
+
+/*
+ * WT_IOBUF_POOL --
+ *	The connection's pool of aligned I/O buffers: pages read from disk take
+ * their buffers from the pool, and return them when the page is discarded.
+ * Buffer sizes are rounded up to a size class, a quarter step between powers
+ * of two, each class with its own free list.
+ */
+#define	WT_IOBUF_MIN_SHIFT	12		/* Smallest class, 4KB */
+#define	WT_IOBUF_MAX_SHIFT	21		/* Largest class, 2MB */
+#define	WT_IOBUF_SLOTS							\
+	(1 + 4 * (WT_IOBUF_MAX_SHIFT - WT_IOBUF_MIN_SHIFT))
+struct __wt_iobuf_pool {
+	WT_SPINLOCK lock;			/* Free list spinlock */
+
+	void	*free[WT_IOBUF_SLOTS];		/* Free buffers per class */
+	uint64_t bytes;				/* Bytes on the free lists */
+	uint64_t bytes_max;			/* Free list limit */
+};
@@ -65,9 +65,9 @@ __wt_col_append_serial(
 
 	args->skipdepth = skipdepth;
 
-	__wt_spin_lock(session, &S2C(session)->serial_lock);
+	__wt_spin_lock(session, &page->modify->serial_lock);
 	ret = __wt_col_append_serial_func(session, args);
-	__wt_spin_unlock(session, &S2C(session)->serial_lock);
+	__wt_spin_unlock(session, &page->modify->serial_lock);
 
 	if (!args->new_inslist_taken)
 		__wt_free(session, args->new_inslist);
@@ -135,7 +135,6 @@ __wt_col_append_new_ins_taken(
 
 typedef struct {
 	WT_PAGE *page;
-	uint32_t write_gen;
 	WT_INSERT_HEAD **inshead;
 	WT_INSERT ***ins_stack;
 	WT_INSERT_HEAD **new_inslist;
@@ -152,19 +151,17 @@ typedef struct {
 
 static inline int
 __wt_insert_serial(
-	WT_SESSION_IMPL *session, WT_PAGE *page, uint32_t write_gen,
-	WT_INSERT_HEAD **inshead, WT_INSERT ***ins_stack, WT_INSERT_HEAD
-	***new_inslistp, size_t new_inslist_size, WT_INSERT_HEAD
-	**new_insheadp, size_t new_inshead_size, WT_INSERT **new_insp, size_t
-	new_ins_size, u_int skipdepth)
+	WT_SESSION_IMPL *session, WT_PAGE *page, WT_INSERT_HEAD **inshead,
+	WT_INSERT ***ins_stack, WT_INSERT_HEAD ***new_inslistp, size_t
+	new_inslist_size, WT_INSERT_HEAD **new_insheadp, size_t
+	new_inshead_size, WT_INSERT **new_insp, size_t new_ins_size, u_int
+	skipdepth)
 {
 	__wt_insert_args _args, *args = &_args;
 	WT_DECL_RET;
 
 	args->page = page;
 
-	args->write_gen = write_gen;
-
 	args->inshead = inshead;
 
 	args->ins_stack = ins_stack;
@@ -198,9 +195,9 @@ __wt_insert_serial(
 
 	args->skipdepth = skipdepth;
 
-	__wt_spin_lock(session, &S2C(session)->serial_lock);
+	__wt_spin_lock(session, &page->modify->serial_lock);
 	ret = __wt_insert_serial_func(session, args);
-	__wt_spin_unlock(session, &S2C(session)->serial_lock);
+	__wt_spin_unlock(session, &page->modify->serial_lock);
 
 	if (!args->new_inslist_taken)
 		__wt_free(session, args->new_inslist);
@@ -213,15 +210,14 @@ __wt_insert_serial(
 
 static inline void
 __wt_insert_unpack(
-    void *untyped_args, WT_PAGE **pagep, uint32_t *write_genp,
-    WT_INSERT_HEAD ***insheadp, WT_INSERT ****ins_stackp, WT_INSERT_HEAD
-    ***new_inslistp, WT_INSERT_HEAD **new_insheadp, WT_INSERT **new_insp,
-    u_int *skipdepthp)
+    void *untyped_args, WT_PAGE **pagep, WT_INSERT_HEAD ***insheadp,
+    WT_INSERT ****ins_stackp, WT_INSERT_HEAD ***new_inslistp,
+    WT_INSERT_HEAD **new_insheadp, WT_INSERT **new_insp, u_int
+    *skipdepthp)
 {
 	__wt_insert_args *args = (__wt_insert_args *)untyped_args;
 
 	*pagep = args->page;
-	*write_genp = args->write_gen;
 	*insheadp = args->inshead;
 	*ins_stackp = args->ins_stack;
 	*new_inslistp = args->new_inslist;
@@ -266,45 +262,6 @@ __wt_insert_new_ins_taken(
 	__wt_cache_page_inmem_incr(session, page, args->new_ins_size);
 }
 
-typedef struct {
-	WT_PAGE *page;
-	WT_ROW *row_arg;
-	WT_IKEY *ikey;
-} __wt_row_key_args;
-
-static inline int
-__wt_row_key_serial(
-	WT_SESSION_IMPL *session, WT_PAGE *page, WT_ROW *row_arg, WT_IKEY
-	*ikey)
-{
-	__wt_row_key_args _args, *args = &_args;
-	WT_DECL_RET;
-
-	args->page = page;
-
-	args->row_arg = row_arg;
-
-	args->ikey = ikey;
-
-	__wt_spin_lock(session, &S2C(session)->serial_lock);
-	ret = __wt_row_key_serial_func(session, args);
-	__wt_spin_unlock(session, &S2C(session)->serial_lock);
-
-	return (ret);
-}
-
-static inline void
-__wt_row_key_unpack(
-    void *untyped_args, WT_PAGE **pagep, WT_ROW **row_argp, WT_IKEY
-    **ikeyp)
-{
-	__wt_row_key_args *args = (__wt_row_key_args *)untyped_args;
-
-	*pagep = args->page;
-	*row_argp = args->row_arg;
-	*ikeyp = args->ikey;
-}
-
 typedef struct {
 	int syncop;
 } __wt_sync_file_args;
@@ -382,9 +339,9 @@ __wt_update_serial(
 
 	args->upd_obsolete = upd_obsolete;
 
-	__wt_spin_lock(session, &S2C(session)->serial_lock);
+	__wt_spin_lock(session, &page->modify->serial_lock);
 	ret = __wt_update_serial_func(session, args);
-	__wt_spin_unlock(session, &S2C(session)->serial_lock);
+	__wt_spin_unlock(session, &page->modify->serial_lock);
 
 	if (!args->new_upd_taken)
 		__wt_free(session, args->new_upd);
@@ -39,6 +39,8 @@ struct __wt_stats {
 
 #define	WT_CSTAT_INCR(session, fld)					\
 	WT_STAT_INCR(S2C(session)->stats, fld)
+#define	WT_CSTAT_INCRV(session, fld, v)					\
+	WT_STAT_INCRV(S2C(session)->stats, fld, v)
 
 /* Flags used by statistics initialization. */
 #define	WT_STATISTICS_CLEAR	0x01
@@ -69,10 +71,14 @@ struct __wt_btree_stats {
 	WT_STATS alloc;
 	WT_STATS extend;
 	WT_STATS free;
+	WT_STATS file_bytes_inuse;
+	WT_STATS file_bytes_dirty;
 	WT_STATS overflow_read;
 	WT_STATS overflow_value_cache;
 	WT_STATS page_evict;
+	WT_STATS page_evict_queued;
 	WT_STATS page_read;
+	WT_STATS page_write_staged;
 	WT_STATS page_evict_fail;
 	WT_STATS page_write;
 	WT_STATS file_size;
@@ -98,6 +104,7 @@ struct __wt_btree_stats {
 	WT_STATS rec_hazard;
 	WT_STATS file_row_int_pages;
 	WT_STATS file_row_leaf_pages;
+	WT_STATS file_insert_retries;
 	WT_STATS file_entries;
 	WT_STATS update_conflict;
 	WT_STATS file_write_conflicts;
@@ -107,20 +114,40 @@ struct __wt_btree_stats {
  * Statistics entries for CONNECTION handle.
  */
 struct __wt_connection_stats {
-	WT_STATS txn_ancient;
+	WT_STATS io_batch;
+	WT_STATS iobuf_alloc;
+	WT_STATS iobuf_reuse;
+	WT_STATS io_batch_calls;
 	WT_STATS block_read;
 	WT_STATS block_write;
 	WT_STATS cache_bytes_inuse;
+	WT_STATS cache_bytes_bloom;
+	WT_STATS cache_evict_worker_bytes;
+	WT_STATS cache_evict_lock_wait;
+	WT_STATS cache_evict_dirty;
+	WT_STATS cache_evict_tree_hot;
+	WT_STATS cache_evict_tree_supply;
+	WT_STATS cache_evict_tree_walk;
 	WT_STATS cache_evict_slow;
+	WT_STATS cache_evict_worker_usecs;
 	WT_STATS cache_evict_internal;
 	WT_STATS cache_bytes_max;
 	WT_STATS cache_evict_modified;
 	WT_STATS cache_pages_inuse;
+	WT_STATS cache_evict_worker_pages;
+	WT_STATS cache_read_ahead;
 	WT_STATS cache_evict_hazard;
+	WT_STATS cache_read_ahead_wasted;
+	WT_STATS cache_read_ahead_hit;
+	WT_STATS cache_bytes_dirty;
 	WT_STATS cache_evict_unmodified;
 	WT_STATS checkpoint;
 	WT_STATS cond_wait;
 	WT_STATS file_open;
+	WT_STATS log_bytes_written;
+	WT_STATS log_records;
+	WT_STATS log_syncs;
+	WT_STATS log_writes;
 	WT_STATS rwlock_rdlock;
 	WT_STATS rwlock_wrlock;
 	WT_STATS memalloc;
@@ -133,10 +160,20 @@ struct __wt_connection_stats {
 	WT_STATS txn_rollback;
 };
 
+/*
+ * Statistics entries for EVICT_WORKER handle.
+ */
+struct __wt_evict_worker_stats {
+	WT_STATS bytes_write;
+	WT_STATS pages_evict;
+	WT_STATS rec_usecs;
+};
+
 /*
  * Statistics entries for LSM handle.
  */
 struct __wt_lsm_stats {
+	WT_STATS write_throttle_delay;
 	WT_STATS generation_max;
 	WT_STATS bloom_false_positives;
 	WT_STATS bloom_hits;
@@ -144,7 +181,11 @@ struct __wt_lsm_stats {
 	WT_STATS bloom_count;
 	WT_STATS bloom_cache_evict;
 	WT_STATS bloom_cache_read;
+	WT_STATS search_range_skips;
 	WT_STATS chunk_count;
+	WT_STATS unmerged_chunks;
+	WT_STATS merge_tombstones;
+	WT_STATS merge_count;
 	WT_STATS chunk_cache_evict;
 	WT_STATS cache_evict;
 	WT_STATS chunk_cache_read;
@@ -152,7 +193,14 @@ struct __wt_lsm_stats {
 	WT_STATS cache_evict_fail;
 	WT_STATS cache_write;
 	WT_STATS search_miss_no_bloom;
+	WT_STATS merge_rows;
+	WT_STATS write_throttle;
+	WT_STATS write_stall;
+	WT_STATS unmerged_size;
+	WT_STATS merge_usecs;
+	WT_STATS write_throttle_usecs;
 	WT_STATS bloom_space;
+	WT_STATS write_stalled;
 };
 
 /* Statistics section: END */
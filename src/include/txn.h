@@ -6,49 +6,40 @@
  */
 
 /*
- * Transaction ID type: transaction IDs are 32-bit integers that wrap after
- * 4 billion transactions are executed.
- */
-typedef uint32_t wt_txnid_t;
-
-#define	WT_TXN_NONE	0		/* No txn running in a session. */
-#define	WT_TXN_ABORTED	UINT32_MAX	/* Update rolled back, ignore. */
-
-/*
- * Transaction ID comparison dealing with edge cases and wrapping.
+ * Transaction ID type: transaction IDs are 64-bit integers, they don't wrap
+ * in the lifetime of a database, so IDs are compared as plain integers.
  *
  * WT_TXN_ABORTED is the largest possible ID (never visible to a running
  * transaction), WT_TXN_NONE is smaller than any possible ID (visible to all
  * running transactions).
- *
- * Otherwise, we deal with 32-bit wrapping by looking at the difference between
- * the two IDs.  In what follows, "small" means less than 2^31 and "large"
- * means greater than 2^31.
- *
- * If t2 > t1 and neither has wrapped, then (t2 - t1) is small.  It is
- * certainly smaller than t2, and we assume that we never compare IDs that
- * differ by more than 2^31.  If t2 has wrapped (so it is small) and t1 is
- * large, then (t2 - t1) = (t2 + (-t1)) will be small.
- *
- * In effect, we have a 31-bit window of active transaction IDs: if an update
- * remains in the system after 2 billion transactions it can no longer be
- * compared with current transaction ID.
  */
-#define	TXNID_LE(t1, t2)						\
-	(((t1) == WT_TXN_ABORTED || (t2) == WT_TXN_NONE) ? 0 :		\
-	 ((t1) == WT_TXN_NONE || (t2) == WT_TXN_ABORTED) ? 1 :		\
-	 (t2) - (t1) < (UINT32_MAX / 2))
+typedef uint64_t wt_txnid_t;
 
-#define	TXNID_LT(t1, t2)						\
-	((t1) != (t2) && TXNID_LE(t1, t2))
+#define	WT_TXN_NONE	0		/* No txn running in a session. */
+#define	WT_TXN_ABORTED	UINT64_MAX	/* Update rolled back, ignore. */
 
+/*
+ * Each session's transaction state is written by the session and read by
+ * every snapshot scan: pad the states so sessions don't share cache lines.
+ */
 struct __wt_txn_state {
 	volatile wt_txnid_t id;
 	volatile wt_txnid_t snap_min;
+
+	uint8_t pad[WT_CACHE_LINE_ALIGNMENT - 2 * sizeof(wt_txnid_t)];
 };
 
 struct __wt_txn_global {
 	volatile wt_txnid_t current;	/* Current transaction ID. */
+
+	/*
+	 * The oldest ID any running transaction may need: updates older than
+	 * this are visible to all transactions.  Cached so most snapshots can
+	 * avoid calculating it, and only moved forward by a full scan of the
+	 * states, see __wt_txn_update_oldest.
+	 */
+	volatile wt_txnid_t oldest_id;
+
 	WT_TXN_STATE *states;		/* Per-session transaction states */
 };
 
@@ -58,10 +49,19 @@ enum __wt_txn_isolation {
 	TXN_ISO_SNAPSHOT
 };
 
+/* Commit durability, the "sync" configuration to begin_transaction. */
+enum __wt_txn_sync {
+	TXN_SYNC_NONE,			/* Don't log the transaction */
+	TXN_SYNC_WRITE,			/* Copy into the log buffer */
+	TXN_SYNC_FLUSH,			/* Write the log buffer to the OS */
+	TXN_SYNC_FULL			/* Write and flush to stable storage */
+};
+
 struct __wt_txn {
 	wt_txnid_t id;
 
 	WT_TXN_ISOLATION isolation;
+	WT_TXN_SYNC sync;
 
 	/*
 	 * Snapshot data:
@@ -80,10 +80,10 @@ struct __wt_txn {
 	wt_txnid_t oldest_snap_min;
 
 	/*
-	 * Arrays of txn IDs in WT_UPDATE or WT_REF structures created or
-	 * modified by this transaction.
+	 * Arrays of WT_UPDATE or WT_REF structures created or modified by
+	 * this transaction.
 	 */
-	wt_txnid_t    **mod;
+	WT_UPDATE     **mod;
 	size_t		mod_alloc;
 	u_int		mod_count;
 
@@ -91,6 +91,11 @@ struct __wt_txn {
 	size_t		modref_alloc;
 	u_int		modref_count;
 
+	/*
+	 * Log record for the transaction's updates, written when it commits.
+	 */
+	WT_ITEM		logrec;
+
 	/*
 	 * Count of unsuccessful eviction attempts, used to abort if the cache
 	 * is full and no progress can be made.
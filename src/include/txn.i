@@ -13,7 +13,7 @@ static inline void __wt_txn_read_last(WT_SESSION_IMPL *session);
  *	Mark a WT_UPDATE object modified by the current transaction.
  */
 static inline int
-__wt_txn_modify(WT_SESSION_IMPL *session, wt_txnid_t *id)
+__wt_txn_modify(WT_SESSION_IMPL *session, WT_UPDATE *upd)
 {
 	WT_TXN *txn;
 
@@ -22,13 +22,13 @@ __wt_txn_modify(WT_SESSION_IMPL *session, wt_txnid_t *id)
 
 	txn = &session->txn;
 	WT_ASSERT(session, F_ISSET(txn, TXN_RUNNING));
-	if (txn->mod_count * sizeof(wt_txnid_t *) == txn->mod_alloc)
+	if (txn->mod_count * sizeof(WT_UPDATE *) == txn->mod_alloc)
 		WT_RET(__wt_realloc(session, &txn->mod_alloc,
 		    WT_MAX(10, 2 * txn->mod_count) *
-		    sizeof(wt_txnid_t *), &txn->mod));
+		    sizeof(WT_UPDATE *), &txn->mod));
 
-	txn->mod[txn->mod_count++] = id;
-	*id = txn->id;
+	txn->mod[txn->mod_count++] = upd;
+	upd->txnid = txn->id;
 	return (0);
 }
 
@@ -123,9 +123,9 @@ __wt_txn_visible(WT_SESSION_IMPL *session, wt_txnid_t id)
 	 * saw when taking the snapshot should be invisible, even if the
 	 * snapshot is empty.
 	 */
-	if (TXNID_LT(txn->snap_max, id))
+	if (txn->snap_max < id)
 		return (0);
-	if (txn->snapshot_count == 0 || TXNID_LT(id, txn->snap_min))
+	if (txn->snapshot_count == 0 || id < txn->snap_min)
 		return (1);
 
 	return (bsearch(&id, txn->snapshot, txn->snapshot_count,
@@ -143,7 +143,7 @@ __wt_txn_visible_all(WT_SESSION_IMPL *session, wt_txnid_t id)
 	WT_TXN *txn;
 
 	txn = &session->txn;
-	return (TXNID_LT(id, txn->oldest_snap_min));
+	return (id < txn->oldest_snap_min);
 }
 
 /*
@@ -198,38 +198,6 @@ __wt_txn_update_check(WT_SESSION_IMPL *session, WT_UPDATE *upd)
 	return (0);
 }
 
-/*
- * __wt_txn_ancient --
- *	Check if a given transaction ID is "ancient".
- *
- *	Transaction IDs are 32 bit integers, and we use a 31 bit window when
- *	comparing them (in TXNID_LT).  As a result, updates from a transaction
- *	more than 2 billion transactions older than the current ID appear to be
- *	in the future and are no longer be visible to running transactions.
- *
- *	Call an update "ancient" if it will become invisible in under a million
- *	transactions, to give eviction time to write it.  Eviction is forced on
- *	pages with ancient transactions before they can be read.
- */
-static inline int
-__wt_txn_ancient(WT_SESSION_IMPL *session, wt_txnid_t id)
-{
-	WT_TXN_GLOBAL *txn_global;
-	wt_txnid_t current;
-
-	txn_global = &S2C(session)->txn_global;
-	current = txn_global->current;
-
-#define	TXN_WRAP_BUFFER	1000000
-#define	TXN_WINDOW	((UINT32_MAX / 2) - TXN_WRAP_BUFFER)
-
-	if (id != WT_TXN_NONE && TXNID_LT(id, current - TXN_WINDOW)) {
-		WT_CSTAT_INCR(session, txn_ancient);
-		return (1);
-	}
-	return (0);
-}
-
 /*
  * __wt_txn_autocommit_check --
  *	If an auto-commit transaction is required, start one.
@@ -46,6 +46,12 @@ __wt_verify_build(void)
 	/* On-disk structures should not be padded. */
 	SIZE_CHECK(WT_BLOCK_DESC, WT_BLOCK_DESC_SIZE);
 
+	/* In-memory updates are packed to save cache space. */
+	SIZE_CHECK(WT_UPDATE, WT_UPDATE_SIZE);
+
+	/* Transaction states are padded to avoid sharing cache lines. */
+	SIZE_CHECK(WT_TXN_STATE, WT_CACHE_LINE_ALIGNMENT);
+
 	/*
 	 * We mix-and-match 32-bit unsigned values and size_t's, mostly because
 	 * we allocate and handle 32-bit objects, and lots of the underlying C
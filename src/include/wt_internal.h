@@ -23,6 +23,7 @@ extern "C" {
 #include <sys/uio.h>
 
 #include <ctype.h>
+#include <dirent.h>
 #include <dlfcn.h>
 #include <errno.h>
 #include <fcntl.h>
@@ -47,6 +48,8 @@ enum __wt_page_state;
     typedef enum __wt_page_state WT_PAGE_STATE;
 enum __wt_txn_isolation;
     typedef enum __wt_txn_isolation WT_TXN_ISOLATION;
+enum __wt_txn_sync;
+    typedef enum __wt_txn_sync WT_TXN_SYNC;
 struct __wt_addr;
     typedef struct __wt_addr WT_ADDR;
 struct __wt_block;
@@ -57,8 +60,14 @@ struct __wt_block_desc;
     typedef struct __wt_block_desc WT_BLOCK_DESC;
 struct __wt_block_header;
     typedef struct __wt_block_header WT_BLOCK_HEADER;
+struct __wt_block_stage;
+    typedef struct __wt_block_stage WT_BLOCK_STAGE;
 struct __wt_bloom;
     typedef struct __wt_bloom WT_BLOOM;
+struct __wt_bloom_hash;
+    typedef struct __wt_bloom_hash WT_BLOOM_HASH;
+struct __wt_bloom_mem;
+    typedef struct __wt_bloom_mem WT_BLOOM_MEM;
 struct __wt_btree;
     typedef struct __wt_btree WT_BTREE;
 struct __wt_btree_session;
@@ -113,6 +122,10 @@ struct __wt_dlh;
     typedef struct __wt_dlh WT_DLH;
 struct __wt_evict_entry;
     typedef struct __wt_evict_entry WT_EVICT_ENTRY;
+struct __wt_evict_worker;
+    typedef struct __wt_evict_worker WT_EVICT_WORKER;
+struct __wt_evict_worker_stats;
+    typedef struct __wt_evict_worker_stats WT_EVICT_WORKER_STATS;
 struct __wt_ext;
     typedef struct __wt_ext WT_EXT;
 struct __wt_extlist;
@@ -129,16 +142,44 @@ struct __wt_insert;
     typedef struct __wt_insert WT_INSERT;
 struct __wt_insert_head;
     typedef struct __wt_insert_head WT_INSERT_HEAD;
+struct __wt_io_pool;
+    typedef struct __wt_io_pool WT_IO_POOL;
+struct __wt_io_req;
+    typedef struct __wt_io_req WT_IO_REQ;
+struct __wt_io_run;
+    typedef struct __wt_io_run WT_IO_RUN;
+struct __wt_io_session;
+    typedef struct __wt_io_session WT_IO_SESSION;
+struct __wt_io_uring;
+    typedef struct __wt_io_uring WT_IO_URING;
+struct __wt_io_worker;
+    typedef struct __wt_io_worker WT_IO_WORKER;
+struct __wt_iobuf_pool;
+    typedef struct __wt_iobuf_pool WT_IOBUF_POOL;
+struct __wt_log;
+    typedef struct __wt_log WT_LOG;
+struct __wt_log_record;
+    typedef struct __wt_log_record WT_LOG_RECORD;
+struct __wt_logrec_desc;
+    typedef struct __wt_logrec_desc WT_LOGREC_DESC;
 struct __wt_lsm_chunk;
     typedef struct __wt_lsm_chunk WT_LSM_CHUNK;
 struct __wt_lsm_data_source;
     typedef struct __wt_lsm_data_source WT_LSM_DATA_SOURCE;
+struct __wt_lsm_flush_unit;
+    typedef struct __wt_lsm_flush_unit WT_LSM_FLUSH_UNIT;
+struct __wt_lsm_older;
+    typedef struct __wt_lsm_older WT_LSM_OLDER;
+struct __wt_lsm_range;
+    typedef struct __wt_lsm_range WT_LSM_RANGE;
 struct __wt_lsm_stats;
     typedef struct __wt_lsm_stats WT_LSM_STATS;
 struct __wt_lsm_tree;
     typedef struct __wt_lsm_tree WT_LSM_TREE;
-struct __wt_lsm_worker_cookie;
-    typedef struct __wt_lsm_worker_cookie WT_LSM_WORKER_COOKIE;
+struct __wt_lsm_worker;
+    typedef struct __wt_lsm_worker WT_LSM_WORKER;
+struct __wt_lsn;
+    typedef struct __wt_lsn WT_LSN;
 struct __wt_named_collator;
     typedef struct __wt_named_collator WT_NAMED_COLLATOR;
 struct __wt_named_compressor;
@@ -155,6 +196,10 @@ struct __wt_page_track;
     typedef struct __wt_page_track WT_PAGE_TRACK;
 struct __wt_process;
     typedef struct __wt_process WT_PROCESS;
+struct __wt_read_ahead_unit;
+    typedef struct __wt_read_ahead_unit WT_READ_AHEAD_UNIT;
+struct __wt_read_ahead_worker;
+    typedef struct __wt_read_ahead_worker WT_READ_AHEAD_WORKER;
 struct __wt_ref;
     typedef struct __wt_ref WT_REF;
 struct __wt_row;
@@ -195,6 +240,7 @@ struct __wt_update;
 #include "txn.h"
 
 #include "block.h"
+#include "bloom.h"
 #include "btmem.h"
 #include "btree.h"
 #include "cache.h"
@@ -221,13 +267,15 @@ struct __wt_update;
 /* Required by cursor.i */
 #include "txn.i"
 
+/* Required by btree.i */
+#include "mutex.i"
+
 #include "bitstring.i"
 #include "btree.i"
 #include "cache.i"
 #include "column.i"
 #include "cursor.i"
 #include "log.i"
-#include "mutex.i"
 #include "packing.i"
 #include "serial_funcs.i"
 
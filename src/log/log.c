@@ -7,72 +7,859 @@
 
 #include "wt_internal.h"
 
+/*
+ * __log_filename --
+ *	Build a log file name.
+ */
 static int
-__log_record_size(WT_SESSION_IMPL *session,
-    size_t *sizep, WT_LOGREC_DESC *recdesc, va_list ap)
+__log_filename(WT_SESSION_IMPL *session, uint32_t id, WT_ITEM *buf)
 {
-	return (__wt_struct_sizev(session, sizep, recdesc->fmt, ap));
+	return (__wt_buf_fmt(
+	    session, buf, "%s.%010" PRIu32, WT_LOG_FILENAME, id));
 }
 
+/*
+ * __wt_log_extract_lognum --
+ *	Given a log file name, extract the log file number.
+ */
 int
-__wt_log_put(WT_SESSION_IMPL *session, WT_LOGREC_DESC *recdesc, ...)
+__wt_log_extract_lognum(
+    WT_SESSION_IMPL *session, const char *name, uint32_t *idp)
 {
+	const char *p;
+
+	if ((p = strrchr(name, '.')) == NULL ||
+	    sscanf(p, ".%" SCNu32, idp) != 1)
+		WT_RET_MSG(session, WT_ERROR, "Bad log file name '%s'", name);
+	return (0);
+}
+
+/*
+ * __wt_log_open_file --
+ *	Open a log file by number.
+ */
+int
+__wt_log_open_file(
+    WT_SESSION_IMPL *session, uint32_t id, int ok_create, WT_FH **fhp)
+{
+	WT_DECL_ITEM(path);
 	WT_DECL_RET;
-	WT_ITEM *buf;
-	va_list ap;
-	size_t size;
 
-	buf = &session->logrec_buf;
+	WT_RET(__wt_scr_alloc(session, 0, &path));
+	WT_ERR(__log_filename(session, id, path));
+	WT_ERR(__wt_open(session, path->data, ok_create, 0, 0, fhp));
+
+err:	__wt_scr_free(&path);
+	return (ret);
+}
+
+/*
+ * __wt_log_record_size --
+ *	Return the size a record of the given length (including the header)
+ * takes in the log, that is, including alignment padding.
+ */
+uint32_t
+__wt_log_record_size(uint32_t len)
+{
+	return (WT_ALIGN(len, WT_LOG_ALIGN));
+}
+
+/*
+ * __wt_logrec_alloc --
+ *	Allocate a scratch buffer for a log record, with space reserved for
+ * the record header.
+ */
+int
+__wt_logrec_alloc(WT_SESSION_IMPL *session, size_t size, WT_ITEM **logrecp)
+{
+	WT_ITEM *logrec;
+
+	WT_RET(__wt_scr_alloc(session,
+	    WT_ALIGN(size + sizeof(WT_LOG_RECORD), WT_LOG_ALIGN), &logrec));
+	WT_CLEAR(*(WT_LOG_RECORD *)logrec->mem);
+	logrec->size = sizeof(WT_LOG_RECORD);
+
+	*logrecp = logrec;
+	return (0);
+}
+
+/*
+ * __wt_logrec_free --
+ *	Free a log record scratch buffer.
+ */
+void
+__wt_logrec_free(WT_SESSION_IMPL *session, WT_ITEM **logrecp)
+{
+	WT_UNUSED(session);
+	__wt_scr_free(logrecp);
+}
+
+/*
+ * __wt_logrec_init --
+ *	Initialize a log record buffer that isn't a scratch buffer, reserving
+ * space for the record header.
+ */
+int
+__wt_logrec_init(WT_SESSION_IMPL *session, WT_ITEM *logrec, size_t size)
+{
+	WT_RET(__wt_buf_init(session,
+	    logrec, WT_ALIGN(size + sizeof(WT_LOG_RECORD), WT_LOG_ALIGN)));
+	WT_CLEAR(*(WT_LOG_RECORD *)logrec->mem);
+	logrec->size = sizeof(WT_LOG_RECORD);
+	return (0);
+}
+
+/*
+ * __log_packv --
+ *	Append a packed header and packed fields to a log record buffer.
+ */
+static int
+__log_packv(WT_SESSION_IMPL *session, WT_ITEM *logrec,
+    uint32_t type, int is_op, WT_LOGREC_DESC *recdesc, va_list ap)
+{
+	va_list ap_copy;
+	size_t hdrsize, size;
+	uint8_t *p;
+
+	va_copy(ap_copy, ap);
+	WT_RET(__wt_struct_sizev(session, &size, recdesc->fmt, ap_copy));
+	va_end(ap_copy);
+
+	/* Operations are prefixed by their type and size, records by type. */
+	if (is_op)
+		WT_RET(__wt_struct_size(session,
+		    &hdrsize, "II", type, WT_STORE_SIZE(size)));
+	else
+		WT_RET(__wt_struct_size(session, &hdrsize, "I", type));
+
+	WT_RET(__wt_buf_grow(session, logrec, logrec->size + hdrsize + size));
+	p = (uint8_t *)logrec->mem + logrec->size;
+	if (is_op)
+		WT_RET(__wt_struct_pack(session,
+		    p, hdrsize, "II", type, WT_STORE_SIZE(size)));
+	else
+		WT_RET(__wt_struct_pack(session, p, hdrsize, "I", type));
+	WT_RET(__wt_struct_packv(
+	    session, p + hdrsize, size, recdesc->fmt, ap));
+	logrec->size += WT_STORE_SIZE(hdrsize + size);
+	return (0);
+}
+
+/*
+ * __wt_logrec_pack --
+ *	Append a log record type and its fields to a log record buffer.
+ */
+int
+__wt_logrec_pack(WT_SESSION_IMPL *session,
+    WT_ITEM *logrec, uint32_t rectype, WT_LOGREC_DESC *recdesc, ...)
+{
+	WT_DECL_RET;
+	va_list ap;
 
 	va_start(ap, recdesc);
-	ret = __log_record_size(session, &size, recdesc, ap);
+	ret = __log_packv(session, logrec, rectype, 0, recdesc, ap);
 	va_end(ap);
-	WT_RET(ret);
+	return (ret);
+}
 
-	WT_RET(__wt_buf_initsize(session, buf, size));
+/*
+ * __wt_logop_pack --
+ *	Append a log operation to a log record buffer.
+ */
+int
+__wt_logop_pack(WT_SESSION_IMPL *session,
+    WT_ITEM *logrec, uint32_t optype, WT_LOGREC_DESC *recdesc, ...)
+{
+	WT_DECL_RET;
+	va_list ap;
 
 	va_start(ap, recdesc);
-	ret = __wt_struct_packv(session, buf->mem, size, recdesc->fmt, ap);
+	ret = __log_packv(session, logrec, optype, 1, recdesc, ap);
 	va_end(ap);
 	return (ret);
 }
 
+/*
+ * __wt_log_unpack --
+ *	Unpack the fields of a log record or operation, moving the caller's
+ * pointer past them.
+ */
+int
+__wt_log_unpack(WT_SESSION_IMPL *session,
+    const uint8_t **pp, const uint8_t *end, WT_LOGREC_DESC *recdesc, ...)
+{
+	WT_DECL_RET;
+	WT_PACK pack;
+	WT_PACK_VALUE pv;
+	va_list ap;
+
+	WT_RET(__pack_init(session, &pack, recdesc->fmt));
+	WT_CLEAR(pv.u.item);			/* GCC 4.6 lint */
+
+	va_start(ap, recdesc);
+	while ((ret = __pack_next(&pack, &pv)) == 0) {
+		WT_ERR(__unpack_read(session, &pv, pp, WT_PTRDIFF(end, *pp)));
+		WT_UNPACK_PUT(session, pv, ap);
+	}
+	if (ret == WT_NOTFOUND)
+		ret = 0;
+
+err:	va_end(ap);
+	return (ret);
+}
+
+/*
+ * __wt_logrec_read --
+ *	Read the type of a log record.
+ */
+int
+__wt_logrec_read(WT_SESSION_IMPL *session,
+    const uint8_t **pp, const uint8_t *end, uint32_t *rectypep)
+{
+	uint64_t rectype;
+
+	WT_UNUSED(session);
+	WT_RET(__wt_vunpack_uint(pp, WT_PTRDIFF(end, *pp), &rectype));
+	*rectypep = (uint32_t)rectype;
+	return (0);
+}
+
+/*
+ * __wt_logop_read --
+ *	Read the type and size of a log operation.
+ */
+int
+__wt_logop_read(WT_SESSION_IMPL *session, const uint8_t **pp,
+    const uint8_t *end, uint32_t *optypep, uint32_t *opsizep)
+{
+	uint64_t optype, opsize;
+
+	WT_UNUSED(session);
+	WT_RET(__wt_vunpack_uint(pp, WT_PTRDIFF(end, *pp), &optype));
+	WT_RET(__wt_vunpack_uint(pp, WT_PTRDIFF(end, *pp), &opsize));
+	if (opsize > WT_PTRDIFF(end, *pp))
+		return (WT_ERROR);
+	*optypep = (uint32_t)optype;
+	*opsizep = (uint32_t)opsize;
+	return (0);
+}
+
+/*
+ * __log_record_finish --
+ *	Fill in the header of a log record and pad it to the log alignment.
+ */
+static int
+__log_record_finish(WT_SESSION_IMPL *session, WT_ITEM *logrec)
+{
+	WT_LOG_RECORD *logrec_hdr;
+	uint32_t len;
+
+	/*
+	 * The header records the unpadded length so readers know where the
+	 * record's data ends, the checksum covers the padding as well.
+	 */
+	len = __wt_log_record_size(logrec->size);
+	WT_RET(__wt_buf_grow(session, logrec, len));
+	memset((uint8_t *)logrec->mem + logrec->size, 0, len - logrec->size);
+
+	logrec_hdr = (WT_LOG_RECORD *)logrec->mem;
+	logrec_hdr->len = logrec->size;
+	logrec_hdr->checksum = 0;
+	logrec_hdr->checksum = __wt_cksum(logrec->mem, len);
+	logrec->size = len;
+	return (0);
+}
+
+/*
+ * __log_file_header --
+ *	Write the header record at the start of a new log file.  Called with
+ * the write lock held and nothing buffered for the new file.
+ */
+static int
+__log_file_header(WT_SESSION_IMPL *session, WT_FH *fh, off_t *sizep)
+{
+	WT_DECL_ITEM(logrec);
+	WT_DECL_RET;
+
+	WT_RET(__wt_logrec_alloc(session, 2 * sizeof(uint32_t), &logrec));
+	WT_ERR(__wt_logrec_file_header_pack(
+	    session, logrec, WT_LOG_MAGIC, WT_LOG_VERSION));
+	WT_ERR(__log_record_finish(session, logrec));
+	WT_ERR(__wt_write(session, fh, 0, logrec->size, logrec->data));
+	if (F_ISSET(S2C(session), WT_CONN_SYNC))
+		WT_ERR(__wt_fsync(session, fh));
+	*sizep = logrec->size;
+
+err:	__wt_logrec_free(session, &logrec);
+	return (ret);
+}
+
+/*
+ * __log_newfile --
+ *	Create the next log file and make it current.  Called with the write
+ * lock held and the active buffer empty.
+ */
+static int
+__log_newfile(WT_SESSION_IMPL *session, uint32_t id)
+{
+	WT_LOG *log;
+	WT_FH *fh;
+	off_t size;
+
+	log = S2C(session)->log;
+
+	WT_VERBOSE_RET(session, log, "creating log file %" PRIu32, id);
+	WT_RET(__wt_log_open_file(session, id, 1, &fh));
+	WT_RET(__log_file_header(session, fh, &size));
+
+	if (log->log_fh != NULL)
+		WT_RET(__wt_close(session, log->log_fh));
+	log->log_fh = fh;
+
+	log->alloc_lsn.file = id;
+	log->alloc_lsn.offset = size;
+	log->buf_lsn = log->write_lsn = log->sync_lsn = log->first_lsn =
+	    log->alloc_lsn;
+	return (0);
+}
+
+/*
+ * __log_switch --
+ *	Switch to a new log file if the current file can't hold a record of
+ * the given size.
+ */
+static int
+__log_switch(WT_SESSION_IMPL *session, uint32_t len)
+{
+	WT_DECL_RET;
+	WT_ITEM *buf;
+	WT_LOG *log;
+
+	log = S2C(session)->log;
+
+	/*
+	 * Hold the write lock so nobody else is writing the current file (the
+	 * spare buffer is empty), and the log spinlock so nothing more can be
+	 * copied into the active buffer.  Write and sync whatever is buffered
+	 * for the current file: records in the new file must never become
+	 * durable before records in the old one.  File switches are rare, it's
+	 * simpler to do the I/O holding the spinlock than to coordinate with
+	 * threads that find the file full in the meantime.
+	 *
+	 * The check is repeated because another thread may have switched files
+	 * while we waited.
+	 */
+	__wt_writelock(session, log->write_lock);
+	__wt_spin_lock(session, &log->lock);
+	if (log->alloc_lsn.offset + len <= log->log_file_max ||
+	    log->alloc_lsn.offset == log->first_lsn.offset)
+		goto err;
+
+	buf = &log->buf[log->active];
+	if (buf->size != 0) {
+		ret = __wt_write(session,
+		    log->log_fh, log->buf_lsn.offset, buf->size, buf->mem);
+		WT_CSTAT_INCR(session, log_writes);
+		WT_CSTAT_INCRV(session, log_bytes_written, buf->size);
+		buf->size = 0;
+		WT_ERR(ret);
+	}
+	WT_ERR(__wt_fsync(session, log->log_fh));
+	WT_CSTAT_INCR(session, log_syncs);
+
+	WT_ERR(__log_newfile(session, log->alloc_lsn.file + 1));
+
+err:	__wt_spin_unlock(session, &log->lock);
+	__wt_rwunlock(session, log->write_lock);
+	return (ret);
+}
+
+/*
+ * __log_write_buf --
+ *	Write the log up to at least the given LSN, and optionally sync it.
+ *	Called with the write lock held.
+ */
+static int
+__log_write_buf(WT_SESSION_IMPL *session, WT_LSN *lsn, int dosync)
+{
+	WT_DECL_RET;
+	WT_ITEM *buf;
+	WT_LOG *log;
+	WT_LSN start_lsn, end_lsn;
+
+	log = S2C(session)->log;
+
+	/*
+	 * If a previous write didn't include our records, swap the buffers and
+	 * write out everything copied into the active buffer so far, including
+	 * the records of any threads that are waiting behind us.
+	 */
+	if (WT_LSN_CMP(&log->write_lsn, lsn) < 0) {
+		__wt_spin_lock(session, &log->lock);
+		buf = &log->buf[log->active];
+		log->active ^= 1;
+		start_lsn = log->buf_lsn;
+		end_lsn = log->buf_lsn = log->alloc_lsn;
+		__wt_spin_unlock(session, &log->lock);
+
+		if (buf->size != 0) {
+			WT_ASSERT(session, start_lsn.file == end_lsn.file);
+			ret = __wt_write(session, log->log_fh,
+			    start_lsn.offset, buf->size, buf->mem);
+			WT_CSTAT_INCR(session, log_writes);
+			WT_CSTAT_INCRV(session, log_bytes_written, buf->size);
+			buf->size = 0;
+			WT_RET(ret);
+		}
+		log->write_lsn = end_lsn;
+	}
+
+	if (dosync && WT_LSN_CMP(&log->sync_lsn, lsn) < 0) {
+		end_lsn = log->write_lsn;
+		WT_RET(__wt_fsync(session, log->log_fh));
+		WT_CSTAT_INCR(session, log_syncs);
+		log->sync_lsn = end_lsn;
+	}
+
+	return (0);
+}
+
+/*
+ * __wt_log_flush --
+ *	Write the log up to the given LSN (or everything buffered if the LSN
+ * is NULL), and optionally sync it.
+ */
+int
+__wt_log_flush(WT_SESSION_IMPL *session, WT_LSN *lsn, int dosync)
+{
+	WT_DECL_RET;
+	WT_LOG *log;
+	WT_LSN end_lsn;
+
+	log = S2C(session)->log;
+
+	if (lsn == NULL) {
+		__wt_spin_lock(session, &log->lock);
+		end_lsn = log->alloc_lsn;
+		__wt_spin_unlock(session, &log->lock);
+		lsn = &end_lsn;
+	}
+
+	__wt_writelock(session, log->write_lock);
+	ret = __log_write_buf(session, lsn, dosync);
+	__wt_rwunlock(session, log->write_lock);
+	return (ret);
+}
+
+/*
+ * __wt_log_write --
+ *	Write a log record, returning its LSN.  The record buffer must have
+ * been allocated by __wt_logrec_alloc or initialized by __wt_logrec_init.
+ */
+int
+__wt_log_write(WT_SESSION_IMPL *session,
+    WT_ITEM *logrec, WT_LSN *lsnp, WT_TXN_SYNC sync)
+{
+	WT_DECL_RET;
+	WT_ITEM *buf;
+	WT_LOG *log;
+	WT_LSN end_lsn;
+	uint32_t len;
+	int full;
+
+	log = S2C(session)->log;
+	full = 0;
+
+	WT_RET(__log_record_finish(session, logrec));
+	len = logrec->size;
+
+	/*
+	 * Copy the record into the active buffer: the log spinlock is only
+	 * held while the space is allocated and the record copied in.
+	 */
+	for (;;) {
+		__wt_spin_lock(session, &log->lock);
+		if (log->alloc_lsn.offset + len <= log->log_file_max ||
+		    log->alloc_lsn.offset == log->first_lsn.offset)
+			break;
+		__wt_spin_unlock(session, &log->lock);
+		WT_RET(__log_switch(session, len));
+	}
+	buf = &log->buf[log->active];
+	if ((ret = __wt_buf_grow(session, buf, buf->size + len)) == 0) {
+		memcpy((uint8_t *)buf->mem + buf->size, logrec->mem, len);
+		buf->size += len;
+		if (lsnp != NULL)
+			*lsnp = log->alloc_lsn;
+		log->alloc_lsn.offset += len;
+		end_lsn = log->alloc_lsn;
+		full = buf->size >= WT_LOG_BUFFER_MAX;
+	}
+	__wt_spin_unlock(session, &log->lock);
+	WT_RET(ret);
+
+	WT_CSTAT_INCR(session, log_records);
+
+	/*
+	 * Write the buffer if the caller needs the record written, or if the
+	 * buffer has grown large: records committed with "sync=write" are
+	 * otherwise written by the next commit that needs its records written,
+	 * by a checkpoint or when the connection is closed.
+	 */
+	if (sync == TXN_SYNC_FLUSH || sync == TXN_SYNC_FULL || full)
+		WT_RET(__wt_log_flush(
+		    session, &end_lsn, sync == TXN_SYNC_FULL));
+	return (0);
+}
+
+/*
+ * __wt_log_ckpt_lsn --
+ *	Return the LSN the next record will be written at, the starting point
+ * for recovery from a checkpoint taken now.
+ */
+void
+__wt_log_ckpt_lsn(WT_SESSION_IMPL *session, WT_LSN *lsnp)
+{
+	WT_LOG *log;
+
+	log = S2C(session)->log;
+
+	__wt_spin_lock(session, &log->lock);
+	*lsnp = log->alloc_lsn;
+	__wt_spin_unlock(session, &log->lock);
+}
+
+/*
+ * __wt_log_checkpoint --
+ *	Log a checkpoint, recording the LSN recovery starts from.
+ */
+int
+__wt_log_checkpoint(WT_SESSION_IMPL *session, WT_LSN *ckpt_lsn)
+{
+	WT_DECL_ITEM(logrec);
+	WT_DECL_RET;
+
+	WT_RET(__wt_logrec_alloc(session,
+	    sizeof(uint32_t) + sizeof(uint64_t), &logrec));
+	WT_ERR(__wt_logrec_checkpoint_pack(session,
+	    logrec, ckpt_lsn->file, (uint64_t)ckpt_lsn->offset));
+	WT_ERR(__wt_log_write(session, logrec, NULL, TXN_SYNC_FLUSH));
+
+err:	__wt_logrec_free(session, &logrec);
+	return (ret);
+}
+
+/*
+ * __wt_log_archive --
+ *	Remove the log files older than the file holding the given LSN, they
+ * aren't needed by recovery from a checkpoint at that LSN.
+ */
+int
+__wt_log_archive(WT_SESSION_IMPL *session, WT_LSN *lsnp)
+{
+	WT_DECL_RET;
+	u_int count, i;
+	uint32_t id;
+	char **logfiles;
+
+	logfiles = NULL;
+	count = 0;
+
+	WT_RET(__wt_dirlist(session, WT_LOG_FILENAME, &logfiles, &count));
+	for (i = 0; i < count; i++) {
+		WT_ERR(__wt_log_extract_lognum(session, logfiles[i], &id));
+		if (id >= lsnp->file)
+			continue;
+		WT_VERBOSE_ERR(session, log,
+		    "removing log file %s", logfiles[i]);
+		WT_ERR(__wt_remove(session, logfiles[i]));
+	}
+
+err:	__wt_dirlist_free(session, logfiles, count);
+	return (ret);
+}
+
+/*
+ * __log_scan_read --
+ *	Make sure the scan buffer holds the given range of a log file, reading
+ * the file in large chunks.  Returns WT_NOTFOUND if the range extends past the
+ * end of the file.
+ */
+static int
+__log_scan_read(WT_SESSION_IMPL *session, WT_FH *fh, off_t filesize,
+    off_t offset, uint32_t len, WT_ITEM *buf, off_t *buf_offp)
+{
+	uint32_t size;
+
+	if (offset + len > filesize)
+		return (WT_NOTFOUND);
+	if (offset >= *buf_offp && offset + len <= *buf_offp + (off_t)buf->size)
+		return (0);
+
+	size = (uint32_t)WT_MIN(
+	    (off_t)WT_MAX(len, WT_LOG_READ_SIZE), filesize - offset);
+	WT_RET(__wt_buf_init(session, buf, size));
+	WT_RET(__wt_read(session, fh, offset, size, buf->mem));
+	buf->size = size;
+	*buf_offp = offset;
+	return (0);
+}
+
+/*
+ * __log_scan_file --
+ *	Read the records of a log file, starting from the given offset.
+ */
+static int
+__log_scan_file(WT_SESSION_IMPL *session, uint32_t id, off_t start,
+    WT_ITEM *buf, int (*func)(WT_SESSION_IMPL *, WT_ITEM *, WT_LSN *, void *),
+    void *cookie)
+{
+	WT_DECL_RET;
+	WT_FH *fh;
+	WT_ITEM record;
+	WT_LOG_RECORD *logrec_hdr;
+	WT_LSN lsn;
+	off_t buf_off, filesize, offset;
+	uint32_t cksum, len, magic, rectype, reclen, version;
+	const uint8_t *end, *p;
+
+	WT_RET(__wt_log_open_file(session, id, 0, &fh));
+	WT_ERR(__wt_filesize(session, fh, &filesize));
+	WT_VERBOSE_ERR(session, log,
+	    "scanning log file %" PRIu32 " from offset %" PRIuMAX,
+	    id, (uintmax_t)start);
+
+	buf->size = 0;
+	buf_off = 0;
+	magic = version = 0;
+	lsn.file = id;
+	for (offset = 0;; offset += reclen) {
+		/*
+		 * Read the record header, then the whole record.  The end of
+		 * the file's records is an unwritten or partially written
+		 * record, or a record that doesn't checksum: stop there.
+		 */
+		if ((ret = __log_scan_read(session, fh, filesize, offset,
+		    sizeof(WT_LOG_RECORD), buf, &buf_off)) == WT_NOTFOUND)
+			break;
+		WT_ERR(ret);
+		logrec_hdr =
+		    (WT_LOG_RECORD *)((uint8_t *)buf->mem + (offset - buf_off));
+		len = logrec_hdr->len;
+		if (len < sizeof(WT_LOG_RECORD))
+			break;
+		reclen = __wt_log_record_size(len);
+		if ((ret = __log_scan_read(session, fh,
+		    filesize, offset, reclen, buf, &buf_off)) == WT_NOTFOUND)
+			break;
+		WT_ERR(ret);
+		logrec_hdr =
+		    (WT_LOG_RECORD *)((uint8_t *)buf->mem + (offset - buf_off));
+		cksum = logrec_hdr->checksum;
+		logrec_hdr->checksum = 0;
+		if (__wt_cksum(logrec_hdr, reclen) != cksum) {
+			WT_VERBOSE_ERR(session, log,
+			    "log file %" PRIu32 ": checksum mismatch at offset "
+			    "%" PRIuMAX, id, (uintmax_t)offset);
+			break;
+		}
+		logrec_hdr->checksum = cksum;
+
+		/* Check the file header, the first record in the file. */
+		p = logrec_hdr->record;
+		end = (uint8_t *)logrec_hdr + len;
+		if (offset == 0) {
+			WT_ERR(__wt_logrec_read(session, &p, end, &rectype));
+			if (rectype == WT_LOGREC_FILE_HEADER)
+				WT_ERR(__wt_logrec_file_header_unpack(
+				    session, &p, end, &magic, &version));
+			if (rectype != WT_LOGREC_FILE_HEADER ||
+			    magic != WT_LOG_MAGIC)
+				WT_ERR_MSG(session, WT_ERROR,
+				    "log file %" PRIu32 ": bad header", id);
+			if (version != WT_LOG_VERSION)
+				WT_ERR_MSG(session, WT_ERROR,
+				    "log file %" PRIu32 " has unsupported "
+				    "version %" PRIu32, id, version);
+			continue;
+		}
+		if (offset < start)
+			continue;
+
+		record.data = logrec_hdr;
+		record.size = len;
+		lsn.offset = offset;
+		WT_ERR(func(session, &record, &lsn, cookie));
+	}
+	ret = 0;
+
+err:	WT_TRET(__wt_close(session, fh));
+	return (ret);
+}
+
+/*
+ * __wt_log_scan --
+ *	Read the log sequentially from the given LSN (or from the first log
+ * file if the LSN is NULL) up to the current log file, calling a function
+ * for each record.
+ */
+int
+__wt_log_scan(WT_SESSION_IMPL *session, WT_LSN *lsnp,
+    int (*func)(WT_SESSION_IMPL *, WT_ITEM *, WT_LSN *, void *), void *cookie)
+{
+	WT_DECL_ITEM(buf);
+	WT_DECL_RET;
+	WT_LOG *log;
+	u_int count, i;
+	uint32_t id;
+	char **logfiles;
+
+	log = S2C(session)->log;
+	logfiles = NULL;
+	count = 0;
+
+	WT_RET(__wt_dirlist(session, WT_LOG_FILENAME, &logfiles, &count));
+	WT_ERR(__wt_scr_alloc(session, WT_LOG_READ_SIZE, &buf));
+
+	/* The log file names sort in log file number order. */
+	for (i = 0; i < count; i++) {
+		WT_ERR(__wt_log_extract_lognum(session, logfiles[i], &id));
+		if ((lsnp != NULL && id < lsnp->file) ||
+		    id >= log->alloc_lsn.file)
+			continue;
+		WT_ERR(__log_scan_file(session, id,
+		    lsnp != NULL && id == lsnp->file ? lsnp->offset : 0,
+		    buf, func, cookie));
+	}
+
+err:	__wt_scr_free(&buf);
+	__wt_dirlist_free(session, logfiles, count);
+	return (ret);
+}
+
+/*
+ * __wt_log_open --
+ *	Open the log: create a new log file numbered after any existing log
+ * files.
+ */
+int
+__wt_log_open(WT_SESSION_IMPL *session, const char *cfg[])
+{
+	WT_CONFIG_ITEM cval;
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_LOG *log;
+	u_int count, i;
+	uint32_t id, lastid;
+	char **logfiles;
+
+	conn = S2C(session);
+	logfiles = NULL;
+	count = 0;
+
+	WT_RET(__wt_calloc_def(session, 1, &log));
+	conn->log = log;
+	__wt_spin_init(session, &log->lock);
+	WT_RET(__wt_rwlock_alloc(session, "log write", &log->write_lock));
+	WT_RET(__wt_rwlock_alloc(session, "log checkpoint", &log->ckpt_lock));
+
+	WT_RET(__wt_config_gets(session, cfg, "log_file_max", &cval));
+	log->log_file_max = (off_t)cval.val;
+
+	/*
+	 * Never append to an existing log file: its last record may have been
+	 * partially written when the system failed.
+	 */
+	lastid = 0;
+	WT_RET(__wt_dirlist(session, WT_LOG_FILENAME, &logfiles, &count));
+	for (i = 0; i < count; i++) {
+		WT_ERR(__wt_log_extract_lognum(session, logfiles[i], &id));
+		lastid = WT_MAX(id, lastid);
+	}
+
+	__wt_writelock(session, log->write_lock);
+	ret = __log_newfile(session, lastid + 1);
+	__wt_rwunlock(session, log->write_lock);
+
+err:	__wt_dirlist_free(session, logfiles, count);
+	return (ret);
+}
+
+/*
+ * __wt_log_close --
+ *	Write and sync anything buffered, then close the log.
+ */
+int
+__wt_log_close(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_LOG *log;
+
+	conn = S2C(session);
+	if ((log = conn->log) == NULL)
+		return (0);
+
+	if (log->log_fh != NULL) {
+		WT_TRET(__wt_log_flush(session, NULL, 1));
+		WT_TRET(__wt_close(session, log->log_fh));
+		log->log_fh = NULL;
+	}
+
+	__wt_buf_free(session, &log->buf[0]);
+	__wt_buf_free(session, &log->buf[1]);
+	__wt_spin_destroy(session, &log->lock);
+	if (log->write_lock != NULL)
+		__wt_rwlock_destroy(session, &log->write_lock);
+	if (log->ckpt_lock != NULL)
+		__wt_rwlock_destroy(session, &log->ckpt_lock);
+	__wt_free(session, conn->log);
+	return (ret);
+}
+
+/*
+ * __wt_log_vprintf --
+ *	Write a debugging message to the log.
+ */
 int
 __wt_log_vprintf(WT_SESSION_IMPL *session, const char *fmt, va_list ap)
 {
 	WT_CONNECTION_IMPL *conn;
-	WT_ITEM *buf;
+	WT_DECL_RET;
+	WT_ITEM *logrec;
 	va_list ap_copy;
 	size_t len;
 
 	conn = S2C(session);
 
-	if (conn->log_fh == NULL)
+	if (conn->log == NULL)
 		return (0);
 
-	buf = &session->logprint_buf;
-
 	va_copy(ap_copy, ap);
-	len = (size_t)vsnprintf(NULL, 0, fmt, ap_copy) + 2;
+	len = (size_t)vsnprintf(NULL, 0, fmt, ap_copy) + 1;
 	va_end(ap_copy);
 
-	WT_RET(__wt_buf_initsize(session, buf, len));
+	WT_RET(__wt_buf_initsize(session, &session->logprint_buf, len));
+	(void)vsnprintf(session->logprint_buf.mem, len, fmt, ap);
 
-	(void)vsnprintf(buf->mem, len, fmt, ap);
+	WT_RET(__wt_logrec_alloc(session, len + 10, &logrec));
+	WT_ERR(__wt_logrec_debug_pack(
+	    session, logrec, session->logprint_buf.mem));
 
 	/*
-	 * For now, just dump the text into the file.  Later, we will use
-	 * __wt_logput_debug to wrap this in a log header.
+	 * Debugging messages aren't durable: they're written with the next
+	 * commit that needs the log written.
 	 */
-#if 1
-	strcpy((char *)buf->mem + len - 2, "\n");
-	return ((write(conn->log_fh->fd, buf->mem, len - 1) ==
-	    (ssize_t)len - 1) ? 0 : WT_ERROR);
-#else
-	return (__wt_logput_debug(session, (char *)buf->mem));
-#endif
+	WT_ERR(__wt_log_write(session, logrec, NULL, TXN_SYNC_WRITE));
+
+err:	__wt_logrec_free(session, &logrec);
+	return (ret);
 }
 
+/*
+ * __wt_log_printf --
+ *	Write a debugging message to the log.
+ */
 int
 __wt_log_printf(WT_SESSION_IMPL *session, const char *fmt, ...)
     WT_GCC_FUNC_ATTRIBUTE((format (printf, 2, 3)))
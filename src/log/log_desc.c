@@ -3,7 +3,49 @@
 #include "wt_internal.h"
 
 WT_LOGREC_DESC
-__wt_logdesc_debug =
+__wt_logdesc_rec_file_header =
+{
+	"II", { "magic", "version", NULL }
+};
+
+WT_LOGREC_DESC
+__wt_logdesc_rec_checkpoint =
+{
+	"IQ", { "ckpt_file", "ckpt_offset", NULL }
+};
+
+WT_LOGREC_DESC
+__wt_logdesc_rec_commit =
+{
+	"Q", { "txnid", NULL }
+};
+
+WT_LOGREC_DESC
+__wt_logdesc_rec_debug =
 {
 	"S", { "message", NULL }
 };
+
+WT_LOGREC_DESC
+__wt_logdesc_op_col_put =
+{
+	"Sru", { "uri", "recno", "value", NULL }
+};
+
+WT_LOGREC_DESC
+__wt_logdesc_op_col_remove =
+{
+	"Sr", { "uri", "recno", NULL }
+};
+
+WT_LOGREC_DESC
+__wt_logdesc_op_row_put =
+{
+	"Suu", { "uri", "key", "value", NULL }
+};
+
+WT_LOGREC_DESC
+__wt_logdesc_op_row_remove =
+{
+	"Su", { "uri", "key", NULL }
+};
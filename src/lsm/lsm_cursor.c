@@ -11,15 +11,12 @@
 	for ((i) = (clsm)->nchunks - 1; (i) >= 0; (i)--)		\
 		if (((c) = (clsm)->cursors[i]) != NULL)
 
-#define	WT_LSM_CMP(s, lsm_tree, k1, k2, cmp)				\
-	(((lsm_tree)->collator == NULL) ?				\
-	(((cmp) = __wt_btree_lex_compare((k1), (k2))), 0) :		\
-	(lsm_tree)->collator->compare((lsm_tree)->collator,		\
-	    &(s)->iface, (k1), (k2), &(cmp)))
-
 #define	WT_LSM_CURCMP(s, lsm_tree, c1, c2, cmp)				\
 	WT_LSM_CMP(s, lsm_tree, &(c1)->key, &(c2)->key, cmp)
 
+#define	WT_CLSM_POSITIONED(c)						\
+	((c) != NULL && F_ISSET(c, WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET))
+
 /*
  * LSM API enter: check that the cursor is in sync with the tree.
  */
@@ -33,7 +30,7 @@
 	CURSOR_UPDATE_API_CALL(cursor, session, n, NULL);		\
 	WT_ERR(__clsm_enter(clsm))
 
-static int __clsm_open_cursors(WT_CURSOR_LSM *, int);
+static int __clsm_open_cursors(WT_CURSOR_LSM *, WT_LSM_CHUNK **);
 static int __clsm_search(WT_CURSOR *);
 
 static inline int
@@ -41,7 +38,7 @@ __clsm_enter(WT_CURSOR_LSM *clsm)
 {
 	if (!F_ISSET(clsm, WT_CLSM_MERGE) &&
 	    clsm->dsk_gen != clsm->lsm_tree->dsk_gen)
-		WT_RET(__clsm_open_cursors(clsm, 0));
+		WT_RET(__clsm_open_cursors(clsm, NULL));
 
 	return (0);
 }
@@ -68,6 +65,41 @@ __clsm_deleted(WT_CURSOR_LSM *clsm, WT_ITEM *item)
 	return (!F_ISSET(clsm, WT_CLSM_MINOR_MERGE) && item->size == 0);
 }
 
+/*
+ * __clsm_range --
+ *	Check a key against the range of keys in one of the cursor's chunks:
+ *	set the result to -1 if the key sorts before every key in the chunk,
+ *	1 if it sorts after them, and 0 otherwise or if the range is unknown.
+ *
+ *	Chunks only get a range once they are read-only, and an open cursor
+ *	stops the chunk being dropped, so the range can be read without a
+ *	lock.  The flush worker sets the keys before the flag, read them after
+ *	a barrier.
+ */
+static inline int
+__clsm_range(WT_SESSION_IMPL *session,
+    WT_CURSOR_LSM *clsm, int i, WT_ITEM *key, int *cmpp)
+{
+	WT_LSM_CHUNK *chunk;
+	int cmp;
+
+	*cmpp = 0;
+	chunk = clsm->chunks[i];
+	if (!F_ISSET(chunk, WT_LSM_CHUNK_RANGE))
+		return (0);
+	WT_READ_BARRIER();
+
+	WT_RET(WT_LSM_CMP(session, clsm->lsm_tree, key, &chunk->key_min, cmp));
+	if (cmp < 0) {
+		*cmpp = -1;
+		return (0);
+	}
+	WT_RET(WT_LSM_CMP(session, clsm->lsm_tree, key, &chunk->key_max, cmp));
+	if (cmp > 0)
+		*cmpp = 1;
+	return (0);
+}
+
 /*
  * __clsm_close_cursors --
  *	Close all of the btree cursors currently open.
@@ -103,10 +135,11 @@ __clsm_close_cursors(WT_CURSOR_LSM *clsm)
 
 /*
  * __clsm_open_cursors --
- *	Open cursors for the current set of files.
+ *	Open cursors for the current set of files, or for a merge, the given
+ * set of files, oldest first.
  */
 static int
-__clsm_open_cursors(WT_CURSOR_LSM *clsm, int start_chunk)
+__clsm_open_cursors(WT_CURSOR_LSM *clsm, WT_LSM_CHUNK **merge_chunks)
 {
 	WT_CURSOR *c, **cp;
 	WT_DECL_RET;
@@ -135,17 +168,21 @@ __clsm_open_cursors(WT_CURSOR_LSM *clsm, int start_chunk)
 	WT_RET(__clsm_close_cursors(clsm));
 
 	__wt_spin_lock(session, &lsm_tree->lock);
-	/* Merge cursors have already figured out how many chunks they need. */
-	if (F_ISSET(clsm, WT_CLSM_MERGE))
-		nchunks = clsm->nchunks;
-	else
-		nchunks = lsm_tree->nchunks;
+	/* Merge cursors have already figured out which chunks they need. */
+	nchunks = F_ISSET(clsm, WT_CLSM_MERGE) ?
+	    clsm->nchunks : lsm_tree->nchunks;
 
 	if (clsm->cursors == NULL || nchunks > clsm->nchunks) {
 		WT_ERR(__wt_realloc(session, NULL,
 		    nchunks * sizeof(WT_BLOOM *), &clsm->blooms));
 		WT_ERR(__wt_realloc(session, NULL,
 		    nchunks * sizeof(WT_CURSOR *), &clsm->cursors));
+		WT_ERR(__wt_realloc(session, NULL,
+		    nchunks * sizeof(WT_LSM_CHUNK *), &clsm->chunks));
+		WT_ERR(__wt_realloc(session, NULL,
+		    nchunks * sizeof(int), &clsm->heap));
+		WT_ERR(__wt_realloc(session, NULL,
+		    nchunks * sizeof(int), &clsm->heap_dup));
 	}
 	clsm->nchunks = nchunks;
 
@@ -154,7 +191,9 @@ __clsm_open_cursors(WT_CURSOR_LSM *clsm, int start_chunk)
 		 * Read from the checkpoint if the file has been written.
 		 * Once all cursors switch, the in-memory tree can be evicted.
 		 */
-		chunk = lsm_tree->chunk[i + start_chunk];
+		chunk = F_ISSET(clsm, WT_CLSM_MERGE) ?
+		    merge_chunks[i] : lsm_tree->chunk[i];
+		clsm->chunks[i] = chunk;
 		ret = __wt_open_cursor(session,
 		    chunk->uri, &clsm->iface,
 		    !F_ISSET(chunk, WT_LSM_CHUNK_ONDISK) ? NULL :
@@ -175,7 +214,7 @@ __clsm_open_cursors(WT_CURSOR_LSM *clsm, int start_chunk)
 			WT_ERR(__wt_bloom_open(session, chunk->bloom_uri,
 			    lsm_tree->bloom_bit_count,
 			    lsm_tree->bloom_hash_count,
-			    c, &clsm->blooms[i]));
+			    c, &chunk->bloom_mem, &clsm->blooms[i]));
 
 		/* Child cursors always use overwrite and raw mode. */
 		F_SET(*cp, WT_CURSTD_OVERWRITE | WT_CURSTD_RAW);
@@ -201,50 +240,171 @@ err:	__wt_spin_unlock(session, &lsm_tree->lock);
 }
 
 /* __wt_clsm_init_merge --
- *	Initialize an LSM cursor for a merge.
+ *	Initialize an LSM cursor for a merge of a set of chunks, oldest first.
+ * A minor merge doesn't include the oldest data for its keys, so it keeps
+ * tombstones.
  */
 int
-__wt_clsm_init_merge(WT_CURSOR *cursor, int start_chunk, int nchunks)
+__wt_clsm_init_merge(
+    WT_CURSOR *cursor, WT_LSM_CHUNK **chunks, int nchunks, int minor)
 {
 	WT_CURSOR_LSM *clsm;
 
 	clsm = (WT_CURSOR_LSM *)cursor;
 	F_SET(clsm, WT_CLSM_MERGE);
-	if (start_chunk != 0)
+	if (minor)
 		F_SET(clsm, WT_CLSM_MINOR_MERGE);
 	clsm->nchunks = nchunks;
 
-	return (__clsm_open_cursors(clsm, start_chunk));
+	return (__clsm_open_cursors(clsm, chunks));
+}
+
+/*
+ * __clsm_heap_less --
+ *	Check whether the cursor in one slot of the iteration heap comes before
+ *	the cursor in another: positioned cursors come before exhausted ones,
+ *	then cursors in key order, smallest or largest first, and for equal
+ *	keys, newer chunks before older ones.
+ */
+static inline int
+__clsm_heap_less(WT_SESSION_IMPL *session,
+    WT_CURSOR_LSM *clsm, int smallest, int a, int b, int *lessp)
+{
+	WT_CURSOR *ca, *cb;
+	int cmp;
+
+	a = clsm->heap[a];
+	b = clsm->heap[b];
+	ca = clsm->cursors[a];
+	cb = clsm->cursors[b];
+	if (!WT_CLSM_POSITIONED(ca) || !WT_CLSM_POSITIONED(cb)) {
+		*lessp = WT_CLSM_POSITIONED(ca);
+		return (0);
+	}
+	WT_RET(WT_LSM_CURCMP(session, clsm->lsm_tree, ca, cb, cmp));
+	if (cmp == 0)
+		*lessp = a > b;
+	else
+		*lessp = smallest ? cmp < 0 : cmp > 0;
+	return (0);
+}
+
+/*
+ * __clsm_heap_sift --
+ *	Move the cursor in a slot of the iteration heap down to its place,
+ *	given that the slot's subtrees are in heap order.
+ */
+static int
+__clsm_heap_sift(
+    WT_SESSION_IMPL *session, WT_CURSOR_LSM *clsm, int smallest, int slot)
+{
+	int best, child, less, tmp;
+
+	for (;;) {
+		best = slot;
+		for (child = 2 * slot + 1;
+		    child <= 2 * slot + 2 && child < clsm->nchunks; child++) {
+			WT_RET(__clsm_heap_less(
+			    session, clsm, smallest, child, best, &less));
+			if (less)
+				best = child;
+		}
+		if (best == slot)
+			return (0);
+		tmp = clsm->heap[slot];
+		clsm->heap[slot] = clsm->heap[best];
+		clsm->heap[best] = tmp;
+		slot = best;
+	}
+}
+
+/*
+ * __clsm_heap_build --
+ *	Order the chunk cursors for an iteration, after positioning them.
+ */
+static int
+__clsm_heap_build(WT_SESSION_IMPL *session, WT_CURSOR_LSM *clsm, int smallest)
+{
+	int i;
+
+	for (i = 0; i < clsm->nchunks; i++)
+		clsm->heap[i] = i;
+	for (i = clsm->nchunks / 2 - 1; i >= 0; i--)
+		WT_RET(__clsm_heap_sift(session, clsm, smallest, i));
+	return (0);
+}
+
+/*
+ * __clsm_heap_advance --
+ *	Move the current cursor, and any others on the same key, to their next
+ *	keys, and restore the order of the iteration heap.
+ *
+ *	The cursors on the current key form a subtree at the top of the heap:
+ *	collect them, in breadth-first order, before moving any of them, then
+ *	sift them down deepest first, so each slot's subtrees are in order by
+ *	the time the slot is sifted.
+ */
+static int
+__clsm_heap_advance(WT_SESSION_IMPL *session, WT_CURSOR_LSM *clsm, int smallest)
+{
+	WT_CURSOR *c, *current;
+	int child, cmp, i, ndup, slot;
+
+	current = clsm->cursors[clsm->heap[0]];
+	clsm->heap_dup[0] = 0;
+	ndup = 1;
+	for (i = 0; F_ISSET(clsm, WT_CLSM_MULTIPLE) && i < ndup; i++) {
+		slot = clsm->heap_dup[i];
+		for (child = 2 * slot + 1;
+		    child <= 2 * slot + 2 && child < clsm->nchunks; child++) {
+			c = clsm->cursors[clsm->heap[child]];
+			if (!WT_CLSM_POSITIONED(c))
+				continue;
+			WT_RET(WT_LSM_CURCMP(
+			    session, clsm->lsm_tree, c, current, cmp));
+			if (cmp == 0)
+				clsm->heap_dup[ndup++] = child;
+		}
+	}
+
+	for (i = 0; i < ndup; i++) {
+		c = clsm->cursors[clsm->heap[clsm->heap_dup[i]]];
+		WT_RET_NOTFOUND_OK(smallest ? c->next(c) : c->prev(c));
+	}
+	for (i = ndup - 1; i >= 0; i--)
+		WT_RET(__clsm_heap_sift(
+		    session, clsm, smallest, clsm->heap_dup[i]));
+	return (0);
 }
 
 /*
  * __clsm_get_current --
- *	Find the smallest / largest of the cursors and copy its key/value.
+ *	Take the smallest / largest of the cursors from the top of the
+ *	iteration heap and copy its key/value.
  */
 static int
 __clsm_get_current(
-    WT_SESSION_IMPL *session, WT_CURSOR_LSM *clsm, int smallest, int *deletedp)
+    WT_SESSION_IMPL *session, WT_CURSOR_LSM *clsm, int *deletedp)
 {
 	WT_CURSOR *c, *current;
-	int i;
-	int cmp, multiple;
+	int child, cmp, multiple;
 
 	current = NULL;
 	multiple = 0;
 
-	FORALL_CURSORS(clsm, c, i) {
-		if (!F_ISSET(c, WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET))
-			continue;
-		if (current == NULL) {
-			current = c;
-			continue;
+	/* The next cursor on the same key, if any, is a child of the top. */
+	if (clsm->nchunks > 0 &&
+	    WT_CLSM_POSITIONED(clsm->cursors[clsm->heap[0]])) {
+		current = clsm->cursors[clsm->heap[0]];
+		for (child = 1; child <= 2 && child < clsm->nchunks; child++) {
+			c = clsm->cursors[clsm->heap[child]];
+			if (!WT_CLSM_POSITIONED(c))
+				continue;
+			WT_RET(WT_LSM_CURCMP(
+			    session, clsm->lsm_tree, c, current, cmp));
+			if (cmp == 0)
+				multiple = 1;
 		}
-		WT_RET(WT_LSM_CURCMP(session, clsm->lsm_tree, c, current, cmp));
-		if (smallest ? cmp < 0 : cmp > 0) {
-			current = c;
-			multiple = 0;
-		} else if (cmp == 0)
-			multiple = 1;
 	}
 
 	c = &clsm->iface;
@@ -314,7 +474,7 @@ __clsm_next(WT_CURSOR *cursor)
 	WT_CURSOR *c;
 	WT_DECL_RET;
 	WT_SESSION_IMPL *session;
-	int check, cmp, deleted, i;
+	int cmp, deleted, i;
 
 	WT_LSM_ENTER(clsm, cursor, session, next);
 
@@ -326,6 +486,15 @@ __clsm_next(WT_CURSOR *cursor)
 				WT_ERR(c->reset(c));
 				ret = c->next(c);
 			} else if (c != clsm->current) {
+				/* Skip chunks with no keys after the key. */
+				WT_ERR(__clsm_range(
+				    session, clsm, i, &cursor->key, &cmp));
+				if (cmp > 0) {
+					WT_STAT_INCR(clsm->lsm_tree->stats,
+					    search_range_skips);
+					WT_ERR(c->reset(c));
+					continue;
+				}
 				c->set_key(c, &cursor->key);
 				if ((ret = c->search_near(c, &cmp)) == 0) {
 					if (cmp < 0)
@@ -343,40 +512,21 @@ __clsm_next(WT_CURSOR *cursor)
 		}
 		F_SET(clsm, WT_CLSM_ITERATE_NEXT);
 		F_CLR(clsm, WT_CLSM_ITERATE_PREV);
+		WT_ERR(__clsm_heap_build(session, clsm, 1));
 
 		/* We just positioned *at* the key, now move. */
 		if (clsm->current != NULL)
 			goto retry;
 	} else {
 retry:		/*
-		 * If there are multiple cursors on that key, move them
-		 * forward.
+		 * Move the smallest cursor forward, along with any others on
+		 * the same key.
 		 */
-		if (F_ISSET(clsm, WT_CLSM_MULTIPLE)) {
-			check = 0;
-			FORALL_CURSORS(clsm, c, i) {
-				if (!F_ISSET(c,
-				    WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET))
-					continue;
-				if (check) {
-					WT_ERR(WT_LSM_CURCMP(session,
-					    clsm->lsm_tree, c, clsm->current,
-					    cmp));
-					if (cmp == 0)
-						WT_ERR_NOTFOUND_OK(c->next(c));
-				}
-				if (c == clsm->current)
-					check = 1;
-			}
-		}
-
-		/* Move the smallest cursor forward. */
-		c = clsm->current;
-		WT_ERR_NOTFOUND_OK(c->next(c));
+		WT_ERR(__clsm_heap_advance(session, clsm, 1));
 	}
 
 	/* Find the cursor(s) with the smallest key. */
-	if ((ret = __clsm_get_current(session, clsm, 1, &deleted)) == 0 &&
+	if ((ret = __clsm_get_current(session, clsm, &deleted)) == 0 &&
 	    deleted)
 		goto retry;
 err:	API_END(session);
@@ -395,7 +545,7 @@ __clsm_prev(WT_CURSOR *cursor)
 	WT_CURSOR *c;
 	WT_DECL_RET;
 	WT_SESSION_IMPL *session;
-	int check, cmp, deleted, i;
+	int cmp, deleted, i;
 
 	WT_LSM_ENTER(clsm, cursor, session, next);
 
@@ -407,6 +557,15 @@ __clsm_prev(WT_CURSOR *cursor)
 				WT_ERR(c->reset(c));
 				ret = c->prev(c);
 			} else if (c != clsm->current) {
+				/* Skip chunks with no keys before the key. */
+				WT_ERR(__clsm_range(
+				    session, clsm, i, &cursor->key, &cmp));
+				if (cmp < 0) {
+					WT_STAT_INCR(clsm->lsm_tree->stats,
+					    search_range_skips);
+					WT_ERR(c->reset(c));
+					continue;
+				}
 				c->set_key(c, &cursor->key);
 				if ((ret = c->search_near(c, &cmp)) == 0) {
 					if (cmp > 0)
@@ -424,40 +583,21 @@ __clsm_prev(WT_CURSOR *cursor)
 		}
 		F_SET(clsm, WT_CLSM_ITERATE_PREV);
 		F_CLR(clsm, WT_CLSM_ITERATE_NEXT);
+		WT_ERR(__clsm_heap_build(session, clsm, 0));
 
 		/* We just positioned *at* the key, now move. */
 		if (clsm->current != NULL)
 			goto retry;
 	} else {
 retry:		/*
-		 * If there are multiple cursors on that key, move them
-		 * backwards.
+		 * Move the largest cursor backwards, along with any others on
+		 * the same key.
 		 */
-		if (F_ISSET(clsm, WT_CLSM_MULTIPLE)) {
-			check = 0;
-			FORALL_CURSORS(clsm, c, i) {
-				if (!F_ISSET(c,
-				    WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET))
-					continue;
-				if (check) {
-					WT_ERR(WT_LSM_CURCMP(session,
-					    clsm->lsm_tree, c, clsm->current,
-					    cmp));
-					if (cmp == 0)
-						WT_ERR_NOTFOUND_OK(c->prev(c));
-				}
-				if (c == clsm->current)
-					check = 1;
-			}
-		}
-
-		/* Move the smallest cursor backwards. */
-		c = clsm->current;
-		WT_ERR_NOTFOUND_OK(c->prev(c));
+		WT_ERR(__clsm_heap_advance(session, clsm, 0));
 	}
 
 	/* Find the cursor(s) with the largest key. */
-	if ((ret = __clsm_get_current(session, clsm, 0, &deleted)) == 0 &&
+	if ((ret = __clsm_get_current(session, clsm, &deleted)) == 0 &&
 	    deleted)
 		goto retry;
 err:	API_END(session);
@@ -506,7 +646,7 @@ __clsm_search(WT_CURSOR *cursor)
 	WT_CURSOR_LSM *clsm;
 	WT_DECL_RET;
 	WT_SESSION_IMPL *session;
-	int i;
+	int cmp, i;
 
 	WT_LSM_ENTER(clsm, cursor, session, search);
 	WT_CURSOR_NEEDKEY(cursor);
@@ -524,6 +664,13 @@ __clsm_search(WT_CURSOR *cursor)
 	}
 
 	FORALL_CURSORS(clsm, c, i) {
+		/* Skip chunks whose range of keys can't include the key. */
+		WT_ERR(__clsm_range(session, clsm, i, &cursor->key, &cmp));
+		if (cmp != 0) {
+			WT_STAT_INCR(clsm->lsm_tree->stats, search_range_skips);
+			continue;
+		}
+
 		/* If there is a Bloom filter, see if we can skip the read. */
 		if ((bloom = clsm->blooms[i]) != NULL) {
 			ret = __wt_bloom_get(bloom, &cursor->key);
@@ -565,6 +712,161 @@ err:	API_END(session);
 	return (ret);
 }
 
+/*
+ * __clsm_search_batch --
+ *	WT_CURSOR->search_batch method for the LSM cursor type.
+ */
+static int
+__clsm_search_batch(WT_CURSOR *cursor,
+    WT_ITEM *keys, WT_ITEM *values, int *results, size_t count)
+{
+	WT_BLOOM *bloom;
+	WT_BLOOM_HASH *bhash;
+	WT_CURSOR *c;
+	WT_CURSOR_LSM *clsm;
+	WT_DECL_RET;
+	WT_ITEM *buf, value;
+	WT_LSM_STATS *stats;
+	WT_SESSION_IMPL *session;
+	size_t hi, j, k, lo, mid, n, remaining, used, *offsets, *order;
+	int cmp, hashed, i;
+
+	bhash = NULL;
+	offsets = order = NULL;
+	hashed = 0;
+
+	WT_LSM_ENTER(clsm, cursor, session, search_batch);
+	F_CLR(cursor, WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET);
+	buf = &clsm->batch_values;
+	stats = clsm->lsm_tree->stats;
+	F_CLR(clsm, WT_CLSM_ITERATE_NEXT | WT_CLSM_ITERATE_PREV);
+
+	/* The batch doesn't position the cursor, release any position. */
+	if (clsm->current != NULL) {
+		WT_ERR(clsm->current->reset(clsm->current));
+		clsm->current = NULL;
+	}
+	if (count == 0)
+		goto done;
+
+	WT_ERR(__wt_calloc_def(session, count, &bhash));
+	WT_ERR(__wt_calloc_def(session, count, &offsets));
+	WT_ERR(__wt_calloc_def(session, count, &order));
+
+	/*
+	 * Sort the keys so each chunk is searched in key order: the searches
+	 * for nearby keys find the pages they need already in memory.  The
+	 * comparison may be an application collator, which rules out qsort;
+	 * batches are small, use a binary insertion sort.
+	 */
+	for (j = 0; j < count; j++) {
+		results[j] = WT_NOTFOUND;
+		values[j].data = NULL;
+		values[j].size = 0;
+
+		for (lo = 0, hi = j; lo < hi;) {
+			mid = lo + (hi - lo) / 2;
+			WT_ERR(WT_LSM_CMP(session,
+			    clsm->lsm_tree, &keys[order[mid]], &keys[j], cmp));
+			if (cmp <= 0)
+				lo = mid + 1;
+			else
+				hi = mid;
+		}
+		memmove(order + lo + 1, order + lo, (j - lo) * sizeof(*order));
+		order[lo] = j;
+	}
+
+	/*
+	 * Search the chunks from newest to oldest.  The order array holds the
+	 * keys not yet resolved, a key is resolved by the first chunk where it
+	 * is found, either with a value or deleted.
+	 */
+	remaining = count;
+	used = 0;
+	FORALL_CURSORS(clsm, c, i) {
+		if (remaining == 0)
+			break;
+
+		/* Hash the keys once, for all of the Bloom filters. */
+		if ((bloom = clsm->blooms[i]) != NULL && !hashed) {
+			for (j = 0; j < count; j++)
+				__wt_bloom_hash(bloom, &keys[j], &bhash[j]);
+			hashed = 1;
+		}
+
+		for (j = n = 0; j < remaining; j++) {
+			k = order[j];
+			WT_ERR(__clsm_range(session, clsm, i, &keys[k], &cmp));
+			if (cmp != 0) {
+				WT_STAT_INCR(stats, search_range_skips);
+				order[n++] = k;
+				continue;
+			}
+			if (bloom != NULL) {
+				ret = __wt_bloom_hash_get(bloom, &bhash[k]);
+				if (ret == WT_NOTFOUND) {
+					WT_STAT_INCR(stats, bloom_misses);
+					order[n++] = k;
+					ret = 0;
+					continue;
+				}
+				WT_ERR(ret);
+				WT_STAT_INCR(stats, bloom_hits);
+			}
+
+			c->set_key(c, &keys[k]);
+			if ((ret = c->search(c)) == WT_NOTFOUND) {
+				/* The active chunk has no Bloom filter. */
+				if (bloom != NULL)
+					WT_STAT_INCR(
+					    stats, bloom_false_positives);
+				else if (i != clsm->nchunks - 1)
+					WT_STAT_INCR(
+					    stats, search_miss_no_bloom);
+				order[n++] = k;
+				ret = 0;
+				continue;
+			}
+			WT_ERR(ret);
+
+			WT_ERR(c->get_value(c, &value));
+			if (__clsm_deleted(clsm, &value))
+				continue;
+
+			/*
+			 * Copy the value out before moving the chunk cursor,
+			 * the buffer may be reallocated as it grows, so the
+			 * returned items are set once all values are copied.
+			 */
+			if (used + value.size > buf->memsize)
+				WT_ERR(__wt_buf_grow(session, buf, WT_MAX(
+				    used + value.size, 2 * buf->memsize)));
+			memcpy((uint8_t *)buf->mem + used,
+			    value.data, value.size);
+			offsets[k] = used;
+			used += value.size;
+			values[k].size = value.size;
+			results[k] = 0;
+		}
+		remaining = n;
+
+		WT_ERR(c->reset(c));
+	}
+
+	for (j = 0; j < count; j++)
+		if (results[j] == 0)
+			values[j].data = (uint8_t *)buf->mem + offsets[j];
+
+done:
+err:	API_END(session);
+	__wt_free(session, bhash);
+	__wt_free(session, offsets);
+	__wt_free(session, order);
+
+	return (ret);
+}
+
 /*
  * __clsm_search_near --
  *	WT_CURSOR->search_near method for the LSM cursor type.
@@ -577,9 +879,11 @@ __clsm_search_near(WT_CURSOR *cursor, int *exactp)
 	WT_DECL_RET;
 	WT_ITEM v;
 	WT_SESSION_IMPL *session;
-	int cmp, deleted, i;
+	int cmp, deleted, i, skipped, skipping;
 
 	larger = smaller = NULL;
+	skipped = 0;
+	skipping = 1;
 
 	WT_LSM_ENTER(clsm, cursor, session, search_near);
 	WT_CURSOR_NEEDKEY(cursor);
@@ -607,8 +911,22 @@ __clsm_search_near(WT_CURSOR *cursor, int *exactp)
 	 * the bottom, we prefer the larger cursor, but if no record is larger,
 	 * return the smaller cursor, or if no record at all was found,
 	 * WT_NOTFOUND.
+	 *
+	 * A chunk with all of its keys before the search key can only supply
+	 * the smaller cursor, which is only used if no chunk has a larger
+	 * record: the first pass skips those chunks, and a second pass
+	 * searches only them, if it's needed.
 	 */
-	FORALL_CURSORS(clsm, c, i) {
+retry:	FORALL_CURSORS(clsm, c, i) {
+		WT_ERR(__clsm_range(session, clsm, i, &cursor->key, &cmp));
+		if (skipping && cmp > 0) {
+			WT_STAT_INCR(clsm->lsm_tree->stats, search_range_skips);
+			skipped = 1;
+			continue;
+		}
+		if (!skipping && cmp <= 0)
+			continue;
+
 		c->set_key(c, &cursor->key);
 		if ((ret = c->search_near(c, &cmp)) == WT_NOTFOUND) {
 			ret = 0;
@@ -696,6 +1014,11 @@ __clsm_search_near(WT_CURSOR *cursor, int *exactp)
 			WT_ERR(c->reset(c));
 	}
 
+	if (larger == NULL && skipped && skipping) {
+		skipping = 0;
+		goto retry;
+	}
+
 	if (larger != NULL) {
 		clsm->current = larger;
 		larger = NULL;
@@ -727,6 +1050,33 @@ err:	API_END(session);
 	return (ret);
 }
 
+/*
+ * __clsm_throttle --
+ *	Slow down a write if merges in the tree are falling behind.
+ */
+static inline void
+__clsm_throttle(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
+{
+	uint64_t sleep;
+
+	/* Past the hard limits, wait until merges catch up. */
+	if (lsm_tree->throttle_stall) {
+		WT_STAT_INCR(lsm_tree->stats, write_stall);
+		while (lsm_tree->throttle_stall &&
+		    WT_LSM_MERGE_RUN(session, lsm_tree)) {
+			__wt_sleep(0, WT_LSM_THROTTLE_MAX);
+			WT_STAT_INCRV(lsm_tree->stats,
+			    write_throttle_usecs, WT_LSM_THROTTLE_MAX);
+		}
+	}
+
+	if ((sleep = lsm_tree->throttle_sleep) != 0) {
+		WT_STAT_INCR(lsm_tree->stats, write_throttle);
+		WT_STAT_INCRV(lsm_tree->stats, write_throttle_usecs, sleep);
+		__wt_sleep(0, (long)sleep);
+	}
+}
+
 /*
  * __clsm_put --
  *	Put an entry into the in-memory tree, trigger a file switch if
@@ -736,6 +1086,8 @@ static inline int
 __clsm_put(
     WT_SESSION_IMPL *session, WT_CURSOR_LSM *clsm, WT_ITEM *key, WT_ITEM *value)
 {
+	WT_BLOOM *bloom;
+	WT_BLOOM_HASH bhash;
 	WT_BTREE *btree;
 	WT_CURSOR *primary;
 	WT_DECL_RET;
@@ -744,6 +1096,9 @@ __clsm_put(
 
 	lsm_tree = clsm->lsm_tree;
 
+	if (lsm_tree->throttle_stall || lsm_tree->throttle_sleep != 0)
+		__clsm_throttle(session, lsm_tree);
+
 	/*
 	 * If this is the first update in this cursor, check if a new in-memory
 	 * chunk is needed.
@@ -772,6 +1127,12 @@ __clsm_put(
 	 */
 	++clsm->primary_chunk->count;
 
+	/* Fill in the chunk's Bloom filter, if it's being built. */
+	if ((bloom = clsm->primary_chunk->bloom_build) != NULL) {
+		__wt_bloom_hash(bloom, key, &bhash);
+		__wt_bloom_hash_insert(bloom, &bhash);
+	}
+
 	/*
 	 * Set the position for future scans.  If we were already positioned in
 	 * a non-primary chunk, we may now have multiple cursors matching the
@@ -899,8 +1260,12 @@ __clsm_close(WT_CURSOR *cursor)
 	clsm = (WT_CURSOR_LSM *)cursor;
 	CURSOR_API_CALL(cursor, session, close, NULL);
 	WT_TRET(__clsm_close_cursors(clsm));
+	__wt_buf_free(session, &clsm->batch_values);
 	__wt_free(session, clsm->blooms);
 	__wt_free(session, clsm->cursors);
+	__wt_free(session, clsm->chunks);
+	__wt_free(session, clsm->heap);
+	__wt_free(session, clsm->heap_dup);
 	/* The WT_LSM_TREE owns the URI. */
 	cursor->uri = NULL;
 	if (clsm->lsm_tree != NULL)
@@ -934,6 +1299,7 @@ __wt_clsm_open(WT_SESSION_IMPL *session,
 		__clsm_reset,
 		__clsm_search,
 		__clsm_search_near,
+		__clsm_search_batch,
 		__clsm_insert,
 		__clsm_update,
 		__clsm_remove,
@@ -8,15 +8,15 @@
 #include "wt_internal.h"
 
 /*
- * __wt_lsm_merge_update_tree --
- *	Merge a set of chunks and populate a new one.
+ * __lsm_merge_retire --
+ *	Add merged chunks to the list of obsolete chunks.
  *	Must be called with the LSM lock held.
  */
-int
-__wt_lsm_merge_update_tree(WT_SESSION_IMPL *session,
-    WT_LSM_TREE *lsm_tree, int start_chunk, int nchunks, WT_LSM_CHUNK *chunk)
+static int
+__lsm_merge_retire(WT_SESSION_IMPL *session,
+    WT_LSM_TREE *lsm_tree, WT_LSM_CHUNK **chunks, int nchunks)
 {
-	size_t chunk_sz, chunks_after_merge;
+	size_t chunk_sz;
 	int i, j;
 
 	/* Setup the array of obsolete chunks. */
@@ -33,14 +33,29 @@ __wt_lsm_merge_update_tree(WT_SESSION_IMPL *session,
 	/* Copy entries one at a time, so we can reuse gaps in the list. */
 	for (i = j = 0; j < nchunks && i < lsm_tree->nold_chunks; i++) {
 		if (lsm_tree->old_chunks[i] == NULL) {
-			lsm_tree->old_chunks[i] =
-			    lsm_tree->chunk[start_chunk + j];
+			lsm_tree->old_chunks[i] = chunks[j];
 			++j;
 			--lsm_tree->old_avail;
 		}
 	}
 
 	WT_ASSERT(session, j == nchunks);
+	return (0);
+}
+
+/*
+ * __wt_lsm_merge_update_tree --
+ *	Merge a set of chunks and populate a new one.
+ *	Must be called with the LSM lock held.
+ */
+int
+__wt_lsm_merge_update_tree(WT_SESSION_IMPL *session,
+    WT_LSM_TREE *lsm_tree, int start_chunk, int nchunks, WT_LSM_CHUNK *chunk)
+{
+	size_t chunks_after_merge;
+
+	WT_RET(__lsm_merge_retire(
+	    session, lsm_tree, lsm_tree->chunk + start_chunk, nchunks));
 
 	/* Update the current chunk list. */
 	chunks_after_merge = lsm_tree->nchunks - (nchunks + start_chunk);
@@ -52,62 +67,90 @@ __wt_lsm_merge_update_tree(WT_SESSION_IMPL *session,
 	    (nchunks - 1) * sizeof(*lsm_tree->chunk));
 	lsm_tree->chunk[start_chunk] = chunk;
 	lsm_tree->dsk_gen++;
+	__wt_lsm_tree_throttle(session, lsm_tree);
 
 	return (0);
 }
 
 /*
- * __wt_lsm_merge --
- *	Merge a set of chunks of an LSM tree.
+ * __lsm_merge_install --
+ *	Replace the chunks read by a merge with the chunks it wrote.  With the
+ *	leveled policy, the new chunks join the end of their level, otherwise
+ *	they take the place of the merged chunks.
+ *	Must be called with the LSM lock held.
  */
-int
-__wt_lsm_merge(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, int stalls)
+static int
+__lsm_merge_install(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree,
+    WT_LSM_CHUNK **inputs, int ninputs, WT_LSM_CHUNK **outputs, int noutputs,
+    uint32_t generation, int retire)
 {
-	WT_BLOOM *bloom;
-	WT_CURSOR *src, *dest;
-	WT_DECL_ITEM(bbuf);
-	WT_DECL_RET;
-	WT_ITEM key, value;
 	WT_LSM_CHUNK *chunk;
-	const char *cur_cfg[] =
-	    API_CONF_DEFAULTS(session, open_cursor, "bulk,raw");
-	uint32_t generation;
-	uint64_t insert_count, record_count;
-	int create_bloom, dest_id, end_chunk, i;
-	int max_chunks, nchunks, start_chunk;
+	size_t chunk_sz;
+	int i, j, k, nchunks, pos;
+
+	chunk_sz = sizeof(*lsm_tree->chunk);
+	nchunks = lsm_tree->nchunks - ninputs + noutputs;
+	if (nchunks * chunk_sz > lsm_tree->chunk_alloc)
+		WT_RET(__wt_realloc(session, &lsm_tree->chunk_alloc,
+		    WT_MAX(nchunks * chunk_sz, 2 * lsm_tree->chunk_alloc),
+		    &lsm_tree->chunk));
+	if (retire)
+		WT_RET(__lsm_merge_retire(session, lsm_tree, inputs, ninputs));
+
+	/* Remove the merged chunks, noting where the first of them was. */
+	for (i = j = pos = 0; i < lsm_tree->nchunks; i++) {
+		chunk = lsm_tree->chunk[i];
+		if (chunk == inputs[0])
+			pos = j;
+		for (k = 0; k < ninputs && chunk != inputs[k]; k++)
+			;
+		if (k == ninputs)
+			lsm_tree->chunk[j++] = chunk;
+	}
+	if (lsm_tree->merge_policy == WT_LSM_MERGE_LEVELED)
+		for (pos = 0; pos < j &&
+		    lsm_tree->chunk[pos]->generation >= generation; pos++)
+			;
+
+	memmove(lsm_tree->chunk + pos + noutputs,
+	    lsm_tree->chunk + pos, (j - pos) * chunk_sz);
+	memcpy(lsm_tree->chunk + pos, outputs, noutputs * chunk_sz);
+	if (nchunks < lsm_tree->nchunks)
+		memset(lsm_tree->chunk + nchunks, 0,
+		    (lsm_tree->nchunks - nchunks) * chunk_sz);
+	lsm_tree->nchunks = nchunks;
+	lsm_tree->dsk_gen++;
+	__wt_lsm_tree_throttle(session, lsm_tree);
 
-	src = dest = NULL;
-	bloom = NULL;
-	max_chunks = (int)lsm_tree->merge_max;
-	create_bloom = 0;
+	return (0);
+}
 
-	/*
-	 * Take a copy of the latest chunk id. This value needs to be atomically
-	 * read. We need a copy, since other threads may alter the chunk count
-	 * while we are doing a merge.
-	 */
-	nchunks = lsm_tree->nchunks;
+/*
+ * __lsm_merge_tiered --
+ *	Choose the chunks for a merge with the tiered policy: a run of
+ *	adjacent chunks of similar sizes.
+ *	Must be called with the LSM lock held.
+ */
+static int
+__lsm_merge_tiered(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree,
+    int stalls, WT_LSM_CHUNK **chunks, int *nchunksp, int *minorp,
+    uint32_t *generationp)
+{
+	WT_LSM_CHUNK *chunk;
+	uint64_t record_count;
+	int end_chunk, i, max_chunks, nchunks, start_chunk;
 
-	/*
-	 * If there aren't any chunks to merge, or some of the chunks aren't
-	 * yet written, we're done.  A non-zero error indicates that the worker
-	 * should assume there is no work to do: if there are unwritten chunks,
-	 * the worker should write them immediately.
-	 */
-	if (nchunks <= 1)
-		return (WT_NOTFOUND);
+	max_chunks = (int)lsm_tree->merge_max;
 
 	/*
-	 * Use the lsm_tree lock to read the chunks (so no switches occur), but
-	 * avoid holding it while the merge is in progress: that may take a
-	 * long time.
+	 * Only include chunks that are stable on disk, and that aren't part
+	 * of a merge already running in another thread.
 	 */
-	__wt_spin_lock(session, &lsm_tree->lock);
-
-	/* Only include chunks that are stable on disk. */
+	nchunks = lsm_tree->nchunks;
 	end_chunk = nchunks - 1;
 	while (end_chunk > 0 &&
-	    !F_ISSET(lsm_tree->chunk[end_chunk], WT_LSM_CHUNK_ONDISK))
+	    (!F_ISSET(lsm_tree->chunk[end_chunk], WT_LSM_CHUNK_ONDISK) ||
+	    F_ISSET(lsm_tree->chunk[end_chunk], WT_LSM_CHUNK_MERGING)))
 		--end_chunk;
 
 	/*
@@ -122,13 +165,22 @@ __wt_lsm_merge(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, int stalls)
 	 *
 	 * Respect the configured limit on the number of chunks to merge: start
 	 * with the most recent set of chunks and work backwards until going
-	 * further becomes significantly less efficient.
+	 * further becomes significantly less efficient.  Stop at any chunk
+	 * another merge has claimed, merges never overlap.
 	 */
 	for (start_chunk = end_chunk + 1, record_count = 0;
 	    start_chunk > 0; ) {
 		chunk = lsm_tree->chunk[start_chunk - 1];
 		nchunks = end_chunk - start_chunk + 1;
 
+		/*
+		 * Chunks can be flushed out of order: stop at one that isn't
+		 * on disk yet.
+		 */
+		if (F_ISSET(chunk, WT_LSM_CHUNK_MERGING) ||
+		    !F_ISSET(chunk, WT_LSM_CHUNK_ONDISK))
+			break;
+
 		/*
 		 * If the next chunk is more than double the average size of
 		 * the chunks we have so far, stop.
@@ -147,7 +199,7 @@ __wt_lsm_merge(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, int stalls)
 		if (nchunks == max_chunks)
 			record_count -= lsm_tree->chunk[end_chunk--]->count;
 	}
-	__wt_spin_unlock(session, &lsm_tree->lock);
+	nchunks = end_chunk - start_chunk + 1;
 
 	WT_ASSERT(session, nchunks <= max_chunks);
 
@@ -155,88 +207,767 @@ __wt_lsm_merge(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, int stalls)
 	if (nchunks <= 1 || (stalls < 2 && nchunks < max_chunks / 2))
 		return (WT_NOTFOUND);
 
+	*generationp = 0;
+	for (i = 0; i < nchunks; i++) {
+		chunks[i] = lsm_tree->chunk[start_chunk + i];
+		if (chunks[i]->generation > *generationp)
+			*generationp = chunks[i]->generation;
+	}
+	++*generationp;
+	*nchunksp = nchunks;
+	*minorp = start_chunk != 0;
+	return (0);
+}
+
+/*
+ * __lsm_merge_extend --
+ *	Extend a range of keys to include a chunk.
+ */
+static int
+__lsm_merge_extend(WT_SESSION_IMPL *session,
+    WT_LSM_TREE *lsm_tree, WT_LSM_RANGE *range, WT_LSM_CHUNK *chunk)
+{
+	int cmp;
+
+	/* Chunks with unknown ranges could hold any key, unless empty. */
+	if (!F_ISSET(chunk, WT_LSM_CHUNK_RANGE)) {
+		if (chunk->count != 0) {
+			range->min = range->max = NULL;
+			range->empty = 0;
+		}
+		return (0);
+	}
+	if (range->empty) {
+		range->min = &chunk->key_min;
+		range->max = &chunk->key_max;
+		range->empty = 0;
+		return (0);
+	}
+	if (range->min != NULL) {
+		WT_RET(WT_LSM_CMP(
+		    session, lsm_tree, &chunk->key_min, range->min, cmp));
+		if (cmp < 0)
+			range->min = &chunk->key_min;
+	}
+	if (range->max != NULL) {
+		WT_RET(WT_LSM_CMP(
+		    session, lsm_tree, &chunk->key_max, range->max, cmp));
+		if (cmp > 0)
+			range->max = &chunk->key_max;
+	}
+	return (0);
+}
+
+/*
+ * __lsm_merge_overlap --
+ *	Check whether a chunk holds keys in a range.
+ */
+static int
+__lsm_merge_overlap(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree,
+    WT_LSM_RANGE *range, WT_LSM_CHUNK *chunk, int *overlapp)
+{
+	int cmp;
+
+	*overlapp = 0;
+	if (range->empty)
+		return (0);
+	if (!F_ISSET(chunk, WT_LSM_CHUNK_RANGE)) {
+		*overlapp = chunk->count != 0;
+		return (0);
+	}
+	if (range->max != NULL) {
+		WT_RET(WT_LSM_CMP(
+		    session, lsm_tree, &chunk->key_min, range->max, cmp));
+		if (cmp > 0)
+			return (0);
+	}
+	if (range->min != NULL) {
+		WT_RET(WT_LSM_CMP(
+		    session, lsm_tree, &chunk->key_max, range->min, cmp));
+		if (cmp < 0)
+			return (0);
+	}
+	*overlapp = 1;
+	return (0);
+}
+
+/*
+ * __lsm_merge_level --
+ *	Add the chunks in a level that overlap a set of newer chunks to the
+ *	start of the set.  If another merge has claimed any of them, clear
+ *	the set: the newer chunks can't be merged into the level yet.
+ *	Must be called with the LSM lock held.
+ */
+static int
+__lsm_merge_level(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree,
+    uint32_t level, WT_LSM_CHUNK **chunks, int *nchunksp)
+{
+	WT_LSM_CHUNK *chunk;
+	WT_LSM_RANGE range;
+	int i, noverlap, overlap, pass;
+
+	WT_CLEAR(range);
+	range.empty = 1;
+	for (i = 0; i < *nchunksp; i++)
+		WT_RET(__lsm_merge_extend(
+		    session, lsm_tree, &range, chunks[i]));
+
+	/*
+	 * Count the overlapping chunks, then make space for them and copy them
+	 * in: the level is older than the chunks being merged into it.
+	 */
+	for (pass = 0; pass < 2; pass++) {
+		for (i = noverlap = 0; i < lsm_tree->nchunks; i++) {
+			chunk = lsm_tree->chunk[i];
+			if (chunk->generation != level)
+				continue;
+			WT_RET(__lsm_merge_overlap(
+			    session, lsm_tree, &range, chunk, &overlap));
+			if (!overlap)
+				continue;
+			if (F_ISSET(chunk, WT_LSM_CHUNK_MERGING)) {
+				*nchunksp = 0;
+				return (0);
+			}
+			if (pass == 1)
+				chunks[noverlap] = chunk;
+			++noverlap;
+		}
+		if (pass == 0)
+			memmove(chunks + noverlap,
+			    chunks, *nchunksp * sizeof(*chunks));
+	}
+	*nchunksp += noverlap;
+	return (0);
+}
+
+/*
+ * __lsm_merge_leveled --
+ *	Choose the chunks for a merge with the leveled policy: a chunk and
+ *	the chunks it overlaps in the next level.
+ *
+ *	The chunks are sorted by level, deepest and oldest first, and the
+ *	chunks in a level other than level 0 have non-overlapping key ranges.
+ *	Level 0 holds the chunks written from memory, with overlapping key
+ *	ranges: they are merged into level 1 all together, oldest first, with
+ *	no other merge of level 0 running.  A deeper level holding more than
+ *	its share of chunks moves a chunk into the next level, choosing the
+ *	chunk that overlaps the fewest chunks there.
+ *
+ *	Must be called with the LSM lock held.
+ */
+static int
+__lsm_merge_leveled(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree,
+    int stalls, WT_LSM_CHUNK **chunks, int *nchunksp, int *minorp,
+    uint32_t *generationp)
+{
+	WT_LSM_CHUNK *chunk;
+	WT_LSM_RANGE range;
+	uint64_t capacity;
+	uint32_t generation, level;
+	int best, best_nchunks, first, i, nchunks, nlevel, overlap;
+
+	nchunks = 0;
+	generation = 1;
+
+	/* Find the on-disk chunks in level 0. */
+	for (first = 0; lsm_tree->chunk[first]->generation > 0; first++)
+		;
+	for (i = first; i < lsm_tree->nchunks &&
+	    nchunks < (int)lsm_tree->merge_max; i++) {
+		chunk = lsm_tree->chunk[i];
+		if (!F_ISSET(chunk, WT_LSM_CHUNK_ONDISK))
+			break;
+		if (F_ISSET(chunk, WT_LSM_CHUNK_MERGING)) {
+			nchunks = 0;
+			break;
+		}
+		chunks[nchunks++] = chunk;
+	}
+
+	/* Don't do small merges unless we have waited for 2s. */
+	if (nchunks > 1 &&
+	    (stalls >= 2 || nchunks >= (int)lsm_tree->merge_max / 2))
+		WT_RET(__lsm_merge_level(
+		    session, lsm_tree, generation, chunks, &nchunks));
+	else
+		nchunks = 0;
+
+	/* Look for a deeper level holding more than its share of chunks. */
+	for (level = 1, capacity = 1;
+	    nchunks == 0 && level <= lsm_tree->chunk[0]->generation;
+	    level++) {
+		for (first = 0;
+		    lsm_tree->chunk[first]->generation > level; first++)
+			;
+		for (nlevel = 0; first + nlevel < lsm_tree->nchunks &&
+		    lsm_tree->chunk[first + nlevel]->generation == level;
+		    nlevel++)
+			;
+		if (capacity < UINT64_MAX / WT_LSM_LEVEL_FANOUT)
+			capacity *= WT_LSM_LEVEL_FANOUT;
+		if ((uint64_t)nlevel <= capacity)
+			continue;
+
+		generation = level + 1;
+		for (best = -1, best_nchunks = 0, i = first;
+		    i < first + nlevel; i++) {
+			if (F_ISSET(lsm_tree->chunk[i], WT_LSM_CHUNK_MERGING))
+				continue;
+			chunks[0] = lsm_tree->chunk[i];
+			nchunks = 1;
+			WT_RET(__lsm_merge_level(
+			    session, lsm_tree, generation, chunks, &nchunks));
+			if (nchunks != 0 &&
+			    (best == -1 || nchunks < best_nchunks)) {
+				best = i;
+				best_nchunks = nchunks;
+			}
+		}
+		nchunks = 0;
+		if (best != -1) {
+			chunks[0] = lsm_tree->chunk[best];
+			nchunks = 1;
+			WT_RET(__lsm_merge_level(
+			    session, lsm_tree, generation, chunks, &nchunks));
+		}
+	}
+	if (nchunks == 0)
+		return (WT_NOTFOUND);
+
+	/*
+	 * The merge is minor, and must keep tombstones, if any deeper level
+	 * overlaps it.
+	 */
+	WT_CLEAR(range);
+	range.empty = 1;
+	for (i = 0; i < nchunks; i++)
+		WT_RET(__lsm_merge_extend(
+		    session, lsm_tree, &range, chunks[i]));
+	for (*minorp = 0, i = 0; i < lsm_tree->nchunks &&
+	    lsm_tree->chunk[i]->generation > generation; i++) {
+		WT_RET(__lsm_merge_overlap(
+		    session, lsm_tree, &range, lsm_tree->chunk[i], &overlap));
+		if (overlap) {
+			*minorp = 1;
+			break;
+		}
+	}
+
+	*nchunksp = nchunks;
+	*generationp = generation;
+	return (0);
+}
+
+/*
+ * __lsm_merge_clear --
+ *	Release the chunks claimed by a merge that didn't complete.
+ */
+static void
+__lsm_merge_clear(WT_SESSION_IMPL *session,
+    WT_LSM_TREE *lsm_tree, WT_LSM_CHUNK **chunks, int nchunks)
+{
+	int i;
+
+	__wt_spin_lock(session, &lsm_tree->lock);
+	for (i = 0; i < nchunks; i++)
+		F_CLR(chunks[i], WT_LSM_CHUNK_MERGING);
+	__wt_spin_unlock(session, &lsm_tree->lock);
+}
+
+/*
+ * __lsm_merge_chunk_create --
+ *	Create the file for a chunk written by a merge, and open a bulk cursor
+ *	on it.  Must be called with the schema lock held.
+ */
+static int
+__lsm_merge_chunk_create(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree,
+    int id, WT_LSM_CHUNK *chunk, int create_bloom, WT_CURSOR **destp)
+{
+	WT_DECL_ITEM(buf);
+	WT_DECL_RET;
+	const char *cur_cfg[] =
+	    API_CONF_DEFAULTS(session, open_cursor, "bulk,raw");
+
+	/*
+	 * Merges write each chunk once, in key order: turn on prefix
+	 * compression and a value dictionary unless the tree's configuration
+	 * says otherwise.
+	 */
+	WT_RET(__wt_scr_alloc(session, 0, &buf));
+	WT_ERR(__wt_buf_fmt(session, buf,
+	    "dictionary=%d,prefix_compression=true,%s",
+	    WT_LSM_MERGE_DICTIONARY, lsm_tree->file_config));
+	WT_ERR(__wt_lsm_tree_setup_chunk(
+	    session, lsm_tree, id, chunk, buf->data, create_bloom));
+	ret = __wt_open_cursor(session, chunk->uri, NULL, cur_cfg, destp);
+
+err:	__wt_scr_free(&buf);
+	return (ret);
+}
+
+/*
+ * __lsm_merge_chunk_open --
+ *	Create a chunk for the output of a merge.
+ */
+static int
+__lsm_merge_chunk_open(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree,
+    WT_LSM_CHUNK *chunk, uint64_t bloom_count,
+    WT_BLOOM **bloomp, WT_CURSOR **destp)
+{
+	WT_DECL_RET;
+	int dest_id;
+
 	/* Allocate an ID for the merge. */
 	dest_id = WT_ATOMIC_ADD(lsm_tree->last, 1);
 
+	WT_LSM_WITH_SCHEMA_LOCK(session,
+	    lsm_tree, WT_CONN_LSM_WORKERS, ret,
+	    ret = __lsm_merge_chunk_create(session,
+	    lsm_tree, dest_id, chunk, bloom_count != 0, destp));
+	WT_RET(ret);
+	if (bloom_count != 0)
+		WT_RET(__wt_bloom_create(session, chunk->bloom_uri,
+		    lsm_tree->bloom_config, bloom_count,
+		    lsm_tree->bloom_bit_count, lsm_tree->bloom_hash_count,
+		    bloomp));
+
+	return (0);
+}
+
+/*
+ * __lsm_merge_chunk_close --
+ *	Finish a chunk written by a merge.  The size is the bytes of keys and
+ *	values written, the measure leveled merges split their outputs by.
+ */
+static int
+__lsm_merge_chunk_close(WT_SESSION_IMPL *session,
+    WT_LSM_TREE *lsm_tree, WT_LSM_CHUNK *chunk, uint64_t count,
+    uint64_t size, WT_BLOOM **bloomp, WT_CURSOR **destp)
+{
+	WT_DECL_RET;
+
+	WT_TRET((*destp)->close(*destp));
+	*destp = NULL;
+	if (*bloomp != NULL) {
+		/* Writing the filter creates a file, that needs the lock. */
+		if (ret == 0)
+			WT_LSM_WITH_SCHEMA_LOCK(session,
+			    lsm_tree, WT_CONN_LSM_WORKERS, ret,
+			    ret = __wt_bloom_finalize(*bloomp));
+		WT_TRET(__wt_bloom_close(*bloomp));
+		*bloomp = NULL;
+		if (ret == 0)
+			F_SET(chunk, WT_LSM_CHUNK_BLOOM);
+	}
+	WT_RET(ret);
+
 	WT_VERBOSE_RET(session, lsm,
-	    "Merging chunks %d-%d into %d (%" PRIu64 " records)\n",
-	    start_chunk, end_chunk, dest_id, record_count);
+	    "Merge wrote %" PRIu64 " items to %s", count, chunk->uri);
+
+	chunk->count = count;
+	chunk->size = size;
+	F_SET(chunk, WT_LSM_CHUNK_ONDISK | WT_LSM_CHUNK_RANGE);
+	return (0);
+}
+
+/*
+ * __lsm_merge_older_close --
+ *	Discard the information about the chunks older than a merge.
+ */
+static int
+__lsm_merge_older_close(
+    WT_SESSION_IMPL *session, WT_LSM_OLDER *older, int nolder)
+{
+	WT_DECL_RET;
+	int i;
+
+	for (i = 0; i < nolder; i++) {
+		if (older[i].bloom != NULL)
+			WT_TRET(__wt_bloom_close(older[i].bloom));
+		__wt_free(session, older[i].bloom_uri);
+		__wt_buf_free(session, &older[i].key_min);
+		__wt_buf_free(session, &older[i].key_max);
+	}
+	__wt_free(session, older);
+	return (ret);
+}
+
+/*
+ * __lsm_merge_older_find --
+ *	Find the chunks older than a minor merge that overlap its keys.  Copy
+ *	the key ranges and Bloom filter names: a concurrent merge may replace
+ *	the older chunks, but its output holds no other keys.
+ *	Must be called with the LSM lock held.
+ */
+static int
+__lsm_merge_older_find(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree,
+    WT_LSM_CHUNK **chunks, int nchunks, WT_LSM_OLDER **olderp, int *nolderp)
+{
+	WT_DECL_RET;
+	WT_LSM_CHUNK *chunk;
+	WT_LSM_OLDER *o, *older;
+	WT_LSM_RANGE range;
+	int i, j, nolder, overlap;
+
+	*olderp = NULL;
+	*nolderp = nolder = 0;
+
+	WT_CLEAR(range);
+	range.empty = 1;
+	for (i = 0; i < nchunks; i++)
+		WT_RET(__lsm_merge_extend(
+		    session, lsm_tree, &range, chunks[i]));
+
+	/* The older chunks come before the first merged chunk. */
+	for (i = 0; i < lsm_tree->nchunks; i++) {
+		for (j = 0; j < nchunks; j++)
+			if (lsm_tree->chunk[i] == chunks[j])
+				break;
+		if (j < nchunks)
+			break;
+	}
+	if (i == 0)
+		return (0);
+	WT_RET(__wt_calloc_def(session, i, &older));
+
+	for (j = 0; j < i; j++) {
+		chunk = lsm_tree->chunk[j];
+		WT_ERR(__lsm_merge_overlap(
+		    session, lsm_tree, &range, chunk, &overlap));
+		if (!overlap)
+			continue;
+		o = &older[nolder++];
+		if (F_ISSET(chunk, WT_LSM_CHUNK_RANGE)) {
+			WT_ERR(__wt_buf_set(session, &o->key_min,
+			    chunk->key_min.data, chunk->key_min.size));
+			WT_ERR(__wt_buf_set(session, &o->key_max,
+			    chunk->key_max.data, chunk->key_max.size));
+			o->range = 1;
+		}
+		if (F_ISSET(chunk, WT_LSM_CHUNK_BLOOM))
+			WT_ERR(__wt_strdup(
+			    session, chunk->bloom_uri, &o->bloom_uri));
+	}
 
-	WT_RET(__wt_calloc_def(session, 1, &chunk));
+	*olderp = older;
+	*nolderp = nolder;
+	return (0);
 
-	if (FLD_ISSET(lsm_tree->bloom, WT_LSM_BLOOM_MERGED) &&
-	    (FLD_ISSET(lsm_tree->bloom, WT_LSM_BLOOM_OLDEST) ||
-	    start_chunk > 0) && record_count > 0)
-		create_bloom = 1;
+err:	WT_TRET(__lsm_merge_older_close(session, older, nolder));
+	return (ret);
+}
 
-	/* Find the merge generation. */
-	for (generation = 0, i = start_chunk; i < end_chunk; i++)
-		if (lsm_tree->chunk[i]->generation > generation)
-			generation = lsm_tree->chunk[i]->generation;
+/*
+ * __lsm_merge_older_bloom --
+ *	Open the Bloom filters of the chunks older than a merge.
+ *	Must be called with the schema lock held.
+ */
+static int
+__lsm_merge_older_bloom(WT_SESSION_IMPL *session,
+    WT_LSM_TREE *lsm_tree, WT_LSM_OLDER *older, int nolder)
+{
+	WT_DECL_RET;
+	WT_LSM_CHUNK *chunk;
+	int i, j;
+
+	/*
+	 * Don't wait for the tree's lock, a worker freeing chunks may hold it
+	 * while waiting for the schema lock.  Filters left closed only cost
+	 * deleted records the merge could have discarded.
+	 */
+	if (__wt_spin_trylock(session, &lsm_tree->lock) != 0)
+		return (0);
+
+	/*
+	 * Look the filters up by name: a chunk replaced since the older chunks
+	 * were found may be freed, its filter can't be used.  Holding the
+	 * filter open stops it being dropped.
+	 */
+	for (i = 0; i < nolder; i++, older++) {
+		if (older->bloom_uri == NULL)
+			continue;
+		for (chunk = NULL, j = 0; j < lsm_tree->nchunks; j++)
+			if (F_ISSET(lsm_tree->chunk[j], WT_LSM_CHUNK_BLOOM) &&
+			    strcmp(lsm_tree->chunk[j]->bloom_uri,
+			    older->bloom_uri) == 0) {
+				chunk = lsm_tree->chunk[j];
+				break;
+			}
+		if (chunk == NULL)
+			continue;
+		WT_ERR(__wt_bloom_open(session, chunk->bloom_uri,
+		    lsm_tree->bloom_bit_count, lsm_tree->bloom_hash_count,
+		    NULL, &chunk->bloom_mem, &older->bloom));
+	}
+
+err:	__wt_spin_unlock(session, &lsm_tree->lock);
+	return (ret);
+}
+
+/*
+ * __lsm_merge_older_search --
+ *	Check whether any chunk older than a merge could hold a key.
+ */
+static int
+__lsm_merge_older_search(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree,
+    WT_LSM_OLDER *older, int nolder, WT_ITEM *key, int *foundp)
+{
+	WT_DECL_RET;
+	int cmp, i;
+
+	*foundp = 0;
+	for (i = 0; i < nolder; i++, older++) {
+		if (older->range) {
+			WT_RET(WT_LSM_CMP(
+			    session, lsm_tree, key, &older->key_min, cmp));
+			if (cmp < 0)
+				continue;
+			WT_RET(WT_LSM_CMP(
+			    session, lsm_tree, key, &older->key_max, cmp));
+			if (cmp > 0)
+				continue;
+		}
+		if (older->bloom != NULL) {
+			if ((ret = __wt_bloom_get(older->bloom, key)) ==
+			    WT_NOTFOUND)
+				continue;
+			WT_RET(ret);
+		}
+		*foundp = 1;
+		break;
+	}
+	return (0);
+}
+
+/*
+ * __wt_lsm_merge --
+ *	Merge a set of chunks of an LSM tree.
+ */
+int
+__wt_lsm_merge(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, int stalls)
+{
+	WT_BLOOM *bloom;
+	WT_CURSOR *src, *dest;
+	WT_DECL_RET;
+	WT_ITEM key, value;
+	WT_LSM_CHUNK *chunk, **chunks, **outputs;
+	WT_LSM_OLDER *older;
+	struct timespec begin, end;
+	size_t outputs_alloc;
+	uint32_t generation;
+	uint64_t bloom_count, chunk_bytes, chunk_count, input_bytes;
+	uint64_t expect_count, insert_count, record_count, tombstone_count;
+	int claimed, create_bloom, found, i, leveled, minor;
+	int nchunks, nolder, noutputs;
+
+	src = dest = NULL;
+	bloom = NULL;
+	chunk = NULL;
+	chunks = outputs = NULL;
+	older = NULL;
+	outputs_alloc = 0;
+	generation = 0;
+	tombstone_count = 0;
+	claimed = minor = nchunks = nolder = noutputs = 0;
+	leveled = lsm_tree->merge_policy == WT_LSM_MERGE_LEVELED;
+
+	/*
+	 * If there aren't any chunks to merge, or some of the chunks aren't
+	 * yet written, we're done.  A non-zero error indicates that the worker
+	 * should assume there is no work to do: if there are unwritten chunks,
+	 * the worker should write them immediately.
+	 */
+	if (lsm_tree->nchunks <= 1)
+		return (WT_NOTFOUND);
+
+	WT_RET(__wt_epoch(session, &begin));
+
+	/*
+	 * Use the lsm_tree lock to read the chunks (so no switches occur), but
+	 * avoid holding it while the merge is in progress: that may take a
+	 * long time.
+	 */
+	__wt_spin_lock(session, &lsm_tree->lock);
+	if ((ret = __wt_calloc_def(session, lsm_tree->nchunks, &chunks)) == 0)
+		ret = leveled ?
+		    __lsm_merge_leveled(session, lsm_tree,
+		    stalls, chunks, &nchunks, &minor, &generation) :
+		    __lsm_merge_tiered(session, lsm_tree,
+		    stalls, chunks, &nchunks, &minor, &generation);
+
+	/*
+	 * A chunk moving to the next level without overlapping any chunks
+	 * there doesn't need to be rewritten.
+	 */
+	if (ret == 0 && leveled && nchunks == 1) {
+		chunk = chunks[0];
+		chunk->generation = generation;
+		if ((ret = __lsm_merge_install(session, lsm_tree,
+		    chunks, 1, chunks, 1, generation, 0)) == 0)
+			ret = __wt_lsm_meta_write(session, lsm_tree);
+		__wt_spin_unlock(session, &lsm_tree->lock);
+		WT_ERR(ret);
+		WT_VERBOSE_ERR(session, lsm,
+		    "Moved %s to level %" PRIu32, chunk->uri, generation);
+		goto err;
+	}
+
+	/*
+	 * Claim the chunks so concurrent merges choose others.  Other merges
+	 * may complete and move the chunks in the array before this one is
+	 * done: remember the chunks rather than their positions.
+	 */
+	for (i = 0, input_bytes = record_count = 0;
+	    ret == 0 && i < nchunks; i++) {
+		F_SET(chunks[i], WT_LSM_CHUNK_MERGING);
+		input_bytes += chunks[i]->size;
+		record_count += chunks[i]->count;
+	}
+	claimed = (ret == 0);
+
+	/*
+	 * A minor merge must keep deleted records, unless no older chunk could
+	 * hold their keys.
+	 */
+	if (ret == 0 && minor)
+		ret = __lsm_merge_older_find(
+		    session, lsm_tree, chunks, nchunks, &older, &nolder);
+	__wt_spin_unlock(session, &lsm_tree->lock);
+	WT_ERR(ret);
+
+	/*
+	 * Open the older chunks' Bloom filters after releasing the tree's
+	 * lock: waiting for the schema lock holding it stalls the tree.
+	 */
+	if (nolder != 0) {
+		WT_LSM_WITH_SCHEMA_LOCK(session,
+		    lsm_tree, WT_CONN_LSM_WORKERS, ret,
+		    ret = __lsm_merge_older_bloom(
+		    session, lsm_tree, older, nolder));
+		WT_ERR(ret);
+	}
+
+	WT_VERBOSE_ERR(session, lsm,
+	    "Merging %d chunks into generation %" PRIu32
+	    " (%" PRIu64 " records)\n", nchunks, generation, record_count);
+
+	create_bloom = FLD_ISSET(lsm_tree->bloom, WT_LSM_BLOOM_MERGED) &&
+	    (FLD_ISSET(lsm_tree->bloom, WT_LSM_BLOOM_OLDEST) || minor) &&
+	    record_count > 0;
 
 	/*
 	 * Special setup for the merge cursor:
 	 * first, reset to open the dependent cursors;
-	 * then restrict the cursor to a specific number of chunks;
+	 * then restrict the cursor to a specific set of chunks;
 	 * then set MERGE so the cursor doesn't track updates to the tree.
 	 */
 	WT_ERR(__wt_open_cursor(session, lsm_tree->name, NULL, NULL, &src));
 	F_SET(src, WT_CURSTD_RAW);
-	WT_ERR(__wt_clsm_init_merge(src, start_chunk, nchunks));
-
-	WT_WITH_SCHEMA_LOCK(session, ret = __wt_lsm_tree_setup_chunk(
-	    session, lsm_tree, dest_id, chunk, create_bloom));
-	WT_ERR(ret);
-	if (create_bloom)
-		WT_ERR(__wt_bloom_create(session, chunk->bloom_uri,
-		    lsm_tree->bloom_config,
-		    record_count, lsm_tree->bloom_bit_count,
-		    lsm_tree->bloom_hash_count, &bloom));
-
-	WT_ERR(__wt_open_cursor(session, chunk->uri, NULL, cur_cfg, &dest));
+	WT_ERR(__wt_clsm_init_merge(src, chunks, nchunks, minor));
 
-	for (insert_count = 0; (ret = src->next(src)) == 0; insert_count++) {
-		if (insert_count % 1000 &&
-		    !F_ISSET(lsm_tree, WT_LSM_TREE_WORKING)) {
+	/*
+	 * With the leveled policy, split the output into chunks of about the
+	 * configured chunk size, so later merges only rewrite the chunks they
+	 * overlap.  Outputs are created as the merge needs them.
+	 */
+	for (insert_count = chunk_bytes = chunk_count = 0;
+	    (ret = src->next(src)) == 0;) {
+		if (insert_count % 1000 == 0 &&
+		    !WT_LSM_MERGE_RUN(session, lsm_tree)) {
 			ret = EINTR;
 			goto err;
 		}
 		WT_ERR(src->get_key(src, &key));
-		dest->set_key(dest, &key);
 		WT_ERR(src->get_value(src, &value));
+		if (minor && value.size == 0) {
+			WT_ERR(__lsm_merge_older_search(session,
+			    lsm_tree, older, nolder, &key, &found));
+			if (!found) {
+				++tombstone_count;
+				continue;
+			}
+		}
+		if (dest == NULL) {
+			if ((noutputs + 1) * sizeof(*outputs) > outputs_alloc)
+				WT_ERR(__wt_realloc(session, &outputs_alloc,
+				    WT_MAX(10 * sizeof(*outputs),
+				    2 * outputs_alloc), &outputs));
+			WT_ERR(__wt_calloc_def(session, 1, &chunk));
+			outputs[noutputs++] = chunk;
+			chunk->generation = generation;
+
+			/*
+			 * Size Bloom filters for the records left to merge.
+			 * A leveled output ends at the configured chunk size:
+			 * expect the records per byte of the merge's inputs,
+			 * plus a quarter for error.
+			 */
+			bloom_count = 0;
+			if (create_bloom) {
+				bloom_count = record_count > insert_count ?
+				    record_count - insert_count : chunk_count;
+				if (leveled && input_bytes != 0) {
+					expect_count = record_count *
+					    lsm_tree->chunk_size / input_bytes;
+					expect_count += expect_count / 4 + 1;
+					bloom_count =
+					    WT_MIN(bloom_count, expect_count);
+				}
+			}
+			WT_ERR(__lsm_merge_chunk_open(session,
+			    lsm_tree, chunk, bloom_count, &bloom, &dest));
+			WT_ERR(__wt_buf_set(session,
+			    &chunk->key_min, key.data, key.size));
+			chunk_bytes = chunk_count = 0;
+		}
+		dest->set_key(dest, &key);
 		dest->set_value(dest, &value);
 		WT_ERR(dest->insert(dest));
-		if (create_bloom)
+		if (bloom != NULL)
 			WT_ERR(__wt_bloom_insert(bloom, &key));
+		WT_ERR(__wt_buf_set(session,
+		    &chunk->key_max, key.data, key.size));
+
+		++chunk_count;
+		++insert_count;
+		chunk_bytes += key.size + value.size;
+		if (leveled && chunk_bytes >= lsm_tree->chunk_size)
+			WT_ERR(__lsm_merge_chunk_close(session, lsm_tree,
+			    chunk, chunk_count, chunk_bytes, &bloom, &dest));
 	}
-	WT_VERBOSE_ERR(session, lsm,
-	    "Bloom size for %" PRIu64 " has %" PRIu64 " items inserted.",
-	    record_count, insert_count);
 	WT_ERR_NOTFOUND_OK(ret);
-
-	/* We've successfully created the new chunk.  Now install it. */
-	WT_TRET(src->close(src));
-	WT_TRET(dest->close(dest));
-	src = dest = NULL;
-	if (create_bloom) {
-		WT_TRET(__wt_bloom_finalize(bloom));
-		WT_TRET(__wt_bloom_close(bloom));
-		bloom = NULL;
-	}
+	WT_VERBOSE_ERR(session, lsm,
+	    "Merge of %" PRIu64 " records inserted %" PRIu64 " in %d chunks",
+	    record_count, insert_count, noutputs);
+
+	/* We've successfully created the new chunks.  Now install them. */
+	WT_ERR(src->close(src));
+	src = NULL;
+	ret = __lsm_merge_older_close(session, older, nolder);
+	older = NULL;
+	nolder = 0;
 	WT_ERR(ret);
+	if (dest != NULL)
+		WT_ERR(__lsm_merge_chunk_close(session, lsm_tree,
+		    chunk, chunk_count, chunk_bytes, &bloom, &dest));
 
 	__wt_spin_lock(session, &lsm_tree->lock);
-	ret = __wt_lsm_merge_update_tree(
-	    session, lsm_tree, start_chunk, nchunks, chunk);
-
-	if (create_bloom)
-		F_SET(chunk, WT_LSM_CHUNK_BLOOM);
-	chunk->count = insert_count;
-	chunk->generation = ++generation;
-	F_SET(chunk, WT_LSM_CHUNK_ONDISK);
-
-	ret = __wt_lsm_meta_write(session, lsm_tree);
+	if ((ret = __lsm_merge_install(session, lsm_tree,
+	    chunks, nchunks, outputs, noutputs, generation, 1)) == 0) {
+		/* The tree owns the new chunks, and the merged chunks. */
+		claimed = noutputs = 0;
+		ret = __wt_lsm_meta_write(session, lsm_tree);
+	}
 	__wt_spin_unlock(session, &lsm_tree->lock);
+	WT_ERR(ret);
+
+	if (__wt_epoch(session, &end) == 0)
+		WT_STAT_INCRV(lsm_tree->stats,
+		    merge_usecs, WT_TIMEDIFF(end, begin) / 1000);
+	WT_STAT_INCR(lsm_tree->stats, merge_count);
+	WT_STAT_INCRV(lsm_tree->stats, merge_rows, insert_count);
+	WT_STAT_INCRV(lsm_tree->stats, merge_tombstones, tombstone_count);
 
 err:	if (src != NULL)
 		WT_TRET(src->close(src));
@@ -244,19 +975,20 @@ err:	if (src != NULL)
 		WT_TRET(dest->close(dest));
 	if (bloom != NULL)
 		WT_TRET(__wt_bloom_close(bloom));
-	__wt_scr_free(&bbuf);
-	if (ret != 0) {
-		/*
-		 * Ideally we would drop the new chunk on error, but that
-		 * introduces potential deadlock problems. It is relatively
-		 * harmless to leave the file - it does not interfere
-		 * with later re-use.
-		WT_WITH_SCHEMA_LOCK(session,
-		    (void)__wt_schema_drop(session, chunk->uri, NULL));
-		 */
-		__wt_free(session, chunk->bloom_uri);
-		__wt_free(session, chunk->uri);
-		__wt_free(session, chunk);
+	if (older != NULL)
+		WT_TRET(__lsm_merge_older_close(session, older, nolder));
+	if (claimed)
+		__lsm_merge_clear(session, lsm_tree, chunks, nchunks);
+	/*
+	 * Ideally we would drop the new chunks on error, but that introduces
+	 * potential deadlock problems.  It is relatively harmless to leave the
+	 * files - they do not interfere with later re-use.
+	 */
+	for (i = 0; i < noutputs; i++)
+		__wt_lsm_chunk_free(session, outputs[i]);
+	__wt_free(session, outputs);
+	__wt_free(session, chunks);
+	if (ret != 0 && ret != WT_NOTFOUND) {
 		if (ret == EINTR)
 			WT_VERBOSE_VOID(session, lsm,
 			    "Merge aborted due to close");
@@ -55,6 +55,19 @@ __wt_lsm_meta_read(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 			lsm_tree->chunk_size = (uint32_t)cv.val;
 		else if (WT_STRING_MATCH("lsm_merge_max", ck.str, ck.len))
 			lsm_tree->merge_max = (uint32_t)cv.val;
+		else if (WT_STRING_MATCH("lsm_merge_policy", ck.str, ck.len))
+			lsm_tree->merge_policy =
+			    WT_STRING_MATCH("leveled", cv.str, cv.len) ?
+			    WT_LSM_MERGE_LEVELED : WT_LSM_MERGE_TIERED;
+		else if (WT_STRING_MATCH("lsm_stall_chunks", ck.str, ck.len))
+			lsm_tree->stall_chunks = (uint32_t)cv.val;
+		else if (WT_STRING_MATCH("lsm_stall_size", ck.str, ck.len))
+			lsm_tree->stall_size = (uint64_t)cv.val;
+		else if (WT_STRING_MATCH(
+		    "lsm_throttle_chunks", ck.str, ck.len))
+			lsm_tree->throttle_chunks = (uint32_t)cv.val;
+		else if (WT_STRING_MATCH("lsm_throttle_size", ck.str, ck.len))
+			lsm_tree->throttle_size = (uint64_t)cv.val;
 		else if (WT_STRING_MATCH("last", ck.str, ck.len))
 			lsm_tree->last = (int)cv.val;
 		else if (WT_STRING_MATCH("chunks", ck.str, ck.len)) {
@@ -72,11 +85,28 @@ __wt_lsm_meta_read(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 					chunk->count = lv.val;
 					continue;
 				}
+				if (WT_STRING_MATCH("size", lk.str, lk.len)) {
+					chunk->size = lv.val;
+					continue;
+				}
 				if (WT_STRING_MATCH(
 				    "generation", lk.str, lk.len)) {
 					chunk->generation = (uint32_t)lv.val;
 					continue;
 				}
+				if (WT_STRING_MATCH(
+				    "key_min", lk.str, lk.len)) {
+					WT_ERR(__wt_nhex_to_raw(session,
+					    lv.str, lv.len, &chunk->key_min));
+					F_SET(chunk, WT_LSM_CHUNK_RANGE);
+					continue;
+				}
+				if (WT_STRING_MATCH(
+				    "key_max", lk.str, lk.len)) {
+					WT_ERR(__wt_nhex_to_raw(session,
+					    lv.str, lv.len, &chunk->key_max));
+					continue;
+				}
 				if ((nchunks + 1) * chunk_sz >
 				    lsm_tree->chunk_alloc)
 					WT_ERR(__wt_realloc(session,
@@ -146,11 +176,13 @@ int
 __wt_lsm_meta_write(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 {
 	WT_DECL_ITEM(buf);
+	WT_DECL_ITEM(hex);
 	WT_DECL_RET;
 	WT_LSM_CHUNK *chunk;
 	int first, i;
 
 	WT_RET(__wt_scr_alloc(session, 0, &buf));
+	WT_ERR(__wt_scr_alloc(session, 0, &hex));
 	WT_ERR(__wt_buf_fmt(session, buf,
 	    "bloom_config=(%s),file_config=(%s),key_format=%s,value_format=%s",
 	    lsm_tree->bloom_config, lsm_tree->file_config,
@@ -162,20 +194,42 @@ __wt_lsm_meta_write(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 	    lsm_tree->last, (uint64_t)lsm_tree->chunk_size,
 	    lsm_tree->merge_max, lsm_tree->bloom,
 	    lsm_tree->bloom_bit_count, lsm_tree->bloom_hash_count));
+	WT_ERR(__wt_buf_catfmt(session, buf, ",lsm_merge_policy=%s",
+	    lsm_tree->merge_policy == WT_LSM_MERGE_LEVELED ?
+	    "leveled" : "tiered"));
+	WT_ERR(__wt_buf_catfmt(session, buf,
+	    ",lsm_stall_chunks=%" PRIu32 ",lsm_stall_size=%" PRIu64
+	    ",lsm_throttle_chunks=%" PRIu32 ",lsm_throttle_size=%" PRIu64,
+	    lsm_tree->stall_chunks, lsm_tree->stall_size,
+	    lsm_tree->throttle_chunks, lsm_tree->throttle_size));
 	WT_ERR(__wt_buf_catfmt(session, buf, ",chunks=["));
 	for (i = 0; i < lsm_tree->nchunks; i++) {
 		chunk = lsm_tree->chunk[i];
 		if (i > 0)
 			WT_ERR(__wt_buf_catfmt(session, buf, ","));
 		WT_ERR(__wt_buf_catfmt(session, buf, "\"%s\"", chunk->uri));
-		if (chunk->bloom_uri != NULL)
+		/* Chunks can be written without their Bloom filter. */
+		if (F_ISSET(chunk, WT_LSM_CHUNK_BLOOM))
 			WT_ERR(__wt_buf_catfmt(
 			    session, buf, ",bloom=\"%s\"", chunk->bloom_uri));
 		if (chunk->count != 0)
 			WT_ERR(__wt_buf_catfmt(
 			    session, buf, ",count=%" PRIu64, chunk->count));
+		if (chunk->size != 0)
+			WT_ERR(__wt_buf_catfmt(
+			    session, buf, ",size=%" PRIu64, chunk->size));
 		WT_ERR(__wt_buf_catfmt(
 		    session, buf, ",generation=%" PRIu32, chunk->generation));
+		if (F_ISSET(chunk, WT_LSM_CHUNK_RANGE)) {
+			WT_ERR(__wt_raw_to_hex(session, chunk->key_min.data,
+			    chunk->key_min.size, hex));
+			WT_ERR(__wt_buf_catfmt(session, buf,
+			    ",key_min=\"%s\"", (const char *)hex->data));
+			WT_ERR(__wt_raw_to_hex(session, chunk->key_max.data,
+			    chunk->key_max.size, hex));
+			WT_ERR(__wt_buf_catfmt(session, buf,
+			    ",key_max=\"%s\"", (const char *)hex->data));
+		}
 	}
 	WT_ERR(__wt_buf_catfmt(session, buf, "]"));
 	WT_ERR(__wt_buf_catfmt(session, buf, ",old_chunks=["));
@@ -189,7 +243,7 @@ __wt_lsm_meta_write(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 		else
 			WT_ERR(__wt_buf_catfmt(session, buf, ","));
 		WT_ERR(__wt_buf_catfmt(session, buf, "\"%s\"", chunk->uri));
-		if (chunk->bloom_uri != NULL)
+		if (F_ISSET(chunk, WT_LSM_CHUNK_BLOOM))
 			WT_ERR(__wt_buf_catfmt(
 			    session, buf, ",bloom=\"%s\"", chunk->bloom_uri));
 	}
@@ -200,5 +254,6 @@ __wt_lsm_meta_write(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 	WT_ERR(ret);
 
 err:	__wt_scr_free(&buf);
+	__wt_scr_free(&hex);
 	return (ret);
 }
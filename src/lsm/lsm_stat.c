@@ -52,6 +52,12 @@ __wt_lsm_stat_init(
 
 	/* Set the stats for this run. */
 	WT_STAT_SET(lsm_tree->stats, chunk_count, lsm_tree->nchunks);
+	WT_STAT_SET(
+	    lsm_tree->stats, unmerged_chunks, lsm_tree->unmerged_chunks);
+	WT_STAT_SET(lsm_tree->stats, unmerged_size, lsm_tree->unmerged_size);
+	WT_STAT_SET(lsm_tree->stats, write_stalled, lsm_tree->throttle_stall);
+	WT_STAT_SET(
+	    lsm_tree->stats, write_throttle_delay, lsm_tree->throttle_sleep);
 	for (i = 0; i < lsm_tree->nchunks; i++) {
 		chunk = lsm_tree->chunk[i];
 		if (chunk->generation >
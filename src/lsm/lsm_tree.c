@@ -10,6 +10,25 @@
 static int __lsm_tree_open_check(WT_SESSION_IMPL *, WT_LSM_TREE *);
 static int __lsm_tree_open(WT_SESSION_IMPL *, const char *, WT_LSM_TREE **);
 
+/*
+ * __wt_lsm_chunk_free --
+ *	Free an LSM chunk structure.
+ */
+void
+__wt_lsm_chunk_free(WT_SESSION_IMPL *session, WT_LSM_CHUNK *chunk)
+{
+	__wt_bloom_mem_free(session, &chunk->bloom_mem);
+	if (chunk->bloom_build != NULL) {
+		chunk->bloom_build->session = session;
+		(void)__wt_bloom_close(chunk->bloom_build);
+	}
+	__wt_free(session, chunk->bloom_uri);
+	__wt_free(session, chunk->uri);
+	__wt_buf_free(session, &chunk->key_min);
+	__wt_buf_free(session, &chunk->key_max);
+	__wt_free(session, chunk);
+}
+
 /*
  * __lsm_tree_discard --
  *	Free an LSM tree structure.
@@ -37,24 +56,14 @@ __lsm_tree_discard(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 	__wt_free(session, lsm_tree->stats);
 	__wt_spin_destroy(session, &lsm_tree->lock);
 
-	for (i = 0; i < lsm_tree->nchunks; i++) {
-		if ((chunk = lsm_tree->chunk[i]) == NULL)
-			continue;
-
-		__wt_free(session, chunk->bloom_uri);
-		__wt_free(session, chunk->uri);
-		__wt_free(session, chunk);
-	}
+	for (i = 0; i < lsm_tree->nchunks; i++)
+		if ((chunk = lsm_tree->chunk[i]) != NULL)
+			__wt_lsm_chunk_free(session, chunk);
 	__wt_free(session, lsm_tree->chunk);
 
-	for (i = 0; i < lsm_tree->nold_chunks; i++) {
-		if ((chunk = lsm_tree->old_chunks[i]) == NULL)
-			continue;
-
-		__wt_free(session, chunk->bloom_uri);
-		__wt_free(session, chunk->uri);
-		__wt_free(session, chunk);
-	}
+	for (i = 0; i < lsm_tree->nold_chunks; i++)
+		if ((chunk = lsm_tree->old_chunks[i]) != NULL)
+			__wt_lsm_chunk_free(session, chunk);
 	__wt_free(session, lsm_tree->old_chunks);
 	__wt_free(session, lsm_tree);
 }
@@ -66,51 +75,18 @@ __lsm_tree_discard(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 static int
 __lsm_tree_close(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 {
-	WT_DECL_RET;
-	WT_SESSION *wt_session;
-
-	if (F_ISSET(lsm_tree, WT_LSM_TREE_WORKING)) {
-		F_CLR(lsm_tree, WT_LSM_TREE_WORKING);
-		if (F_ISSET(S2C(session), WT_CONN_LSM_MERGE))
-			WT_TRET(__wt_thread_join(lsm_tree->worker_tid));
-		WT_TRET(__wt_thread_join(lsm_tree->ckpt_tid));
-	}
+	F_CLR(lsm_tree, WT_LSM_TREE_WORKING);
 
 	/*
-	 * Close the worker thread sessions and free their hazard arrays
-	 * (necessary because we set WT_SESSION_INTERNAL to simplify shutdown
-	 * ordering.
-	 *
-	 * Do this in the main thread to avoid deadlocks.
+	 * Discard the tree's chunks waiting to be flushed, and wait for the
+	 * flush workers to leave the tree: work in progress notices the tree
+	 * is no longer working and gives up.  Merge workers hold a reference
+	 * to the tree, there are none once the caller has it exclusively or
+	 * the workers have stopped.
 	 */
-	if (lsm_tree->worker_session != NULL) {
-		F_SET(lsm_tree->worker_session,
-		    F_ISSET(session, WT_SESSION_SCHEMA_LOCKED));
-
-		wt_session = &lsm_tree->worker_session->iface;
-		WT_TRET(wt_session->close(wt_session, NULL));
-
-		/*
-		 * This is safe after the close because session handles are
-		 * not freed, but are managed by the connection.
-		 */
-		__wt_free(NULL, lsm_tree->worker_session->hazard);
-	}
-	if (lsm_tree->ckpt_session != NULL) {
-		F_SET(lsm_tree->ckpt_session,
-		    F_ISSET(session, WT_SESSION_SCHEMA_LOCKED));
-
-		wt_session = &lsm_tree->ckpt_session->iface;
-		WT_TRET(wt_session->close(wt_session, NULL));
-
-		/*
-		 * This is safe after the close because session handles are
-		 * not freed, but are managed by the connection.
-		 */
-		__wt_free(NULL, lsm_tree->ckpt_session->hazard);
-	}
+	__wt_lsm_flush_purge(session, lsm_tree);
 
-	return (ret);
+	return (0);
 }
 
 /*
@@ -123,6 +99,13 @@ __wt_lsm_tree_close_all(WT_SESSION_IMPL *session)
 	WT_DECL_RET;
 	WT_LSM_TREE *lsm_tree;
 
+	/*
+	 * Stop the workers first: the merge workers walk the list of trees,
+	 * and the flush workers have chunks from the trees queued.
+	 */
+	WT_TRET(__wt_lsm_merge_workers_stop(session));
+	WT_TRET(__wt_lsm_flush_workers_stop(session));
+
 	while ((lsm_tree = TAILQ_FIRST(&S2C(session)->lsmqh)) != NULL) {
 		WT_TRET(__lsm_tree_close(session, lsm_tree));
 		__lsm_tree_discard(session, lsm_tree);
@@ -159,11 +142,12 @@ __wt_lsm_tree_chunk_name(
 
 /*
  * __wt_lsm_tree_setup_chunk --
- *	Initialize a chunk of an LSM tree.
+ *	Initialize a chunk of an LSM tree.  The chunk's file is created with
+ *	the given configuration, or the tree's file configuration if NULL.
  */
 int
-__wt_lsm_tree_setup_chunk(WT_SESSION_IMPL *session,
-    WT_LSM_TREE *lsm_tree, int i, WT_LSM_CHUNK *chunk, int create_bloom)
+__wt_lsm_tree_setup_chunk(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree,
+    int i, WT_LSM_CHUNK *chunk, const char *config, int create_bloom)
 {
 	WT_DECL_ITEM(buf);
 	WT_DECL_ITEM(bbuf);
@@ -183,7 +167,8 @@ __wt_lsm_tree_setup_chunk(WT_SESSION_IMPL *session,
 	 */
 	if (i > 1)
 		WT_ERR(__wt_schema_drop(session, buf->data, cfg));
-	WT_ERR(__wt_schema_create(session, buf->data, lsm_tree->file_config));
+	WT_ERR(__wt_schema_create(session, buf->data,
+	    config == NULL ? lsm_tree->file_config : config));
 	chunk->uri = __wt_buf_steal(session, buf, NULL);
 	if (create_bloom) {
 		WT_ERR(__wt_scr_alloc(session, 0, &bbuf));
@@ -198,32 +183,43 @@ err:	__wt_scr_free(&buf);
 }
 
 /*
- * __wt_lsm_start_worker --
- *	Start the worker thread for an LSM tree.
+ * __lsm_tree_start_worker --
+ *	Start work in an LSM tree: queue any chunks that were not written to
+ *	disk before the tree was last closed, and start the connection's
+ *	pools of workers if they aren't already running.
  */
 static int
 __lsm_tree_start_worker(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 {
-	WT_CONNECTION *wt_conn;
-	WT_SESSION *wt_session;
+	WT_CONNECTION_IMPL *conn;
+	struct timespec now;
+	int i;
 
-	wt_conn = &S2C(session)->iface;
-	WT_RET(wt_conn->open_session(wt_conn, NULL, NULL, &wt_session));
-	lsm_tree->worker_session = (WT_SESSION_IMPL *)wt_session;
-	F_SET(lsm_tree->worker_session, WT_SESSION_INTERNAL);
+	conn = S2C(session);
 
-	WT_RET(wt_conn->open_session(wt_conn, NULL, NULL, &wt_session));
-	lsm_tree->ckpt_session = (WT_SESSION_IMPL *)wt_session;
-	F_SET(lsm_tree->ckpt_session, WT_SESSION_INTERNAL);
+	/* Merges are timed from when the tree starts working. */
+	WT_RET(__wt_epoch(session, &now));
+	lsm_tree->merge_progress = (uint64_t)now.tv_sec;
 
 	F_SET(lsm_tree, WT_LSM_TREE_WORKING);
-	/* The new thread will rely on the WORKING value being visible. */
+	/* The workers will rely on the WORKING value being visible. */
 	WT_FULL_BARRIER();
-	if (F_ISSET(S2C(session), WT_CONN_LSM_MERGE))
-		WT_RET(__wt_thread_create(
-		    &lsm_tree->worker_tid, __wt_lsm_worker, lsm_tree));
-	WT_RET(__wt_thread_create(
-	    &lsm_tree->ckpt_tid, __wt_lsm_checkpoint_worker, lsm_tree));
+
+	/* All of the chunks but the newest are read-only. */
+	for (i = 0; i < lsm_tree->nchunks - 1; i++)
+		if (!F_ISSET(lsm_tree->chunk[i], WT_LSM_CHUNK_ONDISK))
+			WT_RET(__wt_lsm_flush_queue(
+			    session, lsm_tree, lsm_tree->chunk[i]));
+
+	/*
+	 * Flushes and merges are done by pools of threads shared by all of the
+	 * trees, start them when the first tree is opened.
+	 */
+	if (!F_ISSET(conn, WT_CONN_LSM_FLUSHERS))
+		WT_RET(__wt_lsm_flush_workers_start(session));
+	if (F_ISSET(conn, WT_CONN_LSM_MERGE) &&
+	    !F_ISSET(conn, WT_CONN_LSM_WORKERS))
+		WT_RET(__wt_lsm_merge_workers_start(session));
 
 	return (0);
 }
@@ -306,6 +302,18 @@ __wt_lsm_tree_create(WT_SESSION_IMPL *session,
 	lsm_tree->chunk_size = (uint32_t)cval.val;
 	WT_ERR(__wt_config_gets(session, cfg, "lsm_merge_max", &cval));
 	lsm_tree->merge_max = (uint32_t)cval.val;
+	WT_ERR(__wt_config_gets(session, cfg, "lsm_merge_policy", &cval));
+	lsm_tree->merge_policy =
+	    WT_STRING_MATCH("leveled", cval.str, cval.len) ?
+	    WT_LSM_MERGE_LEVELED : WT_LSM_MERGE_TIERED;
+	WT_ERR(__wt_config_gets(session, cfg, "lsm_stall_chunks", &cval));
+	lsm_tree->stall_chunks = (uint32_t)cval.val;
+	WT_ERR(__wt_config_gets(session, cfg, "lsm_stall_size", &cval));
+	lsm_tree->stall_size = (uint64_t)cval.val;
+	WT_ERR(__wt_config_gets(session, cfg, "lsm_throttle_chunks", &cval));
+	lsm_tree->throttle_chunks = (uint32_t)cval.val;
+	WT_ERR(__wt_config_gets(session, cfg, "lsm_throttle_size", &cval));
+	lsm_tree->throttle_size = (uint64_t)cval.val;
 
 	WT_ERR(__wt_scr_alloc(session, 0, &buf));
 	WT_ERR(__wt_buf_fmt(session, buf,
@@ -400,6 +408,7 @@ __lsm_tree_open(
 
 	if (lsm_tree->nchunks == 0)
 		WT_ERR(__wt_lsm_tree_switch(session, lsm_tree));
+	__wt_lsm_tree_throttle(session, lsm_tree);
 
 	/* Set the generation number so cursors are opened on first usage. */
 	lsm_tree->dsk_gen = 1;
@@ -456,6 +465,38 @@ __wt_lsm_tree_release(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 	WT_ATOMIC_SUB(lsm_tree->refcnt, 1);
 }
 
+/*
+ * __lsm_tree_bloom_build --
+ *	Start the Bloom filter for a new in-memory chunk, so writes can fill
+ *	it in and the chunk needn't be scanned when it's written to disk.
+ *	The filter is sized from the records per byte of the newest chunk
+ *	written from memory, with some room to spare: a chunk that ends up
+ *	with more records is scanned after all.
+ */
+static int
+__lsm_tree_bloom_build(
+    WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, WT_LSM_CHUNK *chunk)
+{
+	WT_LSM_CHUNK *prev;
+	uint64_t records;
+	int i;
+
+	for (i = lsm_tree->nchunks - 2; i >= 0; i--) {
+		prev = lsm_tree->chunk[i];
+		if (prev->generation == 0 &&
+		    prev->count != 0 && prev->size != 0)
+			break;
+	}
+	if (i < 0)
+		return (0);
+
+	records = prev->count * lsm_tree->chunk_size / prev->size;
+	records += records / 4;
+	return (__wt_bloom_create(session, chunk->bloom_uri,
+	    lsm_tree->bloom_config, records, lsm_tree->bloom_bit_count,
+	    lsm_tree->bloom_hash_count, &chunk->bloom_build));
+}
+
 /*
  * __wt_lsm_tree_switch --
  *	Switch to a new in-memory tree.
@@ -475,6 +516,17 @@ __wt_lsm_tree_switch(
 	    (lsm_tree->memsizep == NULL ? 0 : (int)*lsm_tree->memsizep),
 	    (int)lsm_tree->chunk_size);
 
+	/*
+	 * Remember how much the chunk we're switching from holds, and queue it
+	 * to be written to disk.
+	 */
+	if (lsm_tree->nchunks > 0) {
+		chunk = lsm_tree->chunk[lsm_tree->nchunks - 1];
+		if (lsm_tree->memsizep != NULL)
+			chunk->size = *lsm_tree->memsizep;
+		if (!F_ISSET(chunk, WT_LSM_CHUNK_ONDISK))
+			WT_ERR(__wt_lsm_flush_queue(session, lsm_tree, chunk));
+	}
 	lsm_tree->memsizep = NULL;
 
 	if ((lsm_tree->nchunks + 1) * sizeof(*lsm_tree->chunk) >
@@ -488,8 +540,10 @@ __wt_lsm_tree_switch(
 	WT_ERR(__wt_calloc_def(session, 1, &chunk));
 	lsm_tree->chunk[lsm_tree->nchunks++] = chunk;
 	WT_ERR(__wt_lsm_tree_setup_chunk(
-	    session, lsm_tree, new_id, chunk,
+	    session, lsm_tree, new_id, chunk, NULL,
 	    FLD_ISSET(lsm_tree->bloom, WT_LSM_BLOOM_NEWEST) ? 1 : 0));
+	if (FLD_ISSET(lsm_tree->bloom, WT_LSM_BLOOM_NEWEST))
+		WT_ERR(__lsm_tree_bloom_build(session, lsm_tree, chunk));
 
 	++lsm_tree->dsk_gen;
 	WT_ERR(__wt_lsm_meta_write(session, lsm_tree));
@@ -498,6 +552,79 @@ err:	/* TODO: mark lsm_tree bad on error(?) */
 	return (ret);
 }
 
+/*
+ * __lsm_tree_throttle_limit --
+ *	Apply a pair of limits on the work waiting for merges: writes are
+ *	slowed down once the soft limit is passed, increasingly as the work
+ *	approaches the hard limit, and stopped at the hard limit.  Without a
+ *	hard limit, the delay reaches its maximum at twice the soft limit.
+ */
+static void
+__lsm_tree_throttle_limit(uint64_t value,
+    uint64_t soft, uint64_t hard, uint64_t *sleepp, int *stallp)
+{
+	uint64_t end, sleep;
+
+	if (hard != 0 && value >= hard) {
+		*stallp = 1;
+		return;
+	}
+	if (soft == 0 || value <= soft)
+		return;
+
+	end = hard == 0 ? 2 * soft : hard;
+	sleep = value >= end ?
+	    WT_LSM_THROTTLE_MAX : WT_LSM_THROTTLE_MAX * (value - soft) /
+	    (end - soft);
+	if (sleep > *sleepp)
+		*sleepp = sleep;
+}
+
+/*
+ * __wt_lsm_tree_throttle --
+ *	Work out how much to slow down writes to a tree from the chunks
+ *	written from memory that are waiting to be merged.
+ *	Must be called with the LSM lock held.
+ */
+void
+__wt_lsm_tree_throttle(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
+{
+	WT_LSM_CHUNK *chunk;
+	uint64_t size, sleep;
+	uint32_t chunks;
+	int i, stall;
+
+	/*
+	 * Only count chunks that are on disk: merges can't reduce the others,
+	 * and a writer waiting for merges may stop the chunk it last wrote
+	 * being flushed.
+	 */
+	chunks = 0;
+	size = 0;
+	for (i = 0; i < lsm_tree->nchunks; i++) {
+		chunk = lsm_tree->chunk[i];
+		if (chunk->generation == 0 &&
+		    F_ISSET(chunk, WT_LSM_CHUNK_ONDISK)) {
+			++chunks;
+			size += chunk->size;
+		}
+	}
+	lsm_tree->unmerged_chunks = chunks;
+	lsm_tree->unmerged_size = size;
+
+	/* Without merges, nothing would ever release the writers. */
+	sleep = 0;
+	stall = 0;
+	if (F_ISSET(S2C(session), WT_CONN_LSM_MERGE)) {
+		__lsm_tree_throttle_limit(chunks, lsm_tree->throttle_chunks,
+		    lsm_tree->stall_chunks, &sleep, &stall);
+		__lsm_tree_throttle_limit(size, lsm_tree->throttle_size,
+		    lsm_tree->stall_size, &sleep, &stall);
+	}
+	lsm_tree->throttle_sleep = sleep;
+	lsm_tree->throttle_stall = stall;
+}
+
 /*
  * __wt_lsm_tree_drop --
  *	Drop an LSM tree.
@@ -646,8 +773,8 @@ __wt_lsm_tree_truncate(
 	    session, lsm_tree, 0, lsm_tree->nchunks, chunk));
 
 	/* Create the new chunk. */
-	WT_ERR(__wt_lsm_tree_setup_chunk(
-	    session, lsm_tree, WT_ATOMIC_ADD(lsm_tree->last, 1), chunk, 0));
+	WT_ERR(__wt_lsm_tree_setup_chunk(session,
+	    lsm_tree, WT_ATOMIC_ADD(lsm_tree->last, 1), chunk, NULL, 0));
 
 	WT_ERR(__wt_lsm_meta_write(session, lsm_tree));
 
@@ -9,33 +9,341 @@
 
 static int __lsm_bloom_create(
     WT_SESSION_IMPL *, WT_LSM_TREE *, WT_LSM_CHUNK *);
+static int __lsm_chunk_range(WT_SESSION_IMPL *, WT_LSM_CHUNK *, int *);
 static int __lsm_free_chunks(WT_SESSION_IMPL *, WT_LSM_TREE *);
 
 /*
- * __wt_lsm_worker --
- *	The worker thread for an LSM tree, responsible for writing in-memory
- *	trees to disk and merging on-disk trees.
+ * __lsm_workers_start --
+ *	Start a pool of LSM worker threads.
+ */
+static int
+__lsm_workers_start(WT_SESSION_IMPL *session, u_int count, const char *name,
+    void *(*func)(void *), WT_LSM_WORKER **workersp)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_LSM_WORKER *worker;
+	u_int i;
+
+	conn = S2C(session);
+
+	WT_RET(__wt_calloc_def(session, count, workersp));
+
+	/*
+	 * Each worker has its own session: allocate them here so the workers
+	 * never need to acquire the connection spinlock.
+	 */
+	for (i = 0, worker = *workersp; i < count; i++, worker++) {
+		worker->id = i;
+		WT_RET(
+		    __wt_open_session(conn, 1, NULL, NULL, &worker->session));
+		worker->session->name = name;
+		WT_RET(__wt_thread_create(&worker->tid, func, worker));
+	}
+
+	return (0);
+}
+
+/*
+ * __lsm_workers_join --
+ *	Wait for a pool of LSM worker threads to exit, and free it.
+ */
+static int
+__lsm_workers_join(WT_SESSION_IMPL *session, u_int count,
+    WT_LSM_WORKER **workersp)
+{
+	WT_DECL_RET;
+	WT_LSM_WORKER *worker;
+	u_int i;
+
+	for (i = 0, worker = *workersp; i < count; i++, worker++)
+		if (worker->tid != 0)
+			WT_TRET(__wt_thread_join(worker->tid));
+	__wt_free(session, *workersp);
+
+	return (ret);
+}
+
+/*
+ * __wt_lsm_merge_workers_start --
+ *	Start the connection's pool of LSM merge worker threads.
+ */
+int
+__wt_lsm_merge_workers_start(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+
+	conn = S2C(session);
+
+	F_SET(conn, WT_CONN_LSM_WORKERS);
+	/* The new threads will rely on the flag being visible. */
+	WT_FULL_BARRIER();
+
+	return (__lsm_workers_start(session, conn->lsm_merge_workers,
+	    "lsm-merge-worker", __wt_lsm_merge_worker, &conn->lsm_workers));
+}
+
+/*
+ * __wt_lsm_merge_workers_stop --
+ *	Shut down the connection's pool of LSM merge worker threads.
+ */
+int
+__wt_lsm_merge_workers_stop(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+
+	conn = S2C(session);
+
+	if (conn->lsm_workers == NULL)
+		return (0);
+
+	/* Merges in progress notice the flag and give up. */
+	F_CLR(conn, WT_CONN_LSM_WORKERS);
+	return (__lsm_workers_join(
+	    session, conn->lsm_merge_workers, &conn->lsm_workers));
+}
+
+/*
+ * __wt_lsm_flush_workers_start --
+ *	Start the connection's pool of LSM flush worker threads.
+ */
+int
+__wt_lsm_flush_workers_start(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+
+	conn = S2C(session);
+
+	WT_RET(__wt_cond_alloc(
+	    session, "lsm flush workers", 0, &conn->lsm_flush_cond));
+
+	F_SET(conn, WT_CONN_LSM_FLUSHERS);
+	/* The new threads will rely on the flag being visible. */
+	WT_FULL_BARRIER();
+
+	return (__lsm_workers_start(session, conn->lsm_flush_workers,
+	    "lsm-flush-worker", __wt_lsm_flush_worker, &conn->lsm_flushers));
+}
+
+/*
+ * __wt_lsm_flush_workers_stop --
+ *	Shut down the connection's pool of LSM flush worker threads.
+ */
+int
+__wt_lsm_flush_workers_stop(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+
+	conn = S2C(session);
+
+	if (conn->lsm_flushers == NULL)
+		return (0);
+
+	/* Flushes in progress notice the flag and give up. */
+	F_CLR(conn, WT_CONN_LSM_FLUSHERS);
+	__wt_cond_signal(session, conn->lsm_flush_cond);
+	ret = __lsm_workers_join(
+	    session, conn->lsm_flush_workers, &conn->lsm_flushers);
+
+	WT_TRET(__wt_cond_destroy(session, conn->lsm_flush_cond));
+	conn->lsm_flush_cond = NULL;
+
+	return (ret);
+}
+
+/*
+ * __wt_lsm_flush_queue --
+ *	Queue a chunk that has become read-only to be written to disk.
+ */
+int
+__wt_lsm_flush_queue(
+    WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, WT_LSM_CHUNK *chunk)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_LSM_FLUSH_UNIT *unit;
+
+	conn = S2C(session);
+
+	WT_RET(__wt_calloc_def(session, 1, &unit));
+	unit->lsm_tree = lsm_tree;
+	unit->chunk = chunk;
+
+	__wt_spin_lock(session, &conn->lsm_flush_lock);
+	TAILQ_INSERT_TAIL(&conn->lsm_flushqh, unit, q);
+	__wt_spin_unlock(session, &conn->lsm_flush_lock);
+
+	if (conn->lsm_flush_cond != NULL)
+		__wt_cond_signal(session, conn->lsm_flush_cond);
+	return (0);
+}
+
+/*
+ * __wt_lsm_flush_purge --
+ *	Discard a tree's chunks from the flush queue, and wait for the flush
+ *	workers to leave the tree.  The tree must no longer be working.
+ */
+void
+__wt_lsm_flush_purge(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_LSM_FLUSH_UNIT *next, *unit;
+
+	conn = S2C(session);
+
+	WT_ASSERT(session, !F_ISSET(lsm_tree, WT_LSM_TREE_WORKING));
+
+	/*
+	 * Workers check the tree is working with the queue locked, so none
+	 * can start on the tree once we have the lock.
+	 */
+	__wt_spin_lock(session, &conn->lsm_flush_lock);
+	for (unit = TAILQ_FIRST(&conn->lsm_flushqh);
+	    unit != NULL; unit = next) {
+		next = TAILQ_NEXT(unit, q);
+		if (unit->lsm_tree == lsm_tree) {
+			TAILQ_REMOVE(&conn->lsm_flushqh, unit, q);
+			__wt_free(session, unit);
+		}
+	}
+	__wt_spin_unlock(session, &conn->lsm_flush_lock);
+
+	while (lsm_tree->flush_threads > 0)
+		__wt_sleep(0, 1000);
+}
+
+/*
+ * __wt_lsm_schema_lock --
+ *	Acquire the schema lock in an LSM worker, see WT_LSM_WITH_SCHEMA_LOCK.
+ */
+int
+__wt_lsm_schema_lock(
+    WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, uint32_t pool)
+{
+	while (__wt_spin_trylock(session, &S2C(session)->schema_lock) != 0) {
+		if (!WT_LSM_WORKER_RUN(session, lsm_tree, pool))
+			return (EINTR);
+		__wt_sleep(0, 1000);
+	}
+	F_SET(session, WT_SESSION_SCHEMA_LOCKED);
+	return (0);
+}
+
+/*
+ * __lsm_merge_pick --
+ *	Choose the tree most in need of a merge, and take a reference to it.
+ *	Must be called with the schema lock held, which protects the list of
+ *	trees and orders the reference with exclusive gets of the tree.
+ */
+static WT_LSM_TREE *
+__lsm_merge_pick(WT_SESSION_IMPL *session, uint64_t now)
+{
+	WT_LSM_CHUNK *chunk;
+	WT_LSM_TREE *best, *lsm_tree;
+	u_int best_score, mergeable, score;
+	int i;
+
+	best = NULL;
+	best_score = 0;
+	TAILQ_FOREACH(lsm_tree, &S2C(session)->lsmqh, q) {
+		if (!F_ISSET(lsm_tree, WT_LSM_TREE_WORKING))
+			continue;
+
+		/*
+		 * Skip trees where a worker found nothing to do in the last
+		 * second, unless the chunks have changed since.
+		 */
+		if (lsm_tree->merge_idle == now &&
+		    lsm_tree->merge_idle_gen == lsm_tree->dsk_gen)
+			continue;
+
+		/*
+		 * Rank the trees by their number of chunks, plus the number of
+		 * chunks without Bloom filters: searches look in every chunk a
+		 * Bloom filter doesn't exclude, that's the read amplification
+		 * a merge reduces.
+		 *
+		 * Don't wait for the tree's lock, a worker freeing chunks may
+		 * hold it while waiting for the schema lock.
+		 */
+		if (__wt_spin_trylock(session, &lsm_tree->lock) != 0)
+			continue;
+		for (i = 0, mergeable = score = 0; i < lsm_tree->nchunks; i++) {
+			chunk = lsm_tree->chunk[i];
+			++score;
+			if (!F_ISSET(chunk, WT_LSM_CHUNK_BLOOM))
+				++score;
+			if (F_ISSET(chunk, WT_LSM_CHUNK_ONDISK) &&
+			    !F_ISSET(chunk, WT_LSM_CHUNK_MERGING))
+				++mergeable;
+		}
+		__wt_spin_unlock(session, &lsm_tree->lock);
+
+		/* There's work if chunks can be merged or freed. */
+		if (mergeable < 2 &&
+		    lsm_tree->nold_chunks == lsm_tree->old_avail)
+			continue;
+
+		if (best == NULL || score > best_score) {
+			best = lsm_tree;
+			best_score = score;
+		}
+	}
+
+	/*
+	 * Merges open cursors and handles, which can wait for the schema lock:
+	 * hold a reference to the tree, so dropping, renaming or truncating it
+	 * fails with EBUSY rather than closing the tree and waiting for us
+	 * with the schema lock held.
+	 */
+	if (best != NULL)
+		(void)WT_ATOMIC_ADD(best->refcnt, 1);
+	return (best);
+}
+
+/*
+ * __wt_lsm_merge_worker --
+ *	A thread in the connection's pool of LSM merge workers, responsible
+ *	for merging on-disk trees and freeing the merged chunks.  The workers
+ *	are shared by all of the trees, and merges of different chunks in a
+ *	tree run concurrently.
  */
 void *
-__wt_lsm_worker(void *arg)
+__wt_lsm_merge_worker(void *arg)
 {
+	WT_CONNECTION_IMPL *conn;
 	WT_LSM_TREE *lsm_tree;
+	WT_LSM_WORKER *worker;
 	WT_SESSION_IMPL *session;
+	struct timespec now;
+	uint64_t dsk_gen;
 	int progress, stalls;
 
-	lsm_tree = arg;
-	session = lsm_tree->worker_session;
-	stalls = 0;
+	worker = arg;
+	session = worker->session;
+	conn = S2C(session);
+
+	while (F_ISSET(conn, WT_CONN_LSM_WORKERS)) {
+		if (__wt_epoch(session, &now) != 0)
+			break;
+		WT_WITH_SCHEMA_LOCK(session, lsm_tree =
+		    __lsm_merge_pick(session, (uint64_t)now.tv_sec));
+		if (lsm_tree == NULL) {
+			__wt_sleep(0, 10000);
+			continue;
+		}
 
-	while (F_ISSET(lsm_tree, WT_LSM_TREE_WORKING)) {
 		progress = 0;
+		dsk_gen = lsm_tree->dsk_gen;
 
 		/* Clear any state from previous worker thread iterations. */
 		session->btree = NULL;
 
 		/* Report stalls to merge in seconds. */
-		if (__wt_lsm_merge(session, lsm_tree, stalls / 1000) == 0)
+		stalls = (int)((uint64_t)now.tv_sec - lsm_tree->merge_progress);
+		if (__wt_lsm_merge(session, lsm_tree, stalls) == 0) {
+			++worker->merges;
 			progress = 1;
+		}
 
 		/* Clear any state from previous worker thread iterations. */
 		session->btree = NULL;
@@ -44,121 +352,189 @@ __wt_lsm_worker(void *arg)
 		    __lsm_free_chunks(session, lsm_tree) == 0)
 			progress = 1;
 
-		if (progress)
-			stalls = 0;
-		else {
-			__wt_sleep(0, 1000);
-			++stalls;
+		if (progress) {
+			if (__wt_epoch(session, &now) == 0)
+				lsm_tree->merge_progress = (uint64_t)now.tv_sec;
+		} else {
+			lsm_tree->merge_idle = (uint64_t)now.tv_sec;
+			lsm_tree->merge_idle_gen = dsk_gen;
 		}
+		__wt_lsm_tree_release(session, lsm_tree);
 	}
 
+	WT_VERBOSE_VOID(session, lsm,
+	    "merge worker %u exiting: %" PRIu64 " merges",
+	    worker->id, worker->merges);
+
+	/* Close the worker's session and free its hazard array. */
+	(void)session->iface.close(&session->iface, NULL);
+	__wt_free(conn->default_session, session->hazard);
+
 	return (NULL);
 }
 
 /*
- * __wt_lsm_checkpoint_worker --
- *	A worker thread for an LSM tree, responsible for checkpointing chunks
- *	once they become read only.
+ * __lsm_flush_pick --
+ *	Take the oldest chunk from the flush queue without cursors still
+ *	writing to it, and count this thread as working in the chunk's tree.
  */
-void *
-__wt_lsm_checkpoint_worker(void *arg)
+static WT_LSM_FLUSH_UNIT *
+__lsm_flush_pick(WT_SESSION_IMPL *session)
 {
+	WT_CONNECTION_IMPL *conn;
+	WT_LSM_FLUSH_UNIT *unit;
+
+	conn = S2C(session);
+
+	__wt_spin_lock(session, &conn->lsm_flush_lock);
+	TAILQ_FOREACH(unit, &conn->lsm_flushqh, q)
+		if (unit->chunk->ncursor == 0 &&
+		    F_ISSET(unit->lsm_tree, WT_LSM_TREE_WORKING))
+			break;
+	if (unit != NULL) {
+		TAILQ_REMOVE(&conn->lsm_flushqh, unit, q);
+		(void)WT_ATOMIC_ADD(unit->lsm_tree->flush_threads, 1);
+	}
+	__wt_spin_unlock(session, &conn->lsm_flush_lock);
+
+	return (unit);
+}
+
+/*
+ * __lsm_flush_get_btree --
+ *	Get the handle for a chunk being flushed.  Checkpoints update the
+ *	metadata: open it too, while we hold the schema lock.
+ */
+static int
+__lsm_flush_get_btree(WT_SESSION_IMPL *session, WT_LSM_CHUNK *chunk)
+{
+	WT_RET(__wt_metadata_open(session));
+	return (__wt_session_get_btree(session, chunk->uri, NULL, NULL, 0));
+}
+
+/*
+ * __lsm_flush_chunk --
+ *	Write a chunk that has become read-only to disk: create its Bloom
+ *	filter, find its range of keys and checkpoint it.
+ */
+static int
+__lsm_flush_chunk(
+    WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, WT_LSM_CHUNK *chunk)
+{
+	WT_CONNECTION_IMPL *conn;
 	WT_DECL_RET;
-	WT_LSM_CHUNK *chunk;
-	WT_LSM_TREE *lsm_tree;
-	WT_LSM_WORKER_COOKIE cookie;
-	WT_SESSION_IMPL *session;
 	const char *cfg[] = API_CONF_DEFAULTS(session, checkpoint, NULL);
-	int i, j;
+	int range;
 
-	lsm_tree = arg;
-	session = lsm_tree->ckpt_session;
+	conn = S2C(session);
 
-	WT_CLEAR(cookie);
+	/*
+	 * The schema lock is only needed to get the chunk's handle.  Get it
+	 * before scanning the chunk, so the cursors find it in our session's
+	 * cache rather than waiting for the lock.
+	 */
+	WT_LSM_WITH_SCHEMA_LOCK(session,
+	    lsm_tree, WT_CONN_LSM_FLUSHERS, ret,
+	    ret = __lsm_flush_get_btree(session, chunk));
+	WT_RET(ret);
+	WT_RET(__wt_session_release_btree(session));
 
-	while (F_ISSET(lsm_tree, WT_LSM_TREE_WORKING)) {
-		WT_ERR(__wt_lsm_copy_chunks(session, lsm_tree, &cookie));
+	WT_RET(__lsm_bloom_create(session, lsm_tree, chunk));
+	WT_RET(__lsm_chunk_range(session, chunk, &range));
 
-		/* Write checkpoints in all completed files. */
-		for (i = 0, j = 0; i < cookie.nchunks; i++) {
-			chunk = cookie.chunk_array[i];
-			if (F_ISSET(chunk, WT_LSM_CHUNK_ONDISK))
-				continue;
-			/* Stop if a thread is still active in the chunk. */
-			if (chunk->ncursor != 0)
-				break;
+	/*
+	 * The checkpoint holds the metadata lock rather than the schema lock:
+	 * that orders it with database-wide checkpoints, and other trees can
+	 * switch chunks and other workers can build Bloom filters while the
+	 * chunk is written.
+	 *
+	 * NOTE: we pass a non-NULL config, because otherwise __wt_checkpoint
+	 * thinks we're closing the file.
+	 */
+	WT_LSM_WITH_SCHEMA_LOCK(session,
+	    lsm_tree, WT_CONN_LSM_FLUSHERS, ret,
+	    ret = __lsm_flush_get_btree(session, chunk));
+	WT_RET(ret);
+	__wt_spin_lock(session, &conn->metadata_lock);
+	ret = __wt_checkpoint(session, cfg);
+	__wt_spin_unlock(session, &conn->metadata_lock);
+	WT_TRET(__wt_session_release_btree(session));
+	WT_RET(ret);
 
-			WT_ERR(__lsm_bloom_create(
-			    session, lsm_tree, chunk));
-			/*
-			 * NOTE: we pass a non-NULL config, because otherwise
-			 * __wt_checkpoint thinks we're closing the file.
-			 */
-			WT_WITH_SCHEMA_LOCK(session,
-			    ret = __wt_schema_worker(session, chunk->uri,
-			    __wt_checkpoint, cfg, 0));
-			if (ret == 0) {
-				++j;
-				__wt_spin_lock(session, &lsm_tree->lock);
-				F_SET(chunk, WT_LSM_CHUNK_ONDISK);
-				lsm_tree->dsk_gen++;
-				__wt_spin_unlock(session, &lsm_tree->lock);
-				WT_VERBOSE_ERR(session, lsm,
-				     "LSM worker checkpointed %d.", i);
-			}
-		}
-		if (j == 0)
-			__wt_sleep(0, 10);
+	__wt_spin_lock(session, &lsm_tree->lock);
+	F_SET(chunk, WT_LSM_CHUNK_ONDISK);
+	if (range) {
+		/*
+		 * Cursors check the range without the tree's lock: the keys
+		 * must be visible before the flag is.
+		 */
+		WT_WRITE_BARRIER();
+		F_SET(chunk, WT_LSM_CHUNK_RANGE);
 	}
-err:	__wt_free(session, cookie.chunk_array);
+	lsm_tree->dsk_gen++;
+	__wt_lsm_tree_throttle(session, lsm_tree);
+	__wt_spin_unlock(session, &lsm_tree->lock);
 
-	return (NULL);
+	WT_VERBOSE_RET(session, lsm, "LSM flush worker wrote %s", chunk->uri);
+	return (0);
 }
 
 /*
- * __wt_lsm_copy_chunks --
- *	 Take a copy of part of the LSM tree chunk array so that we can work on
- *	 the contents without holding the LSM tree handle lock long term.
+ * __wt_lsm_flush_worker --
+ *	A thread in the connection's pool of LSM flush workers, responsible
+ *	for writing chunks to disk once they become read only.  The workers
+ *	are shared by all of the trees and take chunks from a queue, skipping
+ *	chunks that cursors are still writing to.
  */
-int
-__wt_lsm_copy_chunks(WT_SESSION_IMPL *session,
-    WT_LSM_TREE *lsm_tree, WT_LSM_WORKER_COOKIE *cookie)
+void *
+__wt_lsm_flush_worker(void *arg)
 {
-	WT_DECL_RET;
-	int nchunks;
+	WT_CONNECTION_IMPL *conn;
+	WT_LSM_FLUSH_UNIT *unit;
+	WT_LSM_TREE *lsm_tree;
+	WT_LSM_WORKER *worker;
+	WT_SESSION_IMPL *session;
 
-	/* Always return zero chunks on error. */
-	cookie->nchunks = 0;
+	worker = arg;
+	session = worker->session;
+	conn = S2C(session);
 
-	__wt_spin_lock(session, &lsm_tree->lock);
-	if (!F_ISSET(lsm_tree, WT_LSM_TREE_WORKING)) {
-		__wt_spin_unlock(session, &lsm_tree->lock);
-		/* The actual error value is ignored. */
-		return (WT_ERROR);
+	while (F_ISSET(conn, WT_CONN_LSM_FLUSHERS)) {
+		if ((unit = __lsm_flush_pick(session)) == NULL) {
+			__wt_cond_wait(session, conn->lsm_flush_cond, 10000);
+			continue;
+		}
+		lsm_tree = unit->lsm_tree;
+
+		/* Clear any state from previous worker thread iterations. */
+		session->btree = NULL;
+
+		if (__lsm_flush_chunk(session, lsm_tree, unit->chunk) == 0)
+			++worker->flushes;
+		else {
+			/* Try the chunk again later, unless the tree closed. */
+			__wt_spin_lock(session, &conn->lsm_flush_lock);
+			if (WT_LSM_WORKER_RUN(
+			    session, lsm_tree, WT_CONN_LSM_FLUSHERS)) {
+				TAILQ_INSERT_TAIL(&conn->lsm_flushqh, unit, q);
+				unit = NULL;
+			}
+			__wt_spin_unlock(session, &conn->lsm_flush_lock);
+		}
+		__wt_free(session, unit);
+
+		(void)WT_ATOMIC_SUB(lsm_tree->flush_threads, 1);
 	}
-	/*
-	 * Take a copy of the current state of the LSM tree. Skip
-	 * the last chunk - since it is the active one and not relevant
-	 * to merge operations.
-	 */
-	nchunks = lsm_tree->nchunks - 1;
 
-	/*
-	 * If the tree array of active chunks is larger than our current buffer,
-	 * increase the size of our current buffer to match.
-	 */
-	if (cookie->chunk_alloc < lsm_tree->chunk_alloc)
-		ret = __wt_realloc(session,
-		    &cookie->chunk_alloc, lsm_tree->chunk_alloc,
-		    &cookie->chunk_array);
-	if (ret == 0 && nchunks > 0)
-		memcpy(cookie->chunk_array, lsm_tree->chunk,
-		    nchunks * sizeof(*lsm_tree->chunk));
-	__wt_spin_unlock(session, &lsm_tree->lock);
+	WT_VERBOSE_VOID(session, lsm,
+	    "flush worker %u exiting: %" PRIu64 " flushes",
+	    worker->id, worker->flushes);
 
-	if (ret == 0)
-		cookie->nchunks = nchunks;
-	return (ret);
+	/* Close the worker's session and free its hazard array. */
+	(void)session->iface.close(&session->iface, NULL);
+	__wt_free(conn->default_session, session->hazard);
+
+	return (NULL);
 }
 
 /*
@@ -175,6 +551,7 @@ __lsm_bloom_create(WT_SESSION_IMPL *session,
 	WT_DECL_RET;
 	WT_ITEM key;
 	const char *cur_cfg[] = API_CONF_DEFAULTS(session, open_cursor, "raw");
+	const char *how;
 	uint64_t insert_count;
 
 	if (!FLD_ISSET(lsm_tree->bloom, WT_LSM_BLOOM_NEWEST) ||
@@ -183,28 +560,54 @@ __lsm_bloom_create(WT_SESSION_IMPL *session,
 
 	WT_ASSERT(session, chunk->bloom_uri != NULL);
 
-	bloom = NULL;
+	/*
+	 * If writes filled in the filter, and it's big enough for the records
+	 * in the chunk, write it out without scanning the chunk.  The filter
+	 * was created by the session that switched chunks, use ours.
+	 */
+	if ((bloom = chunk->bloom_build) != NULL) {
+		chunk->bloom_build = NULL;
+		bloom->session = session;
+		if (chunk->count > bloom->n) {
+			WT_ERR(__wt_bloom_close(bloom));
+			bloom = NULL;
+		}
+	}
 
-	WT_ERR(__wt_bloom_create(session, chunk->bloom_uri,
-	    lsm_tree->bloom_config, chunk->count,
-	    lsm_tree->bloom_bit_count, lsm_tree->bloom_hash_count, &bloom));
+	if (bloom == NULL) {
+		WT_ERR(__wt_bloom_create(session, chunk->bloom_uri,
+		    lsm_tree->bloom_config, chunk->count,
+		    lsm_tree->bloom_bit_count, lsm_tree->bloom_hash_count,
+		    &bloom));
 
-	WT_ERR(__wt_open_cursor(session, chunk->uri, NULL, cur_cfg, &src));
+		WT_ERR(__wt_open_cursor(
+		    session, chunk->uri, NULL, cur_cfg, &src));
 
-	for (insert_count = 0; (ret = src->next(src)) == 0; insert_count++) {
-		WT_ERR(src->get_key(src, &key));
-		WT_ERR(__wt_bloom_insert(bloom, &key));
+		for (insert_count = 0;
+		    (ret = src->next(src)) == 0; insert_count++) {
+			WT_ERR(src->get_key(src, &key));
+			WT_ERR(__wt_bloom_insert(bloom, &key));
+		}
+		WT_ERR_NOTFOUND_OK(ret);
+		WT_TRET(src->close(src));
+		how = "scanning the chunk";
+	} else {
+		insert_count = chunk->count;
+		how = "writes";
 	}
-	WT_ERR_NOTFOUND_OK(ret);
-	WT_TRET(src->close(src));
 
-	WT_TRET(__wt_bloom_finalize(bloom));
+	WT_ERR(ret);
+
+	/* Writing the filter creates a file, that needs the schema lock. */
+	WT_LSM_WITH_SCHEMA_LOCK(session,
+	    lsm_tree, WT_CONN_LSM_FLUSHERS, ret,
+	    ret = __wt_bloom_finalize(bloom));
 	WT_ERR(ret);
 
 	WT_VERBOSE_ERR(session, lsm,
-	    "LSM checkpoint worker created bloom filter. "
+	    "LSM flush worker created bloom filter from %s. "
 	    "Expected %" PRIu64 " items, got %" PRIu64,
-	    chunk->count, insert_count);
+	    how, chunk->count, insert_count);
 
 	F_SET(chunk, WT_LSM_CHUNK_BLOOM);
 err:	if (bloom != NULL)
@@ -212,25 +615,63 @@ err:	if (bloom != NULL)
 	return (ret);
 }
 
+/*
+ * __lsm_chunk_range --
+ *	Find the smallest and largest keys in a chunk that has become read
+ *	only.  The caller publishes the range along with the chunk's on-disk
+ *	state: an empty chunk has no range, and its count is cleared.
+ */
+static int
+__lsm_chunk_range(WT_SESSION_IMPL *session, WT_LSM_CHUNK *chunk, int *rangep)
+{
+	WT_CURSOR *src;
+	WT_DECL_RET;
+	WT_ITEM key;
+	const char *cur_cfg[] = API_CONF_DEFAULTS(session, open_cursor, "raw");
+
+	*rangep = 0;
+
+	WT_RET(__wt_open_cursor(session, chunk->uri, NULL, cur_cfg, &src));
+	if ((ret = src->next(src)) == WT_NOTFOUND) {
+		chunk->count = 0;
+		ret = 0;
+		goto err;
+	}
+	WT_ERR(ret);
+	WT_ERR(src->get_key(src, &key));
+	WT_ERR(__wt_buf_set(session, &chunk->key_min, key.data, key.size));
+	WT_ERR(src->reset(src));
+	WT_ERR(src->prev(src));
+	WT_ERR(src->get_key(src, &key));
+	WT_ERR(__wt_buf_set(session, &chunk->key_max, key.data, key.size));
+	*rangep = 1;
+
+err:	WT_TRET(src->close(src));
+	return (ret);
+}
+
 static int
 __lsm_free_chunks(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 {
 	WT_DECL_RET;
 	WT_LSM_CHUNK *chunk;
 	const char *drop_cfg[] = API_CONF_DEFAULTS(session, drop, NULL);
-	int locked, progress, i;
+	int progress, i;
+
+	progress = 0;
 
-	locked = progress = 0;
+	/*
+	 * Merges completing in other threads add to the list of old chunks,
+	 * and may reallocate it: hold the tree's lock while walking the list.
+	 */
+	__wt_spin_lock(session, &lsm_tree->lock);
 	for (i = 0; i < lsm_tree->nold_chunks; i++) {
 		if ((chunk = lsm_tree->old_chunks[i]) == NULL)
 			continue;
-		if (!locked) {
-			locked = 1;
-			/* TODO: Do we need the lsm_tree lock for all drops? */
-			__wt_spin_lock(session, &lsm_tree->lock);
-		}
 		if (F_ISSET(chunk, WT_LSM_CHUNK_BLOOM)) {
-			WT_WITH_SCHEMA_LOCK(session, ret = __wt_schema_drop(
+			WT_LSM_WITH_SCHEMA_LOCK(session,
+			    lsm_tree, WT_CONN_LSM_WORKERS, ret,
+			    ret = __wt_schema_drop(
 			    session, chunk->bloom_uri, drop_cfg));
 			/*
 			 * An EBUSY return is acceptable - a cursor may still
@@ -239,18 +680,28 @@ __lsm_free_chunks(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 			if (ret == 0) {
 				progress = 1;
 				F_CLR(chunk, WT_LSM_CHUNK_BLOOM);
+				__wt_bloom_mem_free(session, &chunk->bloom_mem);
 				__wt_free(session, chunk->bloom_uri);
 				chunk->bloom_uri = NULL;
 			} else if (ret != EBUSY)
 				goto err;
-			if (ret == EBUSY)
+			if (ret == EBUSY) {
 				WT_VERBOSE_ERR(session, lsm,
 				    "LSM worker bloom drop busy: %s.",
 				    chunk->bloom_uri);
+				/*
+				 * Keep the chunk's file until the filter is
+				 * gone: the metadata lists the filter with the
+				 * chunk, and a drop of the tree finds it there.
+				 */
+				continue;
+			}
 		}
 		if (chunk->uri != NULL) {
-			WT_WITH_SCHEMA_LOCK(session, ret =
-			    __wt_schema_drop(session, chunk->uri, drop_cfg));
+			WT_LSM_WITH_SCHEMA_LOCK(session,
+			    lsm_tree, WT_CONN_LSM_WORKERS, ret,
+			    ret = __wt_schema_drop(
+			    session, chunk->uri, drop_cfg));
 			/*
 			 * An EBUSY return is acceptable - a cursor may still
 			 * be positioned on this old chunk.
@@ -265,14 +716,14 @@ __lsm_free_chunks(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 
 		if (chunk->uri == NULL &&
 		    !F_ISSET(chunk, WT_LSM_CHUNK_BLOOM)) {
-			__wt_free(session, lsm_tree->old_chunks[i]);
+			__wt_lsm_chunk_free(session, chunk);
+			lsm_tree->old_chunks[i] = NULL;
 			++lsm_tree->old_avail;
 		}
 	}
-	if (locked) {
-err:		WT_TRET(__wt_lsm_meta_write(session, lsm_tree));
-		__wt_spin_unlock(session, &lsm_tree->lock);
-	}
+err:	if (progress)
+		WT_TRET(__wt_lsm_meta_write(session, lsm_tree));
+	__wt_spin_unlock(session, &lsm_tree->lock);
 
 	/* Returning non-zero means there is no work to do. */
 	if (!progress)
@@ -97,6 +97,53 @@ __wt_meta_checkpoint_clear(WT_SESSION_IMPL *session, const char *fname)
 	return (0);
 }
 
+/*
+ * __wt_meta_checkpoint_lsn --
+ *	Return the log position recovery starts from, recorded by the last
+ * checkpoint of the database.
+ */
+int
+__wt_meta_checkpoint_lsn(WT_SESSION_IMPL *session, WT_LSN *lsnp)
+{
+	WT_CONFIG_ITEM cval, v;
+	WT_DECL_RET;
+	const char *config;
+
+	config = NULL;
+
+	WT_ERR(__wt_metadata_read(session, WT_METADATA_URI, &config));
+	WT_ERR(__wt_config_getones(session, config, "checkpoint_lsn", &cval));
+	if (cval.len == 0)
+		WT_ERR(WT_NOTFOUND);
+	WT_ERR(__wt_config_subgets(session, &cval, "file", &v));
+	lsnp->file = (uint32_t)v.val;
+	WT_ERR(__wt_config_subgets(session, &cval, "offset", &v));
+	lsnp->offset = (off_t)v.val;
+
+err:	__wt_free(session, config);
+	return (ret);
+}
+
+/*
+ * __wt_meta_checkpoint_lsn_set --
+ *	Record the log position recovery starts from.
+ */
+int
+__wt_meta_checkpoint_lsn_set(WT_SESSION_IMPL *session, WT_LSN *lsn)
+{
+	WT_DECL_ITEM(buf);
+	WT_DECL_RET;
+
+	WT_RET(__wt_scr_alloc(session, 0, &buf));
+	WT_ERR(__wt_buf_fmt(session, buf,
+	    "checkpoint_lsn=(file=%" PRIu32 ",offset=%" PRIuMAX ")",
+	    lsn->file, (uintmax_t)lsn->offset));
+	WT_ERR(__ckpt_set(session, WT_METADATA_URI, buf->data));
+
+err:	__wt_scr_free(&buf);
+	return (ret);
+}
+
 /*
  * __ckpt_set --
  *	Set a file's checkpoint.
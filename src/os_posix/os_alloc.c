@@ -42,6 +42,44 @@ __wt_calloc(WT_SESSION_IMPL *session, size_t number, size_t size, void *retp)
 	return (0);
 }
 
+/*
+ * __wt_calloc_aligned --
+ *	ANSI calloc function that aligns to a caller-specified boundary, used
+ *	for structures that must not share cache lines.
+ */
+int
+__wt_calloc_aligned(WT_SESSION_IMPL *session,
+    size_t number, size_t size, size_t alignment, void *retp)
+{
+#if defined(HAVE_POSIX_MEMALIGN)
+	WT_DECL_RET;
+	void *p;
+
+	/*
+	 * !!!
+	 * This function MUST handle a NULL WT_SESSION_IMPL handle.
+	 */
+	WT_ASSERT(session, number != 0 && size != 0);
+
+	if (session != NULL && S2C(session)->stats != NULL)
+		WT_CSTAT_INCR(session, memalloc);
+
+	if ((ret = posix_memalign(&p, alignment, number * size)) != 0)
+		WT_RET_MSG(session, ret, "memory allocation");
+	memset(p, 0, number * size);
+
+	*(void **)retp = p;
+	return (0);
+#else
+	/*
+	 * If there is no posix_memalign function, fall back to calloc: the
+	 * memory is usable, it just may not start on the boundary.
+	 */
+	WT_UNUSED(alignment);
+	return (__wt_calloc(session, number, size, retp));
+#endif
+}
+
 /*
  * __wt_realloc --
  *	ANSI realloc function.
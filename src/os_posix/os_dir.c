@@ -0,0 +1,90 @@
+/*-
+ * Copyright (c) 2008-2012 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * __dirlist_cmp --
+ *	Qsort function: sort file names.
+ */
+static int
+__dirlist_cmp(const void *a, const void *b)
+{
+	return (strcmp(*(const char **)a, *(const char **)b));
+}
+
+/*
+ * __wt_dirlist --
+ *	Return a sorted list of the files in the database home directory with
+ * the given name prefix.
+ */
+int
+__wt_dirlist(WT_SESSION_IMPL *session,
+    const char *prefix, char ***dirlistp, u_int *countp)
+{
+	struct dirent *dp;
+	DIR *dirp;
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	size_t dirallocsz, len;
+	u_int count;
+	char **entries;
+
+	conn = S2C(session);
+	*dirlistp = NULL;
+	*countp = 0;
+
+	dirp = NULL;
+	dirallocsz = 0;
+	entries = NULL;
+	count = 0;
+	len = strlen(prefix);
+
+	WT_VERBOSE_RET(session, fileops,
+	    "%s: directory list, prefix \"%s\"", conn->home, prefix);
+
+	WT_SYSCALL_RETRY(((dirp = opendir(conn->home)) == NULL ? 1 : 0), ret);
+	if (ret != 0)
+		WT_RET_MSG(session, ret, "%s: opendir", conn->home);
+
+	while ((dp = readdir(dirp)) != NULL) {
+		if (strncmp(dp->d_name, prefix, len) != 0)
+			continue;
+		if ((count + 1) * sizeof(char *) > dirallocsz)
+			WT_ERR(__wt_realloc(session, &dirallocsz,
+			    WT_MAX(10, 2 * count) * sizeof(char *), &entries));
+		WT_ERR(__wt_strdup(session, dp->d_name, &entries[count]));
+		++count;
+	}
+
+	if (count > 1)
+		qsort(entries, count, sizeof(char *), __dirlist_cmp);
+	*dirlistp = entries;
+	*countp = count;
+
+	if (0) {
+err:		__wt_dirlist_free(session, entries, count);
+	}
+	(void)closedir(dirp);
+	return (ret);
+}
+
+/*
+ * __wt_dirlist_free --
+ *	Free a list returned by __wt_dirlist.
+ */
+void
+__wt_dirlist_free(WT_SESSION_IMPL *session, char **entries, u_int count)
+{
+	u_int i;
+
+	if (entries == NULL)
+		return;
+	for (i = 0; i < count; i++)
+		__wt_free(session, entries[i]);
+	__wt_free(session, entries);
+}
@@ -0,0 +1,696 @@
+/*-
+ * Copyright (c) 2008-2012 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+#ifdef HAVE_LINUX_IO_URING_H
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+#endif
+
+/*
+ * Batched I/O.
+ *
+ * A batch of reads or writes is sorted into file order, and requests for
+ * adjacent bytes of the same file are merged into runs, each issued with a
+ * single preadv or pwritev call.  The connection's I/O backend decides how
+ * the runs are issued: by the calling thread (sync), by a pool of I/O threads
+ * while the calling thread waits (threads), or submitted together through a
+ * Linux io_uring owned by the calling session (io_uring).
+ */
+
+/*
+ * __io_run --
+ *	Issue a run of requests with a single system call.
+ */
+static int
+__io_run(WT_SESSION_IMPL *session, WT_IO_RUN *run)
+{
+	ssize_t nbytes;
+	const char *op;
+
+#if defined(HAVE_PREADV) && defined(HAVE_PWRITEV)
+	nbytes = run->write ?
+	    pwritev(run->fh->fd, run->iov, run->iovcnt, run->offset) :
+	    preadv(run->fh->fd, run->iov, run->iovcnt, run->offset);
+#else
+	{
+	off_t offset;
+	ssize_t len;
+	int i;
+
+	for (nbytes = 0,
+	    offset = run->offset, i = 0; i < run->iovcnt; ++i) {
+		len = run->write ? pwrite(run->fh->fd,
+		    run->iov[i].iov_base, run->iov[i].iov_len, offset) :
+		    pread(run->fh->fd,
+		    run->iov[i].iov_base, run->iov[i].iov_len, offset);
+		if (len != (ssize_t)run->iov[i].iov_len)
+			break;
+		nbytes += len;
+		offset += len;
+	}
+	}
+#endif
+	if (nbytes == (ssize_t)run->bytes)
+		return (0);
+
+	op = run->write ? "write" : "read";
+	WT_RET_MSG(session, __wt_errno(),
+	    "%s %s error: failed to %s %" PRIuMAX " bytes at offset %" PRIuMAX,
+	    run->fh->name, op, op, (uintmax_t)run->bytes,
+	    (uintmax_t)run->offset);
+}
+
+/*
+ * __io_req_cmp --
+ *	Qsort function: sort batched I/O requests into file order.
+ */
+static int
+__io_req_cmp(const void *a, const void *b)
+{
+	const WT_IO_REQ *ra, *rb;
+
+	ra = *(WT_IO_REQ * const *)a;
+	rb = *(WT_IO_REQ * const *)b;
+
+	if (ra->fh != rb->fh)
+		return ((uintptr_t)ra->fh < (uintptr_t)rb->fh ? -1 : 1);
+	if (ra->offset != rb->offset)
+		return (ra->offset < rb->offset ? -1 : 1);
+	return (0);
+}
+
+/*
+ * __io_session --
+ *	Return the session's batched I/O information, sized for a batch.
+ */
+static int
+__io_session(WT_SESSION_IMPL *session, u_int n, WT_IO_SESSION **iop)
+{
+	WT_DECL_RET;
+	WT_IO_SESSION *io;
+
+	if ((io = session->io) == NULL) {
+		WT_RET(__wt_calloc_def(session, 1, &io));
+		if ((ret = __wt_cond_alloc(
+		    session, "batched I/O", 0, &io->cond)) != 0) {
+			__wt_free(session, io);
+			return (ret);
+		}
+		session->io = io;
+	}
+
+	if (io->sorted_alloc < n * sizeof(WT_IO_REQ *))
+		WT_RET(__wt_realloc(session,
+		    &io->sorted_alloc, n * sizeof(WT_IO_REQ *), &io->sorted));
+	if (io->runs_alloc < n * sizeof(WT_IO_RUN))
+		WT_RET(__wt_realloc(session,
+		    &io->runs_alloc, n * sizeof(WT_IO_RUN), &io->runs));
+	if (io->iov_alloc < n * sizeof(struct iovec))
+		WT_RET(__wt_realloc(session,
+		    &io->iov_alloc, n * sizeof(struct iovec), &io->iov));
+
+	*iop = io;
+	return (0);
+}
+
+#ifdef HAVE_LINUX_IO_URING_H
+/*
+ * __io_uring_destroy --
+ *	Discard an io_uring.
+ */
+static void
+__io_uring_destroy(WT_SESSION_IMPL *session, WT_IO_URING *ring)
+{
+	if (ring->sqes != NULL)
+		(void)munmap(ring->sqes, ring->sqes_len);
+	if (ring->cq_mem != NULL && ring->cq_mem != ring->sq_mem)
+		(void)munmap(ring->cq_mem, ring->cq_len);
+	if (ring->sq_mem != NULL)
+		(void)munmap(ring->sq_mem, ring->sq_len);
+	if (ring->fd >= 0)
+		(void)close(ring->fd);
+	__wt_free(session, ring);
+}
+
+/*
+ * __io_uring_map --
+ *	Map part of an io_uring into memory.
+ */
+static void *
+__io_uring_map(int fd, size_t len, off_t offset)
+{
+	void *p;
+
+	p = mmap(NULL,
+	    len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, offset);
+	return (p == MAP_FAILED ? NULL : p);
+}
+
+/*
+ * __io_uring_create --
+ *	Create an io_uring.
+ */
+static int
+__io_uring_create(WT_SESSION_IMPL *session, WT_IO_URING **ringp)
+{
+	struct io_uring_params p;
+	WT_DECL_RET;
+	WT_IO_URING *ring;
+	uint8_t *cq, *sq;
+
+	*ringp = NULL;
+
+	WT_RET(__wt_calloc_def(session, 1, &ring));
+	memset(&p, 0, sizeof(p));
+	if ((ring->fd = (int)syscall(
+	    __NR_io_uring_setup, WT_IO_URING_ENTRIES, &p)) < 0) {
+		ret = __wt_errno();
+		__wt_free(session, ring);
+		return (ret);
+	}
+
+	/*
+	 * Map the submission and completion queues: newer kernels map both
+	 * with a single call.
+	 */
+	ring->sq_len = p.sq_off.array + p.sq_entries * sizeof(uint32_t);
+	ring->cq_len =
+	    p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+	if (FLD_ISSET(p.features, IORING_FEAT_SINGLE_MMAP))
+		ring->sq_len =
+		    ring->cq_len = WT_MAX(ring->sq_len, ring->cq_len);
+	if ((ring->sq_mem =
+	    __io_uring_map(ring->fd, ring->sq_len, IORING_OFF_SQ_RING)) == NULL)
+		WT_ERR(__wt_errno());
+	if (FLD_ISSET(p.features, IORING_FEAT_SINGLE_MMAP))
+		ring->cq_mem = ring->sq_mem;
+	else if ((ring->cq_mem = __io_uring_map(
+	    ring->fd, ring->cq_len, IORING_OFF_CQ_RING)) == NULL)
+		WT_ERR(__wt_errno());
+	ring->sqes_len = p.sq_entries * sizeof(struct io_uring_sqe);
+	if ((ring->sqes =
+	    __io_uring_map(ring->fd, ring->sqes_len, IORING_OFF_SQES)) == NULL)
+		WT_ERR(__wt_errno());
+
+	sq = ring->sq_mem;
+	ring->sq_head = (uint32_t *)(sq + p.sq_off.head);
+	ring->sq_tail = (uint32_t *)(sq + p.sq_off.tail);
+	ring->sq_mask = *(uint32_t *)(sq + p.sq_off.ring_mask);
+	ring->sq_array = (uint32_t *)(sq + p.sq_off.array);
+	ring->sq_entries = p.sq_entries;
+
+	cq = ring->cq_mem;
+	ring->cq_head = (uint32_t *)(cq + p.cq_off.head);
+	ring->cq_tail = (uint32_t *)(cq + p.cq_off.tail);
+	ring->cq_mask = *(uint32_t *)(cq + p.cq_off.ring_mask);
+	ring->cqes = cq + p.cq_off.cqes;
+
+	*ringp = ring;
+	return (0);
+
+err:	__io_uring_destroy(session, ring);
+	return (ret);
+}
+
+/*
+ * __io_uring_reap --
+ *	Reap an io_uring's completions, returning the number reaped.
+ */
+static u_int
+__io_uring_reap(WT_IO_URING *ring)
+{
+	struct io_uring_cqe *cqe;
+	WT_IO_RUN *run;
+	uint32_t cq_tail, head;
+	u_int complete;
+
+	/*
+	 * Read the tail once, the entries up to it are only safe to read after
+	 * the load of the tail.
+	 */
+	head = *ring->cq_head;
+	cq_tail = *ring->cq_tail;
+	WT_READ_BARRIER();
+	for (complete = 0; head != cq_tail; ++head, ++complete) {
+		cqe = (struct io_uring_cqe *)
+		    ring->cqes + (head & ring->cq_mask);
+		run = (WT_IO_RUN *)(uintptr_t)cqe->user_data;
+
+		/*
+		 * A failed or short transfer is retried with a system call,
+		 * which reports any error.
+		 */
+		run->error = cqe->res == (int32_t)run->bytes ? 0 : EAGAIN;
+	}
+	WT_FULL_BARRIER();
+	*ring->cq_head = head;
+	return (complete);
+}
+
+/*
+ * __io_uring_submit --
+ *	Submit runs to the session's io_uring, and wait for them to complete.
+ */
+static int
+__io_uring_submit(
+    WT_SESSION_IMPL *session, WT_IO_URING *ring, WT_IO_RUN *runs, u_int n)
+{
+	struct io_uring_sqe *sqe;
+	WT_DECL_RET;
+	WT_IO_RUN *run;
+	uint32_t idx, tail;
+	u_int complete, i, submit;
+	long r;
+
+	WT_ASSERT(session, n <= ring->sq_entries);
+
+	/* Fill in a submission queue entry for each run. */
+	tail = *ring->sq_tail;
+	for (i = 0, run = runs; i < n; ++i, ++run, ++tail) {
+		idx = tail & ring->sq_mask;
+		sqe = (struct io_uring_sqe *)ring->sqes + idx;
+		memset(sqe, 0, sizeof(*sqe));
+		sqe->opcode = run->write ? IORING_OP_WRITEV : IORING_OP_READV;
+		sqe->fd = run->fh->fd;
+		sqe->off = (uint64_t)run->offset;
+		sqe->addr = (uint64_t)(uintptr_t)run->iov;
+		sqe->len = (uint32_t)run->iovcnt;
+		sqe->user_data = (uint64_t)(uintptr_t)run;
+		ring->sq_array[idx] = idx;
+	}
+
+	/* The entries must be visible before the kernel sees the new tail. */
+	WT_WRITE_BARRIER();
+	*ring->sq_tail = tail;
+	WT_FULL_BARRIER();
+
+	for (submit = n, complete = 0; complete < n;) {
+		r = syscall(__NR_io_uring_enter,
+		    ring->fd, submit, 1, IORING_ENTER_GETEVENTS, NULL, 0);
+		if (r < 0) {
+			if (errno == EINTR || errno == EAGAIN ||
+			    errno == EBUSY) {
+				__wt_yield();
+				continue;
+			}
+			ret = __wt_errno();
+			break;
+		}
+		submit -= (u_int)r;
+		complete += __io_uring_reap(ring);
+	}
+
+	/*
+	 * If a submission failed, wait for the requests the kernel already
+	 * has: they transfer to and from the callers' buffers, and the caller
+	 * discards the ring.  Completions are posted whether or not waiting
+	 * for them succeeds, keep reaping until they're all in.
+	 */
+	if (ret != 0) {
+		while (complete < n - submit) {
+			if (syscall(__NR_io_uring_enter, ring->fd,
+			    0, 1, IORING_ENTER_GETEVENTS, NULL, 0) < 0)
+				__wt_yield();
+			complete += __io_uring_reap(ring);
+		}
+		return (ret);
+	}
+
+	for (i = 0, run = runs; i < n; ++i, ++run)
+		if (run->error != 0)
+			WT_RET(__io_run(session, run));
+	return (0);
+}
+#endif
+
+/*
+ * __io_batch_uring --
+ *	Issue runs through the session's io_uring.
+ */
+static int
+__io_batch_uring(WT_SESSION_IMPL *session, WT_IO_RUN *runs, u_int nruns)
+{
+#ifdef HAVE_LINUX_IO_URING_H
+	WT_DECL_RET;
+	WT_IO_SESSION *io;
+	u_int i, n;
+
+	io = session->io;
+
+	/*
+	 * If the session can't create a ring (for example, it has reached a
+	 * limit on locked memory), issue the runs in this thread.
+	 */
+	if (io->ring == NULL && __io_uring_create(session, &io->ring) != 0)
+		io->ring = NULL;
+	if (io->ring != NULL) {
+		for (i = 0; i < nruns; i += n) {
+			n = WT_MIN(nruns - i, io->ring->sq_entries);
+			if ((ret = __io_uring_submit(
+			    session, io->ring, runs + i, n)) != 0) {
+				/*
+				 * The ring's state is unknown: discard it once
+				 * the submitted requests complete, the next
+				 * batch creates a new one.
+				 */
+				__io_uring_destroy(session, io->ring);
+				io->ring = NULL;
+				return (ret);
+			}
+		}
+		return (0);
+	}
+#endif
+	for (; nruns > 0; --nruns, ++runs)
+		WT_RET(__io_run(session, runs));
+	return (0);
+}
+
+/*
+ * __io_batch_threads --
+ *	Issue runs using the connection's pool of I/O threads.
+ */
+static int
+__io_batch_threads(WT_SESSION_IMPL *session, WT_IO_RUN *runs, u_int nruns)
+{
+	WT_DECL_RET;
+	WT_IO_POOL *pool;
+	WT_IO_RUN *run;
+	WT_IO_SESSION *io;
+	u_int i;
+	uint32_t pending;
+
+	io = session->io;
+	pool = S2C(session)->io_pool;
+
+	/*
+	 * Queue all but the first run for the I/O threads, and wake enough of
+	 * them to issue the runs in parallel.  This thread issues the first
+	 * run, then takes back any of its runs the I/O threads haven't started,
+	 * then waits for the rest.
+	 */
+	__wt_spin_lock(session, &pool->lock);
+	io->pending = nruns - 1;
+	for (i = 1, run = runs + 1; i < nruns; ++i, ++run) {
+		run->io = io;
+		TAILQ_INSERT_TAIL(&pool->qh, run, q);
+	}
+	__wt_spin_unlock(session, &pool->lock);
+	for (i = 1; i < nruns && i <= pool->nworkers; ++i)
+		__wt_cond_signal(session,
+		    pool->workers[pool->next++ % pool->nworkers].cond);
+
+	ret = __io_run(session, runs);
+
+	for (;;) {
+		__wt_spin_lock(session, &pool->lock);
+		TAILQ_FOREACH(run, &pool->qh, q)
+			if (run->io == io) {
+				TAILQ_REMOVE(&pool->qh, run, q);
+				--io->pending;
+				break;
+			}
+		pending = io->pending;
+		__wt_spin_unlock(session, &pool->lock);
+
+		if (run != NULL)
+			WT_TRET(__io_run(session, run));
+		else if (pending == 0)
+			break;
+		else
+			__wt_cond_wait(session, io->cond, 10000);
+	}
+
+	/* The I/O threads report their errors in the runs. */
+	for (i = 0, run = runs; i < nruns; ++i, ++run)
+		if (ret == 0 && run->error != 0)
+			ret = run->error;
+	return (ret);
+}
+
+/*
+ * __io_batch --
+ *	Issue a batch of reads or writes.
+ */
+static int
+__io_batch(WT_SESSION_IMPL *session, WT_IO_REQ *reqs, u_int n, int write)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_IO_REQ **sorted, *req;
+	WT_IO_RUN *run;
+	WT_IO_SESSION *io;
+	struct iovec *iov;
+	u_int i, nruns;
+
+	conn = S2C(session);
+
+	if (n == 0)
+		return (0);
+	WT_RET(__io_session(session, n, &io));
+
+	/* Sort the requests into file order. */
+	for (i = 0, sorted = io->sorted; i < n; ++i)
+		sorted[i] = &reqs[i];
+	qsort(sorted, (size_t)n, sizeof(WT_IO_REQ *), __io_req_cmp);
+
+	/* Merge requests for adjacent bytes of a file into runs. */
+	run = NULL;
+	for (i = nruns = 0, iov = io->iov; i < n; ++i, ++iov) {
+		req = sorted[i];
+		WT_ASSERT(session, WT_IO_ALIGNED(
+		    session, req->fh, req->offset, req->bytes, req->buf));
+		iov->iov_base = req->buf;
+		iov->iov_len = req->bytes;
+
+		if (run == NULL || run->fh != req->fh ||
+		    run->offset + (off_t)run->bytes != req->offset ||
+		    run->iovcnt == WT_IO_IOV_MAX) {
+			run = &io->runs[nruns++];
+			WT_CLEAR(*run);
+			run->fh = req->fh;
+			run->offset = req->offset;
+			run->iov = iov;
+			run->write = write;
+		}
+		run->bytes += req->bytes;
+		++run->iovcnt;
+	}
+
+	WT_VERBOSE_RET(session, fileops,
+	    "batch: %s %u requests with %u calls",
+	    write ? "write" : "read", n, nruns);
+
+	if (write)
+		WT_CSTAT_INCRV(session, total_write_io, n);
+	else
+		WT_CSTAT_INCRV(session, total_read_io, n);
+	WT_CSTAT_INCR(session, io_batch);
+	WT_CSTAT_INCRV(session, io_batch_calls, nruns);
+
+	if (nruns > 1 && conn->io_backend == WT_IO_BACKEND_URING)
+		return (__io_batch_uring(session, io->runs, nruns));
+	if (nruns > 1 && conn->io_backend == WT_IO_BACKEND_THREADS)
+		return (__io_batch_threads(session, io->runs, nruns));
+	for (i = 0, run = io->runs; i < nruns; ++i, ++run)
+		WT_RET(__io_run(session, run));
+	return (0);
+}
+
+/*
+ * __wt_read_batch --
+ *	Read a batch of chunks.
+ */
+int
+__wt_read_batch(WT_SESSION_IMPL *session, WT_IO_REQ *reqs, u_int n)
+{
+	return (__io_batch(session, reqs, n, 0));
+}
+
+/*
+ * __wt_write_batch --
+ *	Write a batch of chunks.
+ */
+int
+__wt_write_batch(WT_SESSION_IMPL *session, WT_IO_REQ *reqs, u_int n)
+{
+	return (__io_batch(session, reqs, n, 1));
+}
+
+/*
+ * __wt_io_session_destroy --
+ *	Discard a session's batched I/O information.
+ */
+void
+__wt_io_session_destroy(WT_SESSION_IMPL *session)
+{
+	WT_IO_SESSION *io;
+
+	if ((io = session->io) == NULL)
+		return;
+
+#ifdef HAVE_LINUX_IO_URING_H
+	if (io->ring != NULL)
+		__io_uring_destroy(session, io->ring);
+#endif
+	if (io->cond != NULL)
+		(void)__wt_cond_destroy(session, io->cond);
+	__wt_free(session, io->sorted);
+	__wt_free(session, io->runs);
+	__wt_free(session, io->iov);
+	__wt_free(session, session->io);
+}
+
+/*
+ * __wt_io_worker --
+ *	Thread to issue runs of batched I/O queued by other threads.
+ */
+void *
+__wt_io_worker(void *arg)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_IO_POOL *pool;
+	WT_IO_RUN *run;
+	WT_IO_WORKER *worker;
+	WT_SESSION_IMPL *session;
+
+	worker = arg;
+	session = worker->session;
+	conn = S2C(session);
+	pool = conn->io_pool;
+
+	while (F_ISSET(conn, WT_SERVER_RUN)) {
+		__wt_spin_lock(session, &pool->lock);
+		if ((run = TAILQ_FIRST(&pool->qh)) != NULL)
+			TAILQ_REMOVE(&pool->qh, run, q);
+		__wt_spin_unlock(session, &pool->lock);
+
+		if (run == NULL) {
+			/* Don't rely on signals: check periodically. */
+			__wt_cond_wait(session, worker->cond, 100000);
+			continue;
+		}
+
+		run->error = __io_run(session, run);
+		++worker->runs;
+
+		/*
+		 * Wake the thread waiting for the batch with the queue locked:
+		 * once it sees the batch is finished, it may close its session
+		 * and free the condition variable.
+		 */
+		__wt_spin_lock(session, &pool->lock);
+		if (--run->io->pending == 0)
+			__wt_cond_signal(session, run->io->cond);
+		__wt_spin_unlock(session, &pool->lock);
+	}
+
+	WT_VERBOSE_VOID(session, fileops,
+	    "I/O thread %u exiting: %" PRIu64 " calls",
+	    worker->id, worker->runs);
+
+	/* Close the worker's session and free its hazard array. */
+	(void)session->iface.close(&session->iface, NULL);
+	__wt_free(conn->default_session, session->hazard);
+
+	return (NULL);
+}
+
+/*
+ * __wt_io_open --
+ *	Start the connection's batched I/O backend.
+ */
+int
+__wt_io_open(WT_CONNECTION_IMPL *conn)
+{
+	WT_IO_POOL *pool;
+	WT_IO_WORKER *worker;
+	WT_SESSION_IMPL *session;
+	u_int i;
+
+	session = conn->default_session;
+
+	/*
+	 * Check io_uring works here: it may not be compiled in, the kernel may
+	 * be too old, or it may be disabled.  If it doesn't, use I/O threads.
+	 */
+	if (conn->io_backend == WT_IO_BACKEND_URING) {
+#ifdef HAVE_LINUX_IO_URING_H
+		WT_IO_URING *ring;
+
+		if (__io_uring_create(session, &ring) == 0)
+			__io_uring_destroy(session, ring);
+		else
+#endif
+		{
+			WT_VERBOSE_RET(session, fileops,
+			    "io_uring not available, using I/O threads");
+			conn->io_backend = WT_IO_BACKEND_THREADS;
+		}
+	}
+	if (conn->io_backend != WT_IO_BACKEND_THREADS)
+		return (0);
+
+	/* Start the I/O threads, each with its own session. */
+	WT_RET(__wt_calloc_def(session, 1, &conn->io_pool));
+	pool = conn->io_pool;
+	__wt_spin_init(session, &pool->lock);
+	TAILQ_INIT(&pool->qh);
+	WT_RET(__wt_calloc_def(session, conn->io_threads, &pool->workers));
+	pool->nworkers = conn->io_threads;
+	for (i = 0, worker = pool->workers; i < pool->nworkers; i++, worker++) {
+		worker->id = i;
+		WT_RET(__wt_cond_alloc(
+		    session, "I/O thread", 0, &worker->cond));
+		WT_RET(
+		    __wt_open_session(conn, 1, NULL, NULL, &worker->session));
+		worker->session->name = "io-worker";
+		WT_RET(__wt_thread_create(
+		    &worker->tid, __wt_io_worker, worker));
+	}
+	return (0);
+}
+
+/*
+ * __wt_io_close --
+ *	Shut down the connection's batched I/O backend.  The connection's
+ * server threads must have been told to exit.
+ */
+int
+__wt_io_close(WT_CONNECTION_IMPL *conn)
+{
+	WT_DECL_RET;
+	WT_IO_POOL *pool;
+	WT_IO_WORKER *worker;
+	WT_SESSION_IMPL *session;
+	u_int i;
+
+	session = conn->default_session;
+
+	if ((pool = conn->io_pool) == NULL)
+		return (0);
+
+	WT_ASSERT(session, !F_ISSET(conn, WT_SERVER_RUN));
+	if (pool->workers != NULL) {
+		for (i = 0, worker = pool->workers;
+		    i < pool->nworkers; i++, worker++) {
+			if (worker->tid != 0) {
+				__wt_cond_signal(session, worker->cond);
+				WT_TRET(__wt_thread_join(worker->tid));
+			}
+			if (worker->cond != NULL)
+				(void)__wt_cond_destroy(session, worker->cond);
+		}
+		__wt_free(session, pool->workers);
+	}
+	__wt_spin_destroy(session, &pool->lock);
+	__wt_free(session, conn->io_pool);
+
+	return (ret);
+}
@@ -21,6 +21,8 @@ __wt_read(WT_SESSION_IMPL *session,
 	    "%s: read %" PRIu32 " bytes at offset %" PRIuMAX,
 	    fh->name, bytes, (uintmax_t)offset);
 
+	WT_ASSERT(session, WT_IO_ALIGNED(session, fh, offset, bytes, buf));
+
 	if (pread(fh->fd, buf, (size_t)bytes, offset) == (ssize_t)bytes)
 		return (0);
 
@@ -44,6 +46,8 @@ __wt_write(WT_SESSION_IMPL *session,
 	    "%s: write %" PRIu32 " bytes at offset %" PRIuMAX,
 	    fh->name, bytes, (uintmax_t)offset);
 
+	WT_ASSERT(session, WT_IO_ALIGNED(session, fh, offset, bytes, buf));
+
 	if (pwrite(fh->fd, buf, (size_t)bytes, offset) == (ssize_t)bytes)
 		return (0);
 
@@ -97,6 +97,9 @@ __session_close(WT_SESSION *wt_session, const char *config)
 	/* Free the reconciliation information. */
 	__wt_rec_destroy(session, &session->reconcile);
 
+	/* Free the batched I/O information. */
+	__wt_io_session_destroy(session);
+
 	/* Free the eviction exclusive-lock information. */
 	__wt_free(session, session->excl);
 
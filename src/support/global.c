@@ -17,6 +17,8 @@ __wt_pthread_once(void)
 
 	TAILQ_INIT(&__wt_process.connqh);
 
+	__wt_cksum_init();
+
 #ifdef HAVE_DIAGNOSTIC
 	/* Load debugging code the compiler might optimize out. */
 	(void)__wt_breakpoint();
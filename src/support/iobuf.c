@@ -0,0 +1,160 @@
+/*-
+ * Copyright (c) 2008-2012 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * __iobuf_class --
+ *	Return the size class for a buffer size, or WT_NOTFOUND if the size is
+ * too large to pool.
+ */
+static int
+__iobuf_class(size_t size, u_int *slotp, size_t *class_sizep)
+{
+	size_t base, step;
+	u_int slot, i;
+
+	base = (size_t)1 << WT_IOBUF_MIN_SHIFT;
+	if (size <= base) {
+		*slotp = 0;
+		*class_sizep = base;
+		return (0);
+	}
+
+	/* Each power of two is split into four classes. */
+	for (slot = 0; base < ((size_t)1 << WT_IOBUF_MAX_SHIFT);
+	    base <<= 1, slot += 4)
+		if (size <= base << 1) {
+			step = base / 4;
+			i = (u_int)((size - base + step - 1) / step);
+			*slotp = slot + i;
+			*class_sizep = base + i * step;
+			return (0);
+		}
+	return (WT_NOTFOUND);
+}
+
+/*
+ * __wt_iobuf_get --
+ *	Initialize an empty buffer for I/O, taking its memory from the
+ * connection's pool of I/O buffers if possible.
+ */
+int
+__wt_iobuf_get(WT_SESSION_IMPL *session, size_t size, WT_ITEM *buf)
+{
+	WT_IOBUF_POOL *pool;
+	size_t class_size, memsize;
+	u_int slot;
+	void *p;
+
+	WT_ASSERT(session, buf->mem == NULL);
+
+	F_SET(buf, WT_ITEM_ALIGNED);
+	if ((pool = S2C(session)->iobuf_pool) == NULL ||
+	    __iobuf_class(size, &slot, &class_size) != 0)
+		return (__wt_buf_init(session, buf, size));
+
+	__wt_spin_lock(session, &pool->lock);
+	if ((p = pool->free[slot]) != NULL) {
+		pool->free[slot] = *(void **)p;
+		pool->bytes -= class_size;
+	}
+	__wt_spin_unlock(session, &pool->lock);
+
+	if (p == NULL) {
+		memsize = 0;
+		WT_RET(__wt_realloc_aligned(session, &memsize, class_size, &p));
+		WT_CSTAT_INCR(session, iobuf_alloc);
+	} else
+		WT_CSTAT_INCR(session, iobuf_reuse);
+
+	buf->mem = p;
+	buf->memsize = class_size;
+	buf->data = buf->mem;
+	buf->size = 0;
+	F_SET(buf, WT_ITEM_POOLED);
+	return (0);
+}
+
+/*
+ * __wt_iobuf_put --
+ *	Return a buffer's memory to the connection's pool of I/O buffers, or
+ * free it if the pool is full.
+ */
+void
+__wt_iobuf_put(WT_SESSION_IMPL *session, void *p, size_t memsize)
+{
+	WT_IOBUF_POOL *pool;
+	size_t class_size;
+	u_int slot;
+
+	pool = S2C(session)->iobuf_pool;
+
+	if (pool != NULL &&
+	    __iobuf_class(memsize, &slot, &class_size) == 0) {
+		WT_ASSERT(session, class_size == memsize);
+
+		__wt_spin_lock(session, &pool->lock);
+		if (pool->bytes + memsize <= pool->bytes_max) {
+			*(void **)p = pool->free[slot];
+			pool->free[slot] = p;
+			pool->bytes += memsize;
+			p = NULL;
+		}
+		__wt_spin_unlock(session, &pool->lock);
+	}
+	if (p != NULL)
+		__wt_free(session, p);
+}
+
+/*
+ * __wt_iobuf_open --
+ *	Create the connection's pool of I/O buffers.
+ */
+int
+__wt_iobuf_open(WT_CONNECTION_IMPL *conn, uint64_t bytes_max)
+{
+	WT_IOBUF_POOL *pool;
+	WT_SESSION_IMPL *session;
+
+	session = conn->default_session;
+
+	if (bytes_max == 0)
+		return (0);
+
+	WT_RET(__wt_calloc_def(session, 1, &pool));
+	__wt_spin_init(session, &pool->lock);
+	pool->bytes_max = bytes_max;
+	conn->iobuf_pool = pool;
+	return (0);
+}
+
+/*
+ * __wt_iobuf_close --
+ *	Discard the connection's pool of I/O buffers.
+ */
+void
+__wt_iobuf_close(WT_CONNECTION_IMPL *conn)
+{
+	WT_IOBUF_POOL *pool;
+	WT_SESSION_IMPL *session;
+	u_int slot;
+	void *p;
+
+	session = conn->default_session;
+
+	if ((pool = conn->iobuf_pool) == NULL)
+		return;
+
+	for (slot = 0; slot < WT_IOBUF_SLOTS; ++slot)
+		while ((p = pool->free[slot]) != NULL) {
+			pool->free[slot] = *(void **)p;
+			__wt_free(session, p);
+		}
+	__wt_spin_destroy(session, &pool->lock);
+	__wt_free(session, conn->iobuf_pool);
+}
@@ -22,7 +22,11 @@ __wt_buf_clear(WT_ITEM *buf)
 	buf->mem = NULL;
 	buf->memsize = 0;
 
-	/* Note: don't clear the flags, the buffer remains marked in-use. */
+	/*
+	 * Note: don't clear the flags, the buffer remains marked in-use; the
+	 * memory is no longer from the pool of I/O buffers.
+	 */
+	F_CLR(buf, WT_ITEM_POOLED);
 }
 
 /*
@@ -55,12 +59,17 @@ __wt_buf_grow(WT_SESSION_IMPL *session, WT_ITEM *buf, size_t size)
 			set_data = 0;
 		}
 
+		/*
+		 * Memory from the pool of I/O buffers isn't returned once it's
+		 * been reallocated: the size is no longer a pool size.
+		 */
 		if (F_ISSET(buf, WT_ITEM_ALIGNED))
 			WT_RET(__wt_realloc_aligned(
 			    session, &buf->memsize, size, &buf->mem));
 		else
 			WT_RET(__wt_realloc(
 			    session, &buf->memsize, size, &buf->mem));
+		F_CLR(buf, WT_ITEM_POOLED);
 
 		if (set_data)
 			buf->data = (uint8_t *)buf->mem + offset;
@@ -172,7 +181,10 @@ __wt_buf_steal(WT_SESSION_IMPL *session, WT_ITEM *buf, uint32_t *sizep)
 void
 __wt_buf_free(WT_SESSION_IMPL *session, WT_ITEM *buf)
 {
-	__wt_free(session, buf->mem);
+	if (F_ISSET(buf, WT_ITEM_POOLED))
+		__wt_iobuf_put(session, buf->mem, buf->memsize);
+	else
+		__wt_free(session, buf->mem);
 	__wt_buf_clear(buf);
 }
 
@@ -21,6 +21,9 @@ __wt_stat_alloc_btree_stats(WT_SESSION_IMPL *session, WT_BTREE_STATS **statsp)
 	stats->extend.desc = "file: block allocations required file extension";
 	stats->file_allocsize.desc = "page size allocation unit";
 	stats->file_bulk_loaded.desc = "bulk-loaded entries";
+	stats->file_bytes_dirty.desc = "file: dirty bytes held in the cache";
+	stats->file_bytes_inuse.desc =
+	    "file: bytes currently held in the cache";
 	stats->file_col_deleted.desc = "column-store deleted values";
 	stats->file_col_fix_pages.desc = "column-store fixed-size leaf pages";
 	stats->file_col_int_pages.desc = "column-store internal pages";
@@ -29,6 +32,7 @@ __wt_stat_alloc_btree_stats(WT_SESSION_IMPL *session, WT_BTREE_STATS **statsp)
 	stats->file_compact_rewrite.desc = "pages rewritten by compaction";
 	stats->file_entries.desc = "total entries";
 	stats->file_fixed_len.desc = "fixed-record size";
+	stats->file_insert_retries.desc = "skiplist insert retries";
 	stats->file_magic.desc = "magic number";
 	stats->file_major.desc = "major version number";
 	stats->file_maxintlitem.desc = "maximum internal page item size";
@@ -48,8 +52,11 @@ __wt_stat_alloc_btree_stats(WT_SESSION_IMPL *session, WT_BTREE_STATS **statsp)
 	stats->page_evict.desc = "file: pages evicted from the file";
 	stats->page_evict_fail.desc =
 	    "file: pages that were selected for eviction that could not be evicted";
+	stats->page_evict_queued.desc = "file: pages queued for eviction";
 	stats->page_read.desc = "file: pages read from the file";
 	stats->page_write.desc = "file: pages written to the file";
+	stats->page_write_staged.desc =
+	    "file: pages staged for batched checkpoint writes";
 	stats->rec_dictionary.desc = "reconcile: dictionary match";
 	stats->rec_hazard.desc =
 	    "reconcile: unable to acquire hazard reference";
@@ -85,6 +92,8 @@ __wt_stat_clear_btree_stats(WT_STATS *stats_arg)
 	stats->extend.v = 0;
 	stats->file_allocsize.v = 0;
 	stats->file_bulk_loaded.v = 0;
+	stats->file_bytes_dirty.v = 0;
+	stats->file_bytes_inuse.v = 0;
 	stats->file_col_deleted.v = 0;
 	stats->file_col_fix_pages.v = 0;
 	stats->file_col_int_pages.v = 0;
@@ -92,6 +101,7 @@ __wt_stat_clear_btree_stats(WT_STATS *stats_arg)
 	stats->file_compact_rewrite.v = 0;
 	stats->file_entries.v = 0;
 	stats->file_fixed_len.v = 0;
+	stats->file_insert_retries.v = 0;
 	stats->file_magic.v = 0;
 	stats->file_major.v = 0;
 	stats->file_maxintlitem.v = 0;
@@ -109,8 +119,10 @@ __wt_stat_clear_btree_stats(WT_STATS *stats_arg)
 	stats->overflow_value_cache.v = 0;
 	stats->page_evict.v = 0;
 	stats->page_evict_fail.v = 0;
+	stats->page_evict_queued.v = 0;
 	stats->page_read.v = 0;
 	stats->page_write.v = 0;
+	stats->page_write_staged.v = 0;
 	stats->rec_dictionary.v = 0;
 	stats->rec_hazard.v = 0;
 	stats->rec_ovfl_key.v = 0;
@@ -132,28 +144,60 @@ __wt_stat_alloc_connection_stats(WT_SESSION_IMPL *session, WT_CONNECTION_STATS *
 
 	stats->block_read.desc = "blocks read from a file";
 	stats->block_write.desc = "blocks written to a file";
+	stats->cache_bytes_bloom.desc = "cache: bytes in loaded Bloom filters";
+	stats->cache_bytes_dirty.desc =
+	    "cache: tracked dirty bytes in the cache";
 	stats->cache_bytes_inuse.desc =
 	    "cache: bytes currently held in the cache";
 	stats->cache_bytes_max.desc = "cache: maximum bytes configured";
+	stats->cache_evict_dirty.desc =
+	    "cache: eviction server passes triggered by dirty bytes";
 	stats->cache_evict_hazard.desc =
 	    "cache: pages selected for eviction not evicted because of a hazard reference";
 	stats->cache_evict_internal.desc = "cache: internal pages evicted";
+	stats->cache_evict_lock_wait.desc =
+	    "cache: eviction queue lock wait time (usecs)";
 	stats->cache_evict_modified.desc = "cache: modified pages evicted";
 	stats->cache_evict_slow.desc =
 	    "cache: eviction server unable to reach eviction goal";
+	stats->cache_evict_tree_hot.desc =
+	    "cache: eviction server trees skipped because all pages were recently used";
+	stats->cache_evict_tree_supply.desc =
+	    "cache: eviction server trees that supplied eviction candidates";
+	stats->cache_evict_tree_walk.desc =
+	    "cache: eviction server trees walked";
 	stats->cache_evict_unmodified.desc = "cache: unmodified pages evicted";
+	stats->cache_evict_worker_bytes.desc =
+	    "cache: bytes written by eviction worker threads";
+	stats->cache_evict_worker_pages.desc =
+	    "cache: pages evicted by eviction worker threads";
+	stats->cache_evict_worker_usecs.desc =
+	    "cache: eviction worker thread time reconciling pages (usecs)";
 	stats->cache_pages_inuse.desc =
 	    "cache: pages currently held in the cache";
+	stats->cache_read_ahead.desc = "cache: pages queued for read-ahead";
+	stats->cache_read_ahead_hit.desc =
+	    "cache: read-ahead pages used by a cursor";
+	stats->cache_read_ahead_wasted.desc =
+	    "cache: read-ahead pages discarded without being used";
 	stats->checkpoint.desc = "checkpoints";
 	stats->cond_wait.desc = "condition wait calls";
 	stats->file_open.desc = "files currently open";
+	stats->io_batch.desc = "I/O: batches of reads or writes";
+	stats->io_batch_calls.desc =
+	    "I/O: calls to issue batches of reads or writes";
+	stats->iobuf_alloc.desc = "I/O: buffers allocated for the buffer pool";
+	stats->iobuf_reuse.desc = "I/O: buffers reused from the buffer pool";
+	stats->log_bytes_written.desc = "log: bytes written";
+	stats->log_records.desc = "log: records written";
+	stats->log_syncs.desc = "log: sync operations";
+	stats->log_writes.desc = "log: write operations";
 	stats->memalloc.desc = "total memory allocations";
 	stats->memfree.desc = "total memory frees";
 	stats->rwlock_rdlock.desc = "rwlock readlock calls";
 	stats->rwlock_wrlock.desc = "rwlock writelock calls";
 	stats->total_read_io.desc = "total read I/Os";
 	stats->total_write_io.desc = "total write I/Os";
-	stats->txn_ancient.desc = "ancient transactions";
 	stats->txn_begin.desc = "transactions";
 	stats->txn_commit.desc = "transactions committed";
 	stats->txn_fail_cache.desc =
@@ -172,27 +216,72 @@ __wt_stat_clear_connection_stats(WT_STATS *stats_arg)
 	stats = (WT_CONNECTION_STATS *)stats_arg;
 	stats->block_read.v = 0;
 	stats->block_write.v = 0;
+	stats->cache_evict_dirty.v = 0;
 	stats->cache_evict_hazard.v = 0;
 	stats->cache_evict_internal.v = 0;
+	stats->cache_evict_lock_wait.v = 0;
 	stats->cache_evict_modified.v = 0;
 	stats->cache_evict_slow.v = 0;
+	stats->cache_evict_tree_hot.v = 0;
+	stats->cache_evict_tree_supply.v = 0;
+	stats->cache_evict_tree_walk.v = 0;
 	stats->cache_evict_unmodified.v = 0;
+	stats->cache_evict_worker_bytes.v = 0;
+	stats->cache_evict_worker_pages.v = 0;
+	stats->cache_evict_worker_usecs.v = 0;
+	stats->cache_read_ahead.v = 0;
+	stats->cache_read_ahead_hit.v = 0;
+	stats->cache_read_ahead_wasted.v = 0;
 	stats->checkpoint.v = 0;
 	stats->cond_wait.v = 0;
 	stats->file_open.v = 0;
+	stats->io_batch.v = 0;
+	stats->io_batch_calls.v = 0;
+	stats->iobuf_alloc.v = 0;
+	stats->iobuf_reuse.v = 0;
+	stats->log_bytes_written.v = 0;
+	stats->log_records.v = 0;
+	stats->log_syncs.v = 0;
+	stats->log_writes.v = 0;
 	stats->memalloc.v = 0;
 	stats->memfree.v = 0;
 	stats->rwlock_rdlock.v = 0;
 	stats->rwlock_wrlock.v = 0;
 	stats->total_read_io.v = 0;
 	stats->total_write_io.v = 0;
-	stats->txn_ancient.v = 0;
 	stats->txn_begin.v = 0;
 	stats->txn_commit.v = 0;
 	stats->txn_fail_cache.v = 0;
 	stats->txn_rollback.v = 0;
 }
 
+int
+__wt_stat_alloc_evict_worker_stats(WT_SESSION_IMPL *session, WT_EVICT_WORKER_STATS **statsp)
+{
+	WT_EVICT_WORKER_STATS *stats;
+
+	WT_RET(__wt_calloc_def(session, 1, &stats));
+
+	stats->bytes_write.desc = "eviction worker: bytes written";
+	stats->pages_evict.desc = "eviction worker: pages evicted";
+	stats->rec_usecs.desc =
+	    "eviction worker: time reconciling pages (usecs)";
+
+	*statsp = stats;
+	return (0);
+}
+
+void
+__wt_stat_clear_evict_worker_stats(WT_STATS *stats_arg)
+{
+	WT_EVICT_WORKER_STATS *stats;
+
+	stats = (WT_EVICT_WORKER_STATS *)stats_arg;
+	stats->bytes_write.v = 0;
+	stats->pages_evict.v = 0;
+	stats->rec_usecs.v = 0;
+}
+
 int
 __wt_stat_alloc_lsm_stats(WT_SESSION_IMPL *session, WT_LSM_STATS **statsp)
 {
@@ -220,8 +309,28 @@ __wt_stat_alloc_lsm_stats(WT_SESSION_IMPL *session, WT_LSM_STATS **statsp)
 	stats->chunk_count.desc = "Number of chunks in the LSM tree";
 	stats->generation_max.desc =
 	    "Highest merge generation in the LSM tree";
+	stats->merge_count.desc = "Number of merges completed";
+	stats->merge_rows.desc = "Number of rows written by merges";
+	stats->merge_tombstones.desc =
+	    "Number of deleted records dropped by minor merges";
+	stats->merge_usecs.desc = "Time spent merging, in microseconds";
 	stats->search_miss_no_bloom.desc =
 	    "Number of queries that could have benefited from a bloom filter that did not exist";
+	stats->search_range_skips.desc =
+	    "Number of chunk searches skipped because the key was outside the chunk's key range";
+	stats->unmerged_chunks.desc =
+	    "Number of chunks written from memory waiting to be merged";
+	stats->unmerged_size.desc =
+	    "Size of the chunks written from memory waiting to be merged";
+	stats->write_stall.desc =
+	    "Number of writes stopped until merges caught up";
+	stats->write_stalled.desc = "Writes are stopped until merges catch up";
+	stats->write_throttle.desc =
+	    "Number of writes slowed down to wait for merges";
+	stats->write_throttle_delay.desc =
+	    "Current delay added to each write to wait for merges, in microseconds";
+	stats->write_throttle_usecs.desc =
+	    "Time writes spent waiting for merges, in microseconds";
 
 	*statsp = stats;
 	return (0);
@@ -248,5 +357,17 @@ __wt_stat_clear_lsm_stats(WT_STATS *stats_arg)
 	stats->chunk_cache_read.v = 0;
 	stats->chunk_count.v = 0;
 	stats->generation_max.v = 0;
+	stats->merge_count.v = 0;
+	stats->merge_rows.v = 0;
+	stats->merge_tombstones.v = 0;
+	stats->merge_usecs.v = 0;
 	stats->search_miss_no_bloom.v = 0;
+	stats->search_range_skips.v = 0;
+	stats->unmerged_chunks.v = 0;
+	stats->unmerged_size.v = 0;
+	stats->write_stall.v = 0;
+	stats->write_stalled.v = 0;
+	stats->write_throttle.v = 0;
+	stats->write_throttle_delay.v = 0;
+	stats->write_throttle_usecs.v = 0;
 }
@@ -19,7 +19,7 @@ __wt_txnid_cmp(const void *v1, const void *v2)
 	id1 = *(wt_txnid_t *)v1;
 	id2 = *(wt_txnid_t *)v2;
 
-	return ((id1 == id2) ? 0 : TXNID_LT(id1, id2) ? -1 : 1);
+	return ((id1 == id2) ? 0 : id1 < id2 ? -1 : 1);
 }
 
 /*
@@ -40,7 +40,7 @@ __txn_sort_snapshot(WT_SESSION_IMPL *session,
 	txn->snap_min = (n == 0) ? id : txn->snapshot[0];
 	txn->snap_max = id;
 	WT_ASSERT(session, txn->snap_min != WT_TXN_NONE);
-	txn->oldest_snap_min = TXNID_LT(oldest_snap_min, txn->snap_min) ?
+	txn->oldest_snap_min = oldest_snap_min < txn->snap_min ?
 	    oldest_snap_min : txn->snap_min;
 }
 
@@ -52,46 +52,93 @@ void
 __wt_txn_release_snapshot(WT_SESSION_IMPL *session)
 {
 	WT_TXN *txn;
+	WT_TXN_GLOBAL *txn_global;
 	WT_TXN_STATE *txn_state;
+	wt_txnid_t snap_min;
 
 	txn = &session->txn;
-	txn_state = &S2C(session)->txn_global.states[session->id];
+	txn_global = &S2C(session)->txn_global;
+	txn_state = &txn_global->states[session->id];
 
+	snap_min = txn_state->snap_min;
 	txn->snapshot_count = 0;
 	txn_state->snap_min = WT_TXN_NONE;
+
+	/*
+	 * If this snapshot may have been holding back the oldest ID, move it
+	 * forward.  Otherwise, releasing the snapshot can't change the oldest
+	 * ID and we avoid scanning the other sessions.
+	 */
+	if (snap_min != WT_TXN_NONE && snap_min == txn_global->oldest_id)
+		__wt_txn_update_oldest(session);
 }
 
 /*
- * __wt_txn_get_oldest --
- *	Update the current transaction's cached copy of the oldest snap_min
- *	value.
+ * __wt_txn_update_oldest --
+ *	Sweep the running transactions to update the cached oldest ID.
  */
 void
-__wt_txn_get_oldest(WT_SESSION_IMPL *session)
+__wt_txn_update_oldest(WT_SESSION_IMPL *session)
 {
 	WT_CONNECTION_IMPL *conn;
-	WT_TXN *txn;
 	WT_TXN_GLOBAL *txn_global;
 	WT_TXN_STATE *s;
-	wt_txnid_t id, oldest_snap_min;
+	wt_txnid_t current_id, id, oldest_id, prev_oldest_id;
 	uint32_t i, session_cnt;
 
 	conn = S2C(session);
-	txn = &session->txn;
 	txn_global = &conn->txn_global;
-	oldest_snap_min =
-	    (txn->id != WT_TXN_NONE) ? txn->id : txn_global->current;
-
-	WT_ORDERED_READ(session_cnt, conn->session_cnt);
-	for (i = 0, s = txn_global->states;
-	    i < session_cnt;
-	    i++, s++) {
-		if ((id = s->snap_min) != WT_TXN_NONE &&
-		    TXNID_LT(id, oldest_snap_min))
-			oldest_snap_min = id;
-	}
 
-	txn->oldest_snap_min = oldest_snap_min;
+	do {
+		/* Take a copy of the current session ID. */
+		current_id = oldest_id = txn_global->current;
+
+		/* Walk the array of concurrent transactions. */
+		WT_ORDERED_READ(session_cnt, conn->session_cnt);
+		for (i = 0, s = txn_global->states;
+		    i < session_cnt;
+		    i++, s++) {
+			if ((id = s->id) != WT_TXN_NONE && id < oldest_id)
+				oldest_id = id;
+			if ((id = s->snap_min) != WT_TXN_NONE &&
+			    id < oldest_id)
+				oldest_id = id;
+		}
+
+		/*
+		 * Ensure the snapshot reads are scheduled before re-checking
+		 * the global current ID.
+		 */
+		WT_READ_BARRIER();
+	} while (current_id != txn_global->current);
+
+	/*
+	 * Threads can race to update the oldest ID: only ever move it forward.
+	 * A value that is too old is safe, it just keeps old updates around
+	 * for longer than necessary.
+	 */
+	do {
+		prev_oldest_id = txn_global->oldest_id;
+		if (prev_oldest_id >= oldest_id)
+			break;
+	} while (!WT_ATOMIC_CAS(txn_global->oldest_id,
+	    prev_oldest_id, oldest_id));
+}
+
+/*
+ * __wt_txn_get_oldest --
+ *	Update the current transaction's cached copy of the oldest snap_min
+ *	value.
+ */
+void
+__wt_txn_get_oldest(WT_SESSION_IMPL *session)
+{
+	WT_TXN *txn;
+
+	txn = &session->txn;
+
+	__wt_txn_update_oldest(session);
+	txn->oldest_snap_min = S2C(session)->txn_global.oldest_id;
 }
 
 /*
@@ -106,7 +153,7 @@ __wt_txn_get_snapshot(
 	WT_TXN *txn;
 	WT_TXN_GLOBAL *txn_global;
 	WT_TXN_STATE *s, *txn_state;
-	wt_txnid_t current_id, id, oldest_snap_min;
+	wt_txnid_t current_id, id;
 	uint32_t i, n, session_cnt;
 
 	conn = S2C(session);
@@ -116,9 +163,12 @@ __wt_txn_get_snapshot(
 
 	do {
 		/* Take a copy of the current session ID. */
-		current_id = oldest_snap_min = txn_global->current;
+		current_id = txn_global->current;
 
-		/* Copy the array of concurrent transactions. */
+		/*
+		 * Copy the array of concurrent transactions.  We only need the
+		 * IDs: the oldest ID is cached in the global state.
+		 */
 		WT_ORDERED_READ(session_cnt, conn->session_cnt);
 		for (i = n = 0, s = txn_global->states;
 		    i < session_cnt;
@@ -126,12 +176,9 @@ __wt_txn_get_snapshot(
 			/* Ignore the session's own transaction. */
 			if (i == session->id)
 				continue;
-			if ((id = s->snap_min) != WT_TXN_NONE)
-				if (TXNID_LT(id, oldest_snap_min))
-					oldest_snap_min = id;
 			if ((id = s->id) == WT_TXN_NONE)
 				continue;
-			else if (max_id == WT_TXN_NONE || TXNID_LT(id, max_id))
+			else if (max_id == WT_TXN_NONE || id < max_id)
 				txn->snapshot[n++] = id;
 		}
 
@@ -144,9 +191,9 @@ __wt_txn_get_snapshot(
 
 	__txn_sort_snapshot(session, n,
 	    (max_id != WT_TXN_NONE) ? max_id : current_id,
-	    oldest_snap_min);
+	    txn_global->oldest_id);
 	txn_state->snap_min =
-	    (my_id == WT_TXN_NONE || TXNID_LT(txn->snap_min, my_id)) ?
+	    (my_id == WT_TXN_NONE || txn->snap_min < my_id) ?
 	    txn->snap_min : my_id;
 }
 
@@ -158,34 +205,15 @@ __wt_txn_get_snapshot(
 void
 __wt_txn_get_evict_snapshot(WT_SESSION_IMPL *session)
 {
-	WT_CONNECTION_IMPL *conn;
-	WT_TXN_GLOBAL *txn_global;
-	WT_TXN_STATE *s;
-	wt_txnid_t current_id, id, oldest_snap_min;
-	uint32_t i, session_cnt;
-
-	conn = S2C(session);
-	txn_global = &conn->txn_global;
-
-	do {
-		/* Take a copy of the current session ID. */
-		current_id = oldest_snap_min = txn_global->current;
+	wt_txnid_t oldest_id;
 
-		/* Walk the array of concurrent transactions. */
-		WT_ORDERED_READ(session_cnt, conn->session_cnt);
-		for (i = 0, s = txn_global->states; i < session_cnt; i++, s++)
-			if ((id = s->snap_min) != WT_TXN_NONE &&
-			    TXNID_LT(id, oldest_snap_min))
-				oldest_snap_min = id;
-
-		/*
-		 * Ensure the snapshot reads are scheduled before re-checking
-		 * the global current ID.
-		 */
-		WT_READ_BARRIER();
-	} while (current_id != txn_global->current);
+	/*
+	 * Use the cached oldest ID: the eviction server updates it each time
+	 * it walks the cache, so it is never far behind.
+	 */
+	oldest_id = S2C(session)->txn_global.oldest_id;
 
-	__txn_sort_snapshot(session, 0, oldest_snap_min, oldest_snap_min);
+	__txn_sort_snapshot(session, 0, oldest_id, oldest_id);
 	/*
 	 * Note that we carefully don't update the global table with this
 	 * snap_min value: there is already a running transaction in this
@@ -205,7 +233,7 @@ __wt_txn_begin(WT_SESSION_IMPL *session, const char *cfg[])
 	WT_TXN *txn;
 	WT_TXN_GLOBAL *txn_global;
 	WT_TXN_STATE *s, *txn_state;
-	wt_txnid_t id, oldest_snap_min;
+	wt_txnid_t id;
 	uint32_t i, n, session_cnt;
 
 	conn = S2C(session);
@@ -225,6 +253,18 @@ __wt_txn_begin(WT_SESSION_IMPL *session, const char *cfg[])
 		    WT_STRING_MATCH("read-committed", cval.str, cval.len) ?
 		    TXN_ISO_READ_COMMITTED : TXN_ISO_READ_UNCOMMITTED;
 
+	WT_RET(__wt_config_gets_defno(session, cfg, "sync", &cval));
+	if (cval.len == 0)
+		txn->sync = TXN_SYNC_FULL;
+	else
+		txn->sync =
+		    WT_STRING_MATCH("full", cval.str, cval.len) ?
+		    TXN_SYNC_FULL :
+		    WT_STRING_MATCH("flush", cval.str, cval.len) ?
+		    TXN_SYNC_FLUSH :
+		    WT_STRING_MATCH("write", cval.str, cval.len) ?
+		    TXN_SYNC_WRITE : TXN_SYNC_NONE;
+
 	F_SET(txn, TXN_RUNNING);
 
 	do {
@@ -249,7 +289,6 @@ __wt_txn_begin(WT_SESSION_IMPL *session, const char *cfg[])
 			txn->id = WT_ATOMIC_ADD(txn_global->current, 1);
 		} while (txn->id == WT_TXN_NONE || txn->id == WT_TXN_ABORTED);
 		WT_PUBLISH(txn_state->id, txn->id);
-		oldest_snap_min = txn->id;
 
 		/*
 		 * If we are starting a snapshot isolation transaction, get
@@ -264,18 +303,12 @@ __wt_txn_begin(WT_SESSION_IMPL *session, const char *cfg[])
 			WT_ORDERED_READ(session_cnt, conn->session_cnt);
 			for (i = n = 0, s = txn_global->states;
 			    i < session_cnt;
-			    i++, s++) {
-				if ((id = s->snap_min) != WT_TXN_NONE)
-					if (TXNID_LT(id, oldest_snap_min))
-						oldest_snap_min = id;
-				if ((id = s->id) == WT_TXN_NONE)
-					continue;
-				else
+			    i++, s++)
+				if ((id = s->id) != WT_TXN_NONE)
 					txn->snapshot[n++] = id;
-			}
 
 			__txn_sort_snapshot(
-			    session, n, txn->id, oldest_snap_min);
+			    session, n, txn->id, txn_global->oldest_id);
 			txn_state->snap_min = txn->snap_min;
 		}
 
@@ -301,6 +334,7 @@ __wt_txn_release(WT_SESSION_IMPL *session)
 
 	txn = &session->txn;
 	txn->mod_count = txn->modref_count = 0;
+	txn->logrec.size = 0;
 	txn_state = &S2C(session)->txn_global.states[session->id];
 
 	/* Clear the transaction's ID from the global table. */
@@ -328,9 +362,10 @@ __wt_txn_release(WT_SESSION_IMPL *session)
 int
 __wt_txn_commit(WT_SESSION_IMPL *session, const char *cfg[])
 {
+	WT_DECL_RET;
+	WT_LOG *log;
 	WT_TXN *txn;
-
-	WT_UNUSED(cfg);
+	int logging;
 
 	txn = &session->txn;
 	WT_ASSERT(session, !F_ISSET(txn, TXN_ERROR));
@@ -338,6 +373,22 @@ __wt_txn_commit(WT_SESSION_IMPL *session, const char *cfg[])
 	if (!F_ISSET(txn, TXN_RUNNING))
 		WT_RET_MSG(session, EINVAL, "No transaction is active");
 
+	/*
+	 * Write the commit record: if that fails, the transaction can't be
+	 * made durable, roll it back.  A checkpoint can't start between the
+	 * commit record being written and the transaction becoming visible.
+	 */
+	log = S2C(session)->log;
+	logging = log != NULL && txn->logrec.size != 0;
+	if (logging)
+		__wt_readlock(session, log->ckpt_lock);
+	if ((ret = __wt_txn_log_commit(session)) != 0) {
+		if (logging)
+			__wt_rwunlock(session, log->ckpt_lock);
+		WT_TRET(__wt_txn_rollback(session, cfg));
+		return (ret);
+	}
+
 	/*
 	 * Auto-commit transactions need a new transaction snapshot so that the
 	 * committed changes are visible to subsequent reads.  However, cursor
@@ -349,6 +400,8 @@ __wt_txn_commit(WT_SESSION_IMPL *session, const char *cfg[])
 	if (session->ncursors > 0)
 		__wt_txn_get_snapshot(session, txn->id, WT_TXN_NONE);
 	__wt_txn_release(session);
+	if (logging)
+		__wt_rwunlock(session, log->ckpt_lock);
 	return (0);
 }
 
@@ -360,7 +413,7 @@ int
 __wt_txn_rollback(WT_SESSION_IMPL *session, const char *cfg[])
 {
 	WT_TXN *txn;
-	wt_txnid_t **m;
+	WT_UPDATE **m;
 	WT_REF **rp;
 	u_int i;
 
@@ -372,7 +425,7 @@ __wt_txn_rollback(WT_SESSION_IMPL *session, const char *cfg[])
 
 	/* Rollback updates. */
 	for (i = 0, m = txn->mod; i < txn->mod_count; i++, m++)
-		**m = WT_TXN_ABORTED;
+		(*m)->txnid = WT_TXN_ABORTED;
 
 	/* Rollback fast deletes. */
 	for (i = 0, rp = txn->modref; i < txn->modref_count; i++, rp++)
@@ -423,6 +476,7 @@ __wt_txn_destroy(WT_SESSION_IMPL *session)
 	__wt_free(session, txn->mod);
 	__wt_free(session, txn->modref);
 	__wt_free(session, txn->snapshot);
+	__wt_buf_free(session, &txn->logrec);
 }
 
 /*
@@ -440,10 +494,17 @@ __wt_txn_global_init(WT_CONNECTION_IMPL *conn, const char *cfg[])
 	WT_UNUSED(cfg);
 	session = conn->default_session;
 	txn_global = &conn->txn_global;
-	txn_global->current = 1;
+	txn_global->current = txn_global->oldest_id = 1;
 
-	WT_RET(__wt_calloc_def(
-	    session, conn->session_size, &txn_global->states));
+	/*
+	 * The states are padded to a cache line: start the array on a cache
+	 * line boundary too, or every state straddles two lines.  The memory
+	 * comes from posix_memalign, which is released with free, so the usual
+	 * __wt_free works in __wt_txn_global_destroy.
+	 */
+	WT_RET(__wt_calloc_aligned(session,
+	    conn->session_size, sizeof(WT_TXN_STATE),
+	    WT_CACHE_LINE_ALIGNMENT, &txn_global->states));
 	for (i = 0, s = txn_global->states; i < conn->session_size; i++, s++)
 		s->id = s->snap_min = WT_TXN_NONE;
 
@@ -20,12 +20,15 @@ __wt_txn_checkpoint(WT_SESSION_IMPL *session, const char *cfg[])
 	WT_CONFIG_ITEM cval, k, v;
 	WT_DECL_ITEM(tmp);
 	WT_DECL_RET;
+	WT_LOG *log;
+	WT_LSN ckpt_lsn;
 	WT_SESSION *wt_session;
 	WT_TXN *txn;
 	void *saved_meta_next;
 	int ckpt_closed, target_list, tracking;
 
 	conn = S2C(session);
+	log = conn->log;
 	target_list = tracking = 0;
 	txn = &session->txn;
 
@@ -42,8 +45,20 @@ __wt_txn_checkpoint(WT_SESSION_IMPL *session, const char *cfg[])
 	    !F_ISSET(txn, TXN_RUNNING));
 	__wt_spin_lock(session, &conn->metadata_lock);
 
+	/*
+	 * If logging, choose the LSN recovery will start from if this is the
+	 * last checkpoint: take the snapshot and the LSN together, blocking
+	 * commits between writing their commit record and becoming visible.
+	 */
 	wt_session = &session->iface;
-	WT_ERR(wt_session->begin_transaction(wt_session, "isolation=snapshot"));
+	if (log != NULL)
+		__wt_writelock(session, log->ckpt_lock);
+	ret = wt_session->begin_transaction(wt_session, "isolation=snapshot");
+	if (log != NULL) {
+		__wt_log_ckpt_lsn(session, &ckpt_lsn);
+		__wt_rwunlock(session, log->ckpt_lock);
+	}
+	WT_ERR(ret);
 
 	WT_ERR(__wt_meta_track_on(session));
 	tracking = 1;
@@ -120,6 +135,18 @@ __wt_txn_checkpoint(WT_SESSION_IMPL *session, const char *cfg[])
 	session->meta_track_next = saved_meta_next;
 	WT_ERR(ret);
 
+	/*
+	 * Once the metadata is durable, record where recovery starts and log
+	 * the checkpoint, then remove the log files recovery no longer reads.
+	 * Checkpoints of a list of targets don't include all of the changes
+	 * before their LSN, recovery can't start from them.
+	 */
+	if (log != NULL && !target_list) {
+		WT_ERR(__wt_meta_checkpoint_lsn_set(session, &ckpt_lsn));
+		WT_ERR(__wt_log_checkpoint(session, &ckpt_lsn));
+		WT_ERR(__wt_log_archive(session, &ckpt_lsn));
+	}
+
 err:	/*
 	 * XXX
 	 * Rolling back the changes here is problematic.
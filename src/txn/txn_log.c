@@ -0,0 +1,77 @@
+/*-
+ * Copyright (c) 2008-2012 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * __wt_txn_log_op --
+ *	Append a modification made through a cursor to the transaction's log
+ * record.  Called after the update has been linked into the tree.
+ */
+int
+__wt_txn_log_op(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, int is_remove)
+{
+	WT_BTREE *btree;
+	WT_ITEM *logrec;
+	WT_TXN *txn;
+
+	btree = cbt->btree;
+	txn = &session->txn;
+	logrec = &txn->logrec;
+
+	/*
+	 * Nothing to do if logging isn't configured, there's no transaction,
+	 * or the transaction doesn't want its changes logged.  The metadata
+	 * isn't logged: it is made durable by checkpoints.
+	 */
+	if (S2C(session)->log == NULL ||
+	    !F_ISSET(txn, TXN_RUNNING) || txn->sync == TXN_SYNC_NONE ||
+	    btree == session->metafile)
+		return (0);
+
+	/* The first change made by a transaction starts its commit record. */
+	if (logrec->size == 0) {
+		WT_RET(__wt_logrec_init(session, logrec, 0));
+		WT_RET(__wt_logrec_commit_pack(session, logrec, txn->id));
+	}
+
+	switch (btree->type) {
+	case BTREE_COL_FIX:
+	case BTREE_COL_VAR:
+		return (is_remove ?
+		    __wt_logop_col_remove_pack(
+		    session, logrec, btree->name, cbt->recno) :
+		    __wt_logop_col_put_pack(session,
+		    logrec, btree->name, cbt->recno, &cbt->iface.value));
+	case BTREE_ROW:
+		return (is_remove ?
+		    __wt_logop_row_remove_pack(
+		    session, logrec, btree->name, &cbt->iface.key) :
+		    __wt_logop_row_put_pack(session, logrec,
+		    btree->name, &cbt->iface.key, &cbt->iface.value));
+	WT_ILLEGAL_VALUE(session);
+	}
+	/* NOTREACHED */
+}
+
+/*
+ * __wt_txn_log_commit --
+ *	Write the transaction's commit record to the log.
+ */
+int
+__wt_txn_log_commit(WT_SESSION_IMPL *session)
+{
+	WT_TXN *txn;
+
+	txn = &session->txn;
+
+	/* Read-only transactions have nothing to log. */
+	if (txn->logrec.size == 0)
+		return (0);
+
+	return (__wt_log_write(session, &txn->logrec, NULL, txn->sync));
+}
@@ -0,0 +1,420 @@
+/*-
+ * Copyright (c) 2008-2012 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * Recovery reads the log sequentially in a single thread and queues each
+ * operation for the worker responsible for its file, files are hashed to
+ * workers.  When enough has been queued, the workers apply their queues in
+ * parallel: operations on a file are applied in log order by one worker, and
+ * operations on different files are independent.
+ */
+#define	WT_RECOVER_WORKERS	8		/* Maximum worker threads */
+#define	WT_RECOVER_BATCH	(32 * WT_MEGABYTE)	/* Bytes per batch */
+#define	WT_RECOVER_TXN_OPS	1000		/* Operations per transaction */
+
+/* A cursor open in a recovery worker's session. */
+typedef struct {
+	char	  *uri;				/* File URI */
+	WT_CURSOR *cursor;			/* Cursor, NULL if no file */
+} WT_RECOVER_CURSOR;
+
+typedef struct {
+	WT_SESSION_IMPL *session;		/* Worker session */
+	pthread_t tid;				/* Worker thread */
+	int tid_set;				/* Worker thread running */
+	int wret;				/* Worker return */
+
+	WT_ITEM ops;				/* Queued operations */
+
+	WT_RECOVER_CURSOR *cursors;		/* Open cursors */
+	size_t cursors_alloc;
+	u_int  cursors_next;
+	u_int  last;				/* Last cursor used */
+
+	uint64_t nops;				/* Operations applied */
+} WT_RECOVER_WORKER;
+
+typedef struct {
+	WT_RECOVER_WORKER *workers;		/* Workers */
+	u_int nworkers;
+
+	size_t queued;				/* Bytes queued in this batch */
+	uint64_t ncommits;			/* Commit records read */
+} WT_RECOVER;
+
+/*
+ * __recover_cursor --
+ *	Return a worker's cursor for a file, opening it as necessary.  Returns
+ * a NULL cursor if the file no longer exists.
+ */
+static int
+__recover_cursor(
+    WT_RECOVER_WORKER *w, const char *uri, WT_CURSOR **cursorp)
+{
+	WT_DECL_RET;
+	WT_RECOVER_CURSOR *rc;
+	WT_SESSION *wt_session;
+	WT_SESSION_IMPL *session;
+	u_int i;
+
+	session = w->session;
+	wt_session = &session->iface;
+
+	/* Consecutive operations are usually on the same file. */
+	if (w->cursors_next > 0 && strcmp(w->cursors[w->last].uri, uri) == 0) {
+		*cursorp = w->cursors[w->last].cursor;
+		return (0);
+	}
+	for (i = 0, rc = w->cursors; i < w->cursors_next; i++, rc++)
+		if (strcmp(rc->uri, uri) == 0) {
+			w->last = i;
+			*cursorp = rc->cursor;
+			return (0);
+		}
+
+	if (w->cursors_next * sizeof(WT_RECOVER_CURSOR) == w->cursors_alloc)
+		WT_RET(__wt_realloc(session, &w->cursors_alloc,
+		    WT_MAX(10, 2 * w->cursors_next) *
+		    sizeof(WT_RECOVER_CURSOR), &w->cursors));
+	rc = &w->cursors[w->cursors_next];
+	WT_RET(__wt_strdup(session, uri, &rc->uri));
+
+	/*
+	 * Files dropped after the operations were logged don't exist any more,
+	 * remember that and skip their operations.
+	 */
+	if ((ret = wt_session->open_cursor(
+	    wt_session, uri, NULL, "overwrite", &rc->cursor)) != 0) {
+		rc->cursor = NULL;
+		if (ret != ENOENT && ret != WT_NOTFOUND) {
+			__wt_free(session, rc->uri);
+			return (ret);
+		}
+		WT_VERBOSE_RET(session, log,
+		    "recovery skipping %s: file not found", uri);
+	}
+
+	w->last = w->cursors_next++;
+	*cursorp = rc->cursor;
+	return (0);
+}
+
+/*
+ * __recover_op --
+ *	Apply a single logged operation.
+ */
+static int
+__recover_op(WT_RECOVER_WORKER *w, const uint8_t **pp, const uint8_t *end)
+{
+	WT_CURSOR *cursor;
+	WT_DECL_RET;
+	WT_ITEM key, value;
+	WT_SESSION_IMPL *session;
+	uint64_t recno;
+	uint32_t opsize, optype;
+	const char *uri;
+	const uint8_t *opend;
+
+	session = w->session;
+
+	WT_RET(__wt_logop_read(session, pp, end, &optype, &opsize));
+	opend = *pp + opsize;
+
+	switch (optype) {
+	case WT_LOGOP_COL_PUT:
+		WT_RET(__wt_logop_col_put_unpack(
+		    session, pp, opend, &uri, &recno, &value));
+		WT_RET(__recover_cursor(w, uri, &cursor));
+		if (cursor == NULL)
+			break;
+		cursor->set_key(cursor, recno);
+		__wt_cursor_set_raw_value(cursor, &value);
+		ret = cursor->insert(cursor);
+		break;
+	case WT_LOGOP_COL_REMOVE:
+		WT_RET(__wt_logop_col_remove_unpack(
+		    session, pp, opend, &uri, &recno));
+		WT_RET(__recover_cursor(w, uri, &cursor));
+		if (cursor == NULL)
+			break;
+		cursor->set_key(cursor, recno);
+		ret = cursor->remove(cursor);
+		break;
+	case WT_LOGOP_ROW_PUT:
+		WT_RET(__wt_logop_row_put_unpack(
+		    session, pp, opend, &uri, &key, &value));
+		WT_RET(__recover_cursor(w, uri, &cursor));
+		if (cursor == NULL)
+			break;
+		__wt_cursor_set_raw_key(cursor, &key);
+		__wt_cursor_set_raw_value(cursor, &value);
+		ret = cursor->insert(cursor);
+		break;
+	case WT_LOGOP_ROW_REMOVE:
+		WT_RET(__wt_logop_row_remove_unpack(
+		    session, pp, opend, &uri, &key));
+		WT_RET(__recover_cursor(w, uri, &cursor));
+		if (cursor == NULL)
+			break;
+		__wt_cursor_set_raw_key(cursor, &key);
+		ret = cursor->remove(cursor);
+		break;
+	WT_ILLEGAL_VALUE(session);
+	}
+
+	/* The record may have been removed before the checkpoint. */
+	if (ret == WT_NOTFOUND)
+		ret = 0;
+	*pp = opend;
+	return (ret);
+}
+
+/*
+ * __recover_worker --
+ *	Apply a worker's queued operations.
+ */
+static void *
+__recover_worker(void *arg)
+{
+	WT_DECL_RET;
+	WT_RECOVER_WORKER *w;
+	WT_SESSION *wt_session;
+	WT_SESSION_IMPL *session;
+	uint64_t n;
+	const uint8_t *end, *p;
+	int txn;
+
+	w = arg;
+	session = w->session;
+	wt_session = &session->iface;
+	txn = F_ISSET(S2C(session), WT_CONN_TRANSACTIONAL) ? 1 : 0;
+
+	/*
+	 * The replayed operations aren't logged again, they're already in the
+	 * log.  Commit regularly so the cache can evict the changes.
+	 */
+	p = w->ops.data;
+	end = p + w->ops.size;
+	for (n = 0; p < end; ++n) {
+		if (txn && n % WT_RECOVER_TXN_OPS == 0) {
+			if (n != 0)
+				WT_ERR(wt_session->commit_transaction(
+				    wt_session, NULL));
+			WT_ERR(wt_session->begin_transaction(
+			    wt_session, "sync=none"));
+		}
+		WT_ERR(__recover_op(w, &p, end));
+	}
+	if (txn && n != 0)
+		WT_ERR(wt_session->commit_transaction(wt_session, NULL));
+	w->nops += n;
+
+	if (0) {
+err:		if (F_ISSET(&session->txn, TXN_RUNNING))
+			WT_TRET(wt_session->rollback_transaction(
+			    wt_session, NULL));
+		__wt_err(session, ret, "log recovery failed");
+	}
+	w->ops.size = 0;
+	w->wret = ret;
+	return (NULL);
+}
+
+/*
+ * __recover_apply --
+ *	Apply the queued operations, in parallel.
+ */
+static int
+__recover_apply(WT_RECOVER *r)
+{
+	WT_DECL_RET;
+	WT_RECOVER_WORKER *w;
+	u_int i;
+
+	if (r->queued == 0)
+		return (0);
+
+	/* A single worker doesn't need a thread. */
+	if (r->nworkers == 1)
+		(void)__recover_worker(&r->workers[0]);
+	else {
+		for (i = 0, w = r->workers; i < r->nworkers; i++, w++)
+			if (w->ops.size != 0) {
+				if ((ret = __wt_thread_create(
+				    &w->tid, __recover_worker, w)) != 0)
+					break;
+				w->tid_set = 1;
+			}
+		for (i = 0, w = r->workers; i < r->nworkers; i++, w++)
+			if (w->tid_set) {
+				WT_TRET(__wt_thread_join(w->tid));
+				w->tid_set = 0;
+			}
+		WT_RET(ret);
+	}
+
+	for (i = 0, w = r->workers; i < r->nworkers; i++, w++)
+		WT_TRET(w->wret);
+	r->queued = 0;
+	return (ret);
+}
+
+/*
+ * __recover_record --
+ *	Queue the operations in a log record.
+ */
+static int
+__recover_record(
+    WT_SESSION_IMPL *session, WT_ITEM *logrec, WT_LSN *lsnp, void *cookie)
+{
+	WT_ITEM *ops;
+	WT_RECOVER *r;
+	uint64_t ckpt_offset, txnid;
+	uint32_t ckpt_file, opsize, optype, rectype;
+	const uint8_t *end, *p, *start;
+	const char *uri;
+
+	r = cookie;
+	p = (const uint8_t *)logrec->data + sizeof(WT_LOG_RECORD);
+	end = (const uint8_t *)logrec->data + logrec->size;
+
+	WT_RET(__wt_logrec_read(session, &p, end, &rectype));
+	switch (rectype) {
+	case WT_LOGREC_CHECKPOINT:
+		WT_RET(__wt_logrec_checkpoint_unpack(
+		    session, &p, end, &ckpt_file, &ckpt_offset));
+		WT_VERBOSE_RET(session, log,
+		    "recovery: checkpoint at %" PRIu32 "/%" PRIuMAX
+		    " (recovery LSN %" PRIu32 "/%" PRIu64 ")",
+		    lsnp->file, (uintmax_t)lsnp->offset,
+		    ckpt_file, ckpt_offset);
+		break;
+	case WT_LOGREC_COMMIT:
+		WT_RET(__wt_logrec_commit_unpack(session, &p, end, &txnid));
+		++r->ncommits;
+
+		/*
+		 * Copy each operation to the queue of the worker responsible
+		 * for its file.  Every operation starts with the file's URI.
+		 */
+		while (p < end) {
+			start = p;
+			WT_RET(__wt_logop_read(
+			    session, &p, end, &optype, &opsize));
+			WT_RET(__wt_struct_unpack(
+			    session, p, opsize, "S", &uri));
+			p += opsize;
+
+			ops = &r->workers[__wt_hash_fnv64(
+			    uri, (uint32_t)strlen(uri)) % r->nworkers].ops;
+			WT_RET(__wt_buf_grow(
+			    session, ops, ops->size + WT_PTRDIFF(p, start)));
+			memcpy((uint8_t *)ops->mem + ops->size,
+			    start, WT_PTRDIFF(p, start));
+			ops->size += WT_PTRDIFF32(p, start);
+			r->queued += WT_PTRDIFF(p, start);
+		}
+		if (r->queued >= WT_RECOVER_BATCH)
+			WT_RET(__recover_apply(r));
+		break;
+	case WT_LOGREC_DEBUG:
+	case WT_LOGREC_FILE_HEADER:
+		break;
+	WT_ILLEGAL_VALUE(session);
+	}
+
+	return (0);
+}
+
+/*
+ * __wt_txn_recover --
+ *	Replay the log from the last checkpoint.
+ */
+int
+__wt_txn_recover(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_LSN ckpt_lsn, *lsnp;
+	WT_RECOVER r;
+	WT_RECOVER_CURSOR *rc;
+	WT_RECOVER_WORKER *w;
+	WT_SESSION *wt_session;
+	uint64_t nops;
+	u_int i, j, nsessions;
+
+	conn = S2C(session);
+	WT_CLEAR(r);
+
+	/*
+	 * Start from the LSN recorded by the last checkpoint, or from the
+	 * first log file if there hasn't been a checkpoint since logging was
+	 * configured.
+	 */
+	if ((ret = __wt_meta_checkpoint_lsn(session, &ckpt_lsn)) == 0)
+		lsnp = &ckpt_lsn;
+	else if (ret == WT_NOTFOUND)
+		lsnp = NULL;
+	else
+		return (ret);
+	ret = 0;
+
+	/*
+	 * One worker session for each thread, within the application's session
+	 * limit: the rest of the slots are reserved for the connection's own
+	 * threads, see the calculation of the session array's size.
+	 */
+	nsessions = conn->session_size - WT_NUM_INTERNAL_SESSIONS -
+	    conn->evict_workers - conn->lsm_flush_workers -
+	    conn->lsm_merge_workers - conn->read_ahead_workers;
+	if (conn->io_backend != WT_IO_BACKEND_SYNC)
+		nsessions -= conn->io_threads;
+	r.nworkers = WT_MIN(WT_RECOVER_WORKERS, nsessions);
+	WT_RET(__wt_calloc_def(session, r.nworkers, &r.workers));
+	for (i = 0, w = r.workers; i < r.nworkers; i++, w++) {
+		WT_ERR(__wt_open_session(conn, 1, NULL, NULL, &w->session));
+		w->session->name = "recovery";
+	}
+
+	WT_ERR(__wt_log_scan(session, lsnp, __recover_record, &r));
+	WT_ERR(__recover_apply(&r));
+
+	nops = 0;
+	for (i = 0, w = r.workers; i < r.nworkers; i++, w++)
+		nops += w->nops;
+	WT_VERBOSE_ERR(session, log,
+	    "recovery: %" PRIu64 " commits, %" PRIu64 " operations replayed",
+	    r.ncommits, nops);
+
+	/*
+	 * If anything was replayed, checkpoint so the replayed changes don't
+	 * depend on the log any more.  Use a worker's session: the handles it
+	 * locks are released when the worker sessions are closed.
+	 */
+	if (nops != 0) {
+		wt_session = &r.workers[0].session->iface;
+		WT_ERR(wt_session->checkpoint(wt_session, NULL));
+	}
+
+err:	for (i = 0, w = r.workers; i < r.nworkers; i++, w++) {
+		for (j = 0, rc = w->cursors; j < w->cursors_next; j++, rc++) {
+			if (rc->cursor != NULL)
+				WT_TRET(rc->cursor->close(rc->cursor));
+			__wt_free(session, rc->uri);
+		}
+		__wt_free(session, w->cursors);
+		__wt_buf_free(session, &w->ops);
+		if (w->session != NULL) {
+			wt_session = &w->session->iface;
+			WT_TRET(wt_session->close(wt_session, NULL));
+		}
+	}
+	__wt_free(session, r.workers);
+	return (ret);
+}
@@ -174,7 +174,7 @@ int run(void)
 
 	g.wt_session->checkpoint(g.wt_session, NULL);
 	if ((ret = __wt_bloom_open(
-	    sess, uri, g.c_factor, g.c_k, NULL, &bloomp)) != 0)
+	    sess, uri, g.c_factor, g.c_k, NULL, NULL, &bloomp)) != 0)
 		die(ret, "__wt_bloom_open");
 	for (i = 0; i < g.c_ops; i++) {
 		item.data = g.entries[i];
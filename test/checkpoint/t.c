@@ -0,0 +1,643 @@
+/*-
+ * Copyright (c) 2008-2012 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * Test checkpoints, and the staging of checkpoint writes.
+ *
+ * Checkpoints stage their writes, and write them in batches.  First, with
+ * staging started as a checkpoint starts it, threads write, read and free
+ * blocks of the file through the block manager: blocks are read while they
+ * are staged, so the staged batch is written, or while their batch is being
+ * written by another thread, and blocks are freed while they are staged, or
+ * being written, and their space reused.  Once staging ends, every block is
+ * read again and checked.
+ *
+ * Then checkpoints run with concurrent reads and updates.  Each key is
+ * updated by a single thread, which records the key's latest generation:
+ * when the threads are done, the file is verified, then re-read to check
+ * every key has its latest value.
+ */
+#define	FNAME		"file:__ckpt.wt"	/* File name */
+#define	STAGE_DATA_MAX	(64 * 1024)		/* Maximum block data */
+#define	STAGE_SLOTS	64			/* Blocks per thread */
+
+typedef struct {
+	WT_SESSION *wt_session;			/* Thread's session */
+	u_int id;				/* Thread ID */
+	u_int gen;				/* Write generation */
+	uint32_t state;				/* Random state */
+
+	struct {				/* Blocks written */
+		uint8_t	 addr[WT_BTREE_MAX_ADDR_COOKIE];
+		uint32_t addr_size;		/* 0 if no block */
+		uint32_t len;			/* Data length */
+		u_int	 gen;			/* Data generation */
+	} slots[STAGE_SLOTS];
+} STAGER;
+
+static char *progname;				/* Program name */
+static WT_CONNECTION *conn;			/* WiredTiger connection */
+static u_int nckpts;				/* Checkpoints */
+static u_int nkeys;				/* Keys */
+static u_int readers, writers;			/* Threads */
+static u_int stagers, stage_ops;		/* Staging threads, ops */
+static volatile int running;			/* Threads run */
+static u_int *gens;				/* Key generations */
+
+static void  block_check(WT_SESSION_IMPL *, STAGER *, u_int);
+static uint8_t block_data(uint32_t, u_int, u_int);
+static void  block_free(WT_SESSION_IMPL *, STAGER *, u_int);
+static void  block_write(WT_SESSION_IMPL *, STAGER *, u_int);
+static void  check(WT_SESSION *);
+static void  die(const char *, int);
+static void  load(WT_SESSION *);
+static void *reader(void *);
+static u_int rnd(uint32_t *);
+static void  stage(void);
+static void *stager(void *);
+static void  value_check(u_int, const char *, u_int *);
+static void  value_set(u_int, u_int, char *);
+static void *writer(void *);
+static int   usage(void);
+
+int
+main(int argc, char *argv[])
+{
+	WT_SESSION *session;
+	pthread_t *tids;
+	u_int i;
+	int ch, ret;
+	char *config_open;
+
+	if ((progname = strrchr(argv[0], '/')) == NULL)
+		progname = argv[0];
+	else
+		++progname;
+
+	config_open = NULL;
+	nckpts = 10;
+	nkeys = 20000;
+	readers = 4;
+	writers = 4;
+	stagers = 4;
+	stage_ops = 5000;
+
+	while ((ch = getopt(argc, argv, "C:c:k:n:R:S:W:")) != EOF)
+		switch (ch) {
+		case 'C':			/* wiredtiger_open config */
+			config_open = optarg;
+			break;
+		case 'c':			/* checkpoints */
+			nckpts = (u_int)atoi(optarg);
+			break;
+		case 'k':			/* keys */
+			nkeys = (u_int)atoi(optarg);
+			break;
+		case 'n':			/* staging operations */
+			stage_ops = (u_int)atoi(optarg);
+			break;
+		case 'R':			/* readers */
+			readers = (u_int)atoi(optarg);
+			break;
+		case 'S':			/* staging threads */
+			stagers = (u_int)atoi(optarg);
+			break;
+		case 'W':			/* writers */
+			writers = (u_int)atoi(optarg);
+			break;
+		default:
+			return (usage());
+		}
+	argc -= optind;
+	argv += optind;
+	if (argc != 0 || writers == 0 || nkeys < writers)
+		return (usage());
+
+	if ((gens = calloc(nkeys, sizeof(*gens))) == NULL ||
+	    (tids = calloc(readers + writers, sizeof(*tids))) == NULL)
+		die("calloc", errno);
+
+	(void)system("rm -f WiredTiger* __ckpt*");
+
+	/* The cache is much smaller than the file. */
+	if ((ret = wiredtiger_open(NULL, NULL,
+	    config_open == NULL ? "create,cache_size=1MB" : config_open,
+	    &conn)) != 0)
+		die("wiredtiger_open", ret);
+	if ((ret = conn->open_session(conn, NULL, NULL, &session)) != 0)
+		die("conn.session", ret);
+
+	load(session);
+	stage();
+
+	running = 1;
+	for (i = 0; i < readers + writers; ++i)
+		if ((ret = pthread_create(&tids[i], NULL,
+		    i < writers ? writer : reader,
+		    (void *)(uintptr_t)i)) != 0)
+			die("pthread_create", ret);
+
+	for (i = 0; i < nckpts; ++i)
+		if ((ret = session->checkpoint(session, NULL)) != 0)
+			die("session.checkpoint", ret);
+
+	running = 0;
+	for (i = 0; i < readers + writers; ++i)
+		if ((ret = pthread_join(tids[i], NULL)) != 0)
+			die("pthread_join", ret);
+
+	if ((ret = session->checkpoint(session, NULL)) != 0)
+		die("session.checkpoint", ret);
+	if ((ret = conn->close(conn, NULL)) != 0)
+		die("conn.close", ret);
+
+	/* Re-open the file, verify it and check its contents. */
+	if ((ret = wiredtiger_open(NULL, NULL,
+	    config_open == NULL ? "cache_size=1MB" : config_open,
+	    &conn)) != 0)
+		die("wiredtiger_open", ret);
+	if ((ret = conn->open_session(conn, NULL, NULL, &session)) != 0)
+		die("conn.session", ret);
+	if ((ret = session->verify(session, FNAME, NULL)) != 0)
+		die("session.verify", ret);
+	check(session);
+	if ((ret = conn->close(conn, NULL)) != 0)
+		die("conn.close", ret);
+
+	free(gens);
+	free(tids);
+	return (EXIT_SUCCESS);
+}
+
+/*
+ * stage --
+ *	Write, read and free blocks while writes are staged.
+ */
+static void
+stage(void)
+{
+	STAGER *s, *stagerlist;
+	WT_SESSION *wt_session;
+	WT_SESSION_IMPL *session;
+	pthread_t *tids;
+	u_int i, j;
+	int ret;
+
+	if ((stagerlist = calloc(stagers, sizeof(*stagerlist))) == NULL ||
+	    (tids = calloc(stagers, sizeof(*tids))) == NULL)
+		die("calloc", errno);
+
+	/* Use internal session handles to access the block manager. */
+	if ((ret = conn->open_session(conn, NULL, NULL, &wt_session)) != 0)
+		die("conn.session", ret);
+	session = (WT_SESSION_IMPL *)wt_session;
+	if ((ret = __wt_session_get_btree(session, FNAME, NULL, NULL, 0)) != 0)
+		die("__wt_session_get_btree", ret);
+	for (i = 0; i < stagers; ++i) {
+		s = &stagerlist[i];
+		s->id = i;
+		s->state = i + 1;
+		if ((ret = conn->open_session(
+		    conn, NULL, NULL, &s->wt_session)) != 0)
+			die("conn.session", ret);
+		if ((ret = __wt_session_get_btree((WT_SESSION_IMPL *)
+		    s->wt_session, FNAME, NULL, NULL, 0)) != 0)
+			die("__wt_session_get_btree", ret);
+	}
+
+	if ((ret = __wt_bm_stage_start(session)) != 0)
+		die("__wt_bm_stage_start", ret);
+	for (i = 0; i < stagers; ++i)
+		if ((ret = pthread_create(
+		    &tids[i], NULL, stager, &stagerlist[i])) != 0)
+			die("pthread_create", ret);
+	for (i = 0; i < stagers; ++i)
+		if ((ret = pthread_join(tids[i], NULL)) != 0)
+			die("pthread_join", ret);
+	if ((ret = __wt_bm_stage_end(session)) != 0)
+		die("__wt_bm_stage_end", ret);
+
+	/*
+	 * Every block has been written: check the blocks, and free them, the
+	 * checkpoints that follow don't reference them.
+	 */
+	for (i = 0; i < stagers; ++i) {
+		s = &stagerlist[i];
+		for (j = 0; j < STAGE_SLOTS; ++j)
+			if (s->slots[j].addr_size != 0) {
+				block_check(
+				    (WT_SESSION_IMPL *)s->wt_session, s, j);
+				block_free(
+				    (WT_SESSION_IMPL *)s->wt_session, s, j);
+			}
+		if ((ret = __wt_session_release_btree(
+		    (WT_SESSION_IMPL *)s->wt_session)) != 0)
+			die("__wt_session_release_btree", ret);
+		if ((ret = s->wt_session->close(s->wt_session, NULL)) != 0)
+			die("session.close", ret);
+	}
+	if ((ret = __wt_session_release_btree(session)) != 0)
+		die("__wt_session_release_btree", ret);
+	if ((ret = wt_session->close(wt_session, NULL)) != 0)
+		die("session.close", ret);
+
+	free(stagerlist);
+	free(tids);
+}
+
+/*
+ * stager --
+ *	Write, read and free random blocks, each thread has its own blocks.
+ */
+static void *
+stager(void *arg)
+{
+	STAGER *s;
+	WT_SESSION_IMPL *session;
+	u_int i, slot;
+
+	s = arg;
+	session = (WT_SESSION_IMPL *)s->wt_session;
+
+	for (i = 0; i < stage_ops; ++i) {
+		slot = rnd(&s->state) % STAGE_SLOTS;
+		switch (rnd(&s->state) % 16) {
+		case 0:
+			if (s->slots[slot].addr_size != 0)
+				block_check(session, s, slot);
+			break;
+		case 1:
+		case 2:
+		case 3:
+			if (s->slots[slot].addr_size != 0)
+				block_free(session, s, slot);
+			break;
+		default:
+			if (s->slots[slot].addr_size != 0)
+				block_free(session, s, slot);
+			block_write(session, s, slot);
+			break;
+		}
+	}
+	return (NULL);
+}
+
+/*
+ * block_data --
+ *	Return a byte of a block's data, different for each thread and write.
+ */
+static uint8_t
+block_data(uint32_t i, u_int id, u_int gen)
+{
+	return ((uint8_t)((i * 2654435761U) >> 13) ^ (uint8_t)(gen * 31 + id));
+}
+
+/*
+ * block_write --
+ *	Write an overflow block of random size.
+ */
+static void
+block_write(WT_SESSION_IMPL *session, STAGER *s, u_int slot)
+{
+	WT_BTREE *btree;
+	WT_ITEM *buf;
+	WT_PAGE_HEADER *dsk;
+	uint32_t i, len, size;
+	uint8_t *p;
+	int ret;
+
+	btree = session->btree;
+
+	len = 1 + rnd(&s->state) % STAGE_DATA_MAX;
+	size = WT_PAGE_HEADER_BYTE_SIZE(btree) + len;
+	if ((ret = __wt_bm_write_size(session, &size)) != 0)
+		die("__wt_bm_write_size", ret);
+	buf = NULL;
+	if ((ret = __wt_scr_alloc(session, size, &buf)) != 0)
+		die("__wt_scr_alloc", ret);
+
+	dsk = buf->mem;
+	memset(dsk, 0, WT_PAGE_HEADER_SIZE);
+	dsk->type = WT_PAGE_OVFL;
+	dsk->u.datalen = len;
+	++s->gen;
+	for (p = WT_PAGE_HEADER_BYTE(btree, dsk), i = 0; i < len; ++i)
+		p[i] = block_data(i, s->id, s->gen);
+	buf->size = WT_PAGE_HEADER_BYTE_SIZE(btree) + len;
+
+	if ((ret = __wt_bm_write(session,
+	    buf, s->slots[slot].addr, &s->slots[slot].addr_size)) != 0)
+		die("__wt_bm_write", ret);
+	s->slots[slot].len = len;
+	s->slots[slot].gen = s->gen;
+
+	__wt_scr_free(&buf);
+}
+
+/*
+ * block_check --
+ *	Read a block and check its data.
+ */
+static void
+block_check(WT_SESSION_IMPL *session, STAGER *s, u_int slot)
+{
+	WT_BTREE *btree;
+	WT_ITEM buf;
+	WT_PAGE_HEADER *dsk;
+	uint32_t i, len;
+	uint8_t *p;
+	int ret;
+
+	btree = session->btree;
+	len = s->slots[slot].len;
+
+	WT_CLEAR(buf);
+	if ((ret = __wt_bm_read(session,
+	    &buf, s->slots[slot].addr, s->slots[slot].addr_size)) != 0)
+		die("__wt_bm_read", ret);
+
+	dsk = buf.mem;
+	p = WT_PAGE_HEADER_BYTE(btree, dsk);
+	for (i = 0; i < len; ++i)
+		if (p[i] != block_data(i, s->id, s->slots[slot].gen))
+			break;
+	if (dsk->type != WT_PAGE_OVFL || dsk->u.datalen != len || i < len) {
+		fprintf(stderr,
+		    "%s: thread %u: block %u: generation %u doesn't match\n",
+		    progname, s->id, slot, s->slots[slot].gen);
+		exit(EXIT_FAILURE);
+	}
+
+	__wt_buf_free(session, &buf);
+}
+
+/*
+ * block_free --
+ *	Free a block.
+ */
+static void
+block_free(WT_SESSION_IMPL *session, STAGER *s, u_int slot)
+{
+	int ret;
+
+	if ((ret = __wt_bm_free(session,
+	    s->slots[slot].addr, s->slots[slot].addr_size)) != 0)
+		die("__wt_bm_free", ret);
+	s->slots[slot].addr_size = 0;
+}
+
+/*
+ * rnd --
+ *	Return a pseudo-random number, from a per-thread state.
+ */
+static u_int
+rnd(uint32_t *statep)
+{
+	*statep = *statep * 1103515245 + 12345;
+	return ((u_int)(*statep >> 8));
+}
+
+/*
+ * value_set --
+ *	Build the value of a generation of a key.  Values vary in length, so
+ *	updated pages split and shrink, and the blocks written change size.
+ */
+static void
+value_set(u_int keyno, u_int gen, char *buf)
+{
+	size_t len;
+
+	len = (size_t)sprintf(buf, "%010u %010u ", keyno, gen);
+	memset(buf + len, 'a' + (int)(gen % 26), (keyno + gen) % 300 + 20);
+	buf[len + (keyno + gen) % 300 + 20] = '\0';
+}
+
+/*
+ * value_check --
+ *	Check a value is one of a key's values, and return its generation.
+ */
+static void
+value_check(u_int keyno, const char *value, u_int *genp)
+{
+	u_int gen, vkeyno;
+	char expect[512];
+
+	if (sscanf(value, "%10u %10u ", &vkeyno, &gen) != 2 ||
+	    vkeyno != keyno)
+		gen = 0;
+	else
+		value_set(keyno, gen, expect);
+	if (gen == 0 || strcmp(value, expect) != 0) {
+		fprintf(stderr,
+		    "%s: key %u: bad value %.40s\n", progname, keyno, value);
+		exit(EXIT_FAILURE);
+	}
+	*genp = gen;
+}
+
+/*
+ * load --
+ *	Load the first generation of every key.
+ */
+static void
+load(WT_SESSION *session)
+{
+	WT_CURSOR *cursor;
+	u_int keyno;
+	int ret;
+	char key[16], value[512];
+
+	if ((ret = session->create(session, FNAME,
+	    "key_format=S,value_format=S,leaf_page_max=4KB")) != 0)
+		die("session.create", ret);
+	if ((ret = session->open_cursor(
+	    session, FNAME, NULL, "bulk", &cursor)) != 0)
+		die("session.open_cursor", ret);
+	for (keyno = 0; keyno < nkeys; ++keyno) {
+		gens[keyno] = 1;
+		(void)sprintf(key, "%010u", keyno);
+		value_set(keyno, gens[keyno], value);
+		cursor->set_key(cursor, key);
+		cursor->set_value(cursor, value);
+		if ((ret = cursor->insert(cursor)) != 0)
+			die("cursor.insert", ret);
+	}
+	if ((ret = cursor->close(cursor)) != 0)
+		die("cursor.close", ret);
+	if ((ret = session->checkpoint(session, NULL)) != 0)
+		die("session.checkpoint", ret);
+}
+
+/*
+ * writer --
+ *	Update random keys, each writer has its own set of keys.
+ */
+static void *
+writer(void *arg)
+{
+	WT_CURSOR *cursor;
+	WT_SESSION *session;
+	uint32_t state;
+	u_int id, keyno;
+	int ret;
+	char key[16], value[512];
+
+	id = (u_int)(uintptr_t)arg;
+	state = id + 1;
+
+	if ((ret = conn->open_session(conn, NULL, NULL, &session)) != 0)
+		die("conn.session", ret);
+	if ((ret = session->open_cursor(
+	    session, FNAME, NULL, "overwrite", &cursor)) != 0)
+		die("session.open_cursor", ret);
+
+	while (running) {
+		keyno = rnd(&state) % (nkeys / writers) * writers + id;
+		(void)sprintf(key, "%010u", keyno);
+		value_set(keyno, gens[keyno] + 1, value);
+		cursor->set_key(cursor, key);
+		cursor->set_value(cursor, value);
+		if ((ret = cursor->insert(cursor)) == WT_DEADLOCK)
+			continue;
+		if (ret != 0)
+			die("cursor.insert", ret);
+		++gens[keyno];
+	}
+
+	if ((ret = session->close(session, NULL)) != 0)
+		die("session.close", ret);
+	return (NULL);
+}
+
+/*
+ * reader --
+ *	Read random keys, and scan the file.
+ */
+static void *
+reader(void *arg)
+{
+	WT_CURSOR *cursor;
+	WT_SESSION *session;
+	uint32_t state;
+	u_int gen, i, keyno;
+	int ret;
+	const char *key, *value;
+	char kbuf[16];
+
+	state = (uint32_t)(uintptr_t)arg + 1;
+
+	if ((ret = conn->open_session(conn, NULL, NULL, &session)) != 0)
+		die("conn.session", ret);
+	if ((ret = session->open_cursor(
+	    session, FNAME, NULL, NULL, &cursor)) != 0)
+		die("session.open_cursor", ret);
+
+	while (running) {
+		for (i = 0; i < 1000 && running; ++i) {
+			keyno = rnd(&state) % nkeys;
+			(void)sprintf(kbuf, "%010u", keyno);
+			cursor->set_key(cursor, kbuf);
+			if ((ret = cursor->search(cursor)) != 0 ||
+			    (ret = cursor->get_value(cursor, &value)) != 0)
+				die("cursor.search", ret);
+			value_check(keyno, value, &gen);
+		}
+		for (keyno = 0;
+		    running && (ret = cursor->next(cursor)) == 0; ++keyno) {
+			if ((ret = cursor->get_key(cursor, &key)) != 0 ||
+			    (ret = cursor->get_value(cursor, &value)) != 0)
+				die("cursor.get", ret);
+			value_check((u_int)strtoul(key, NULL, 10), value, &gen);
+		}
+		if (ret != 0 && ret != WT_NOTFOUND)
+			die("cursor.next", ret);
+		if ((ret = cursor->reset(cursor)) != 0)
+			die("cursor.reset", ret);
+	}
+
+	if ((ret = session->close(session, NULL)) != 0)
+		die("session.close", ret);
+	return (NULL);
+}
+
+/*
+ * check --
+ *	Check every key has its latest value.
+ */
+static void
+check(WT_SESSION *session)
+{
+	WT_CURSOR *cursor;
+	u_int gen, keyno;
+	int ret;
+	const char *key, *value;
+
+	if ((ret = session->open_cursor(
+	    session, FNAME, NULL, NULL, &cursor)) != 0)
+		die("session.open_cursor", ret);
+	for (keyno = 0; (ret = cursor->next(cursor)) == 0; ++keyno) {
+		if ((ret = cursor->get_key(cursor, &key)) != 0 ||
+		    (ret = cursor->get_value(cursor, &value)) != 0)
+			die("cursor.get", ret);
+		if ((u_int)strtoul(key, NULL, 10) != keyno) {
+			fprintf(stderr, "%s: key %u: found key %s\n",
+			    progname, keyno, key);
+			exit(EXIT_FAILURE);
+		}
+		value_check(keyno, value, &gen);
+		if (gen != gens[keyno]) {
+			fprintf(stderr,
+			    "%s: key %u: generation %u, expected %u\n",
+			    progname, keyno, gen, gens[keyno]);
+			exit(EXIT_FAILURE);
+		}
+	}
+	if (ret != WT_NOTFOUND)
+		die("cursor.next", ret);
+	if (keyno != nkeys) {
+		fprintf(stderr,
+		    "%s: %u keys, expected %u\n", progname, keyno, nkeys);
+		exit(EXIT_FAILURE);
+	}
+	if ((ret = cursor->close(cursor)) != 0)
+		die("cursor.close", ret);
+}
+
+/*
+ * die --
+ *	Report an error and quit.
+ */
+static void
+die(const char *m, int e)
+{
+	fprintf(stderr, "%s: %s: %s\n", progname, m, wiredtiger_strerror(e));
+	exit(EXIT_FAILURE);
+}
+
+/*
+ * usage --
+ *	Display usage statement and exit failure.
+ */
+static int
+usage(void)
+{
+	fprintf(stderr,
+	    "usage: %s [-C wiredtiger-config] [-c checkpoints] [-k keys]\n\t"
+	    "[-n staging-ops] [-R readers] [-S staging-threads] [-W writers]\n",
+	    progname);
+	fprintf(stderr, "%s",
+	    "\t-C specify wiredtiger_open configuration arguments\n"
+	    "\t-c set number of checkpoints\n"
+	    "\t-k set number of keys to load\n"
+	    "\t-n set number of operations for each staging thread\n"
+	    "\t-R set number of reader threads\n"
+	    "\t-S set number of staging threads\n"
+	    "\t-W set number of writer threads\n");
+	return (EXIT_FAILURE);
+}
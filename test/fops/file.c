@@ -91,6 +91,55 @@ obj_drop(void)
 		die("session.close", ret);
 }
 
+/*
+ * obj_load_drop --
+ *	Load enough records to fill several LSM chunks, then drop the object,
+ *	waiting longer each time: the drops race the merges of the chunks.
+ */
+void
+obj_load_drop(u_int loops)
+{
+	WT_CURSOR *cursor;
+	WT_ITEM key, value;
+	WT_SESSION *session;
+	u_int i, recno;
+	int ret;
+	char kbuf[64], vbuf[100];
+
+	if ((ret = conn->open_session(conn, NULL, NULL, &session)) != 0)
+		die("conn.session", ret);
+
+	memset(vbuf, 'a', sizeof(vbuf));
+	value.data = vbuf;
+	value.size = sizeof(vbuf);
+	for (i = 0; i < loops; ++i) {
+		if ((ret = session->create(session, uri, config)) != 0)
+			die("session.create", ret);
+		if ((ret = session->open_cursor(
+		    session, uri, NULL, NULL, &cursor)) != 0)
+			die("session.open_cursor", ret);
+		for (recno = 0; recno < 40000; ++recno) {
+			key.data = kbuf;
+			key.size = (uint32_t)sprintf(kbuf, "%010u", recno);
+			cursor->set_key(cursor, &key);
+			cursor->set_value(cursor, &value);
+			if ((ret = cursor->insert(cursor)) != 0)
+				die("cursor.insert", ret);
+		}
+		if ((ret = cursor->close(cursor)) != 0)
+			die("cursor.close", ret);
+
+		(void)usleep(i * 100000);
+		while ((ret = session->drop(session, uri, NULL)) == EBUSY)
+			(void)usleep(10000);
+		if (ret != 0)
+			die("session.drop", ret);
+	}
+
+	if ((ret = session->close(session, NULL)) != 0)
+		die("session.close", ret);
+}
+
 void
 obj_checkpoint(void)
 {
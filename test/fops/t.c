@@ -100,6 +100,7 @@ main(int argc, char *argv[])
 
 			if (fop_start(nthreads))
 				return (EXIT_FAILURE);
+			obj_load_drop(5);
 
 			wt_shutdown();
 			printf("\n");
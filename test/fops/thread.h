@@ -39,5 +39,6 @@ void obj_checkpoint(void);
 void obj_create(void);
 void obj_cursor(void);
 void obj_drop(void);
+void obj_load_drop(u_int);
 void obj_upgrade(void);
 void obj_verify(void);
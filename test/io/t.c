@@ -0,0 +1,282 @@
+/*-
+ * Copyright (c) 2008-2012 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * Test the batched I/O backends.
+ *
+ * A file is written with single system calls, and a copy of its contents is
+ * kept in memory.  Then, with each backend in turn, random batches of reads
+ * are checked against the copy, and random batches of writes are checked by
+ * reading them back with single system calls.  Batches have requests for
+ * adjacent bytes, which are merged into runs, and more requests than fit in
+ * one run, so the threads and io_uring backends issue several runs at once.
+ */
+#define	FNAME		"__io"			/* File name */
+#define	FILE_SIZE	(8 * WT_MEGABYTE)	/* File size */
+#define	REQ_UNIT	512			/* Request size/offset unit */
+#define	REQ_MAX		(64 * 1024)		/* Maximum request */
+#define	BATCH_MAX	200			/* Maximum batch */
+
+static const char *backends[] = { "sync", "threads", "io_uring" };
+
+static char *progname;				/* Program name */
+static u_int nbatches;				/* Batches per backend */
+static u_int generation;			/* Write generation */
+
+static uint8_t *copy;				/* File contents */
+static uint8_t *bufs[BATCH_MAX];		/* Request buffers */
+static WT_IO_REQ reqs[BATCH_MAX];		/* Batch */
+
+static void check(WT_SESSION_IMPL *, WT_FH *, off_t, uint32_t);
+static void die(const char *, int);
+static void fill(uint8_t *, off_t, uint32_t, u_int);
+static void run(const char *);
+static void setup(void);
+static int  usage(void);
+
+int
+main(int argc, char *argv[])
+{
+	u_int i;
+	int ch;
+
+	if ((progname = strrchr(argv[0], '/')) == NULL)
+		progname = argv[0];
+	else
+		++progname;
+
+	nbatches = 200;
+
+	while ((ch = getopt(argc, argv, "n:")) != EOF)
+		switch (ch) {
+		case 'n':			/* batches */
+			nbatches = (u_int)atoi(optarg);
+			break;
+		default:
+			return (usage());
+		}
+	argc -= optind;
+	argv += optind;
+	if (argc != 0)
+		return (usage());
+
+	if ((copy = malloc(FILE_SIZE)) == NULL)
+		die("malloc", errno);
+	for (i = 0; i < BATCH_MAX; ++i)
+		if ((bufs[i] = malloc(REQ_MAX)) == NULL)
+			die("malloc", errno);
+
+	srand(3233456);
+	setup();
+	for (i = 0; i < WT_ELEMENTS(backends); ++i)
+		run(backends[i]);
+
+	for (i = 0; i < BATCH_MAX; ++i)
+		free(bufs[i]);
+	free(copy);
+	return (EXIT_SUCCESS);
+}
+
+/*
+ * fill --
+ *	Fill a buffer with data for a range of the file, different for each
+ *	generation of writes.
+ */
+static void
+fill(uint8_t *p, off_t offset, uint32_t bytes, u_int gen)
+{
+	uint64_t v;
+	uint32_t i;
+
+	for (i = 0; i < bytes; ++i) {
+		v = (uint64_t)(offset + i) * 2654435761U;
+		p[i] = (uint8_t)(v >> 13) ^ (uint8_t)gen;
+	}
+}
+
+/*
+ * check --
+ *	Read a range of the file with a single system call and compare it with
+ *	the copy.
+ */
+static void
+check(WT_SESSION_IMPL *session, WT_FH *fh, off_t offset, uint32_t bytes)
+{
+	int ret;
+
+	if ((ret = __wt_read(session, fh, offset, bytes, bufs[0])) != 0)
+		die("__wt_read", ret);
+	if (memcmp(bufs[0], copy + offset, bytes) != 0) {
+		fprintf(stderr, "%s: %" PRIu32 " bytes at offset %" PRIu64
+		    ": file doesn't match\n",
+		    progname, bytes, (uint64_t)offset);
+		exit(EXIT_FAILURE);
+	}
+}
+
+/*
+ * setup --
+ *	Create the file, and its copy.
+ */
+static void
+setup(void)
+{
+	WT_CONNECTION *conn;
+	WT_FH *fh;
+	WT_SESSION *wt_session;
+	WT_SESSION_IMPL *session;
+	off_t offset;
+	int ret;
+
+	(void)system("rm -f WiredTiger* " FNAME);
+
+	if ((ret = wiredtiger_open(NULL, NULL, "create", &conn)) != 0)
+		die("wiredtiger_open", ret);
+	if ((ret = conn->open_session(conn, NULL, NULL, &wt_session)) != 0)
+		die("conn.session", ret);
+
+	/* Use the internal session handle to access private APIs. */
+	session = (WT_SESSION_IMPL *)wt_session;
+
+	if ((ret = __wt_open(session, FNAME, 1, 1, 0, &fh)) != 0)
+		die("__wt_open", ret);
+	fill(copy, 0, FILE_SIZE, 0);
+	for (offset = 0; offset < FILE_SIZE; offset += REQ_MAX)
+		if ((ret = __wt_write(
+		    session, fh, offset, REQ_MAX, copy + offset)) != 0)
+			die("__wt_write", ret);
+	if ((ret = __wt_close(session, fh)) != 0)
+		die("__wt_close", ret);
+
+	if ((ret = conn->close(conn, NULL)) != 0)
+		die("conn.close", ret);
+}
+
+/*
+ * run --
+ *	Check batches of reads and writes with a backend.
+ */
+static void
+run(const char *backend)
+{
+	WT_CONNECTION *conn;
+	WT_FH *fh;
+	WT_SESSION *wt_session;
+	WT_SESSION_IMPL *session;
+	off_t offset;
+	uint32_t bytes, slot, slots;
+	u_int i, j, n;
+	int ret;
+	char config[128];
+
+	(void)snprintf(config, sizeof(config),
+	    "create,io_backend=%s,io_threads=4", backend);
+	if ((ret = wiredtiger_open(NULL, NULL, config, &conn)) != 0)
+		die("wiredtiger_open", ret);
+	if ((ret = conn->open_session(conn, NULL, NULL, &wt_session)) != 0)
+		die("conn.session", ret);
+	session = (WT_SESSION_IMPL *)wt_session;
+	if ((ret = __wt_open(session, FNAME, 0, 0, 0, &fh)) != 0)
+		die("__wt_open", ret);
+
+	for (i = 0; i < nbatches; ++i) {
+		/*
+		 * Reads: random requests, some for the bytes following the
+		 * previous request so they're merged into a run, the rest at
+		 * random offsets, which may overlap.
+		 */
+		n = 1 + (u_int)rand() % BATCH_MAX;
+		for (j = 0, offset = 0; j < n; ++j) {
+			bytes = REQ_UNIT * (1 + (uint32_t)rand() %
+			    (REQ_MAX / REQ_UNIT));
+			if (j == 0 || rand() % 2 == 0 ||
+			    offset + bytes > FILE_SIZE) {
+				slot = (uint32_t)rand() %
+				    ((FILE_SIZE - bytes) / REQ_UNIT + 1);
+				offset = (off_t)slot * REQ_UNIT;
+			}
+			reqs[j].fh = fh;
+			reqs[j].offset = offset;
+			reqs[j].bytes = bytes;
+			reqs[j].buf = bufs[j];
+			offset += bytes;
+		}
+		if ((ret = __wt_read_batch(session, reqs, n)) != 0)
+			die("__wt_read_batch", ret);
+		for (j = 0; j < n; ++j)
+			if (memcmp(reqs[j].buf,
+			    copy + reqs[j].offset, reqs[j].bytes) != 0) {
+				fprintf(stderr, "%s: %s: batch %u: %" PRIu32
+				    " bytes at offset %" PRIu64
+				    ": read doesn't match\n", progname,
+				    backend, i, reqs[j].bytes,
+				    (uint64_t)reqs[j].offset);
+				exit(EXIT_FAILURE);
+			}
+
+		/*
+		 * Writes: requests can't overlap, take them from consecutive
+		 * slots of the file, the size of the largest request, so some
+		 * requests are adjacent.
+		 */
+		slots = FILE_SIZE / REQ_MAX;
+		n = 1 + (u_int)rand() % WT_MIN(BATCH_MAX, slots);
+		slot = (uint32_t)rand() % slots;
+		++generation;
+		for (j = 0; j < n; ++j, slot = (slot + 1) % slots) {
+			bytes = rand() % 2 == 0 ? REQ_MAX : REQ_UNIT *
+			    (1 + (uint32_t)rand() % (REQ_MAX / REQ_UNIT));
+			offset = (off_t)slot * REQ_MAX;
+			fill(bufs[j], offset, bytes, generation);
+			reqs[j].fh = fh;
+			reqs[j].offset = offset;
+			reqs[j].bytes = bytes;
+			reqs[j].buf = bufs[j];
+		}
+		if ((ret = __wt_write_batch(session, reqs, n)) != 0)
+			die("__wt_write_batch", ret);
+		for (j = 0; j < n; ++j)
+			memcpy(copy + reqs[j].offset,
+			    reqs[j].buf, reqs[j].bytes);
+		for (j = 0; j < n; ++j)
+			check(session, fh, reqs[j].offset, reqs[j].bytes);
+	}
+
+	/* Check the whole file. */
+	for (offset = 0; offset < FILE_SIZE; offset += REQ_MAX)
+		check(session, fh, offset, REQ_MAX);
+
+	if ((ret = __wt_close(session, fh)) != 0)
+		die("__wt_close", ret);
+	if ((ret = conn->close(conn, NULL)) != 0)
+		die("conn.close", ret);
+}
+
+/*
+ * die --
+ *	Report an error and quit.
+ */
+static void
+die(const char *m, int e)
+{
+	fprintf(stderr, "%s: %s: %s\n", progname, m, wiredtiger_strerror(e));
+	exit(EXIT_FAILURE);
+}
+
+/*
+ * usage --
+ *	Display usage statement and exit failure.
+ */
+static int
+usage(void)
+{
+	fprintf(stderr, "usage: %s [-n batches]\n", progname);
+	fprintf(stderr, "%s", "\t-n set number of batches for each backend\n");
+	return (EXIT_FAILURE);
+}
@@ -0,0 +1,409 @@
+/*-
+ * Copyright (c) 2008-2012 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include <sys/types.h>
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <wiredtiger.h>
+
+/*
+ * Test WT_CURSOR::search_batch on an LSM tree.
+ *
+ * The tree is loaded in phases, each with its own range of keys, so the
+ * on-disk chunks hold mostly disjoint ranges and have Bloom filters.  The
+ * newest phase also removes and updates keys loaded by the oldest phase, so
+ * batches find values and deletions in chunks other than the ones holding
+ * the original records.  Every key's expected value is computed, there is no
+ * copy of the data.
+ */
+#define	URI		"lsm:__batch"
+#define	STAT_URI	"statistics:lsm:__batch"
+
+#define	PHASES		3			/* Loading phases */
+#define	VALUE_LARGE	1000			/* Minimum large value */
+
+static char *progname;				/* Program name */
+static u_int batch;				/* Keys per batch */
+static u_int nkeys;				/* Keys per phase */
+static u_int nbatches;				/* Batches */
+
+static void die(const char *, int);
+static int  expect(u_int, u_int, char *, size_t *);
+static void keygen(u_int, u_int, char *, WT_ITEM *);
+static void load(WT_SESSION *);
+static void run(WT_SESSION *);
+static uint64_t stat_get(WT_SESSION *, int);
+static int  usage(void);
+static void wait_flush(WT_SESSION *);
+
+int
+main(int argc, char *argv[])
+{
+	WT_CONNECTION *conn;
+	WT_SESSION *session;
+	int ch, ret;
+	char *config_open;
+
+	if ((progname = strrchr(argv[0], '/')) == NULL)
+		progname = argv[0];
+	else
+		++progname;
+
+	batch = 500;
+	config_open = NULL;
+	nbatches = 50;
+	nkeys = 20000;
+
+	while ((ch = getopt(argc, argv, "b:C:k:n:")) != EOF)
+		switch (ch) {
+		case 'b':			/* keys per batch */
+			batch = (u_int)atoi(optarg);
+			break;
+		case 'C':			/* wiredtiger_open config */
+			config_open = optarg;
+			break;
+		case 'k':			/* keys per phase */
+			nkeys = (u_int)atoi(optarg);
+			break;
+		case 'n':			/* batches */
+			nbatches = (u_int)atoi(optarg);
+			break;
+		default:
+			return (usage());
+		}
+	argc -= optind;
+	argv += optind;
+	if (argc != 0 || batch < 2 || nkeys < 10)
+		return (usage());
+
+	(void)system("rm -f WiredTiger* __batch*");
+
+	/*
+	 * Merges would combine the chunks: turn them off so the batches see
+	 * several chunks, with different key ranges.
+	 */
+	if ((ret = wiredtiger_open(NULL, NULL,
+	    config_open == NULL ? "create,lsm_merge=false" : config_open,
+	    &conn)) != 0)
+		die("wiredtiger_open", ret);
+	if ((ret = conn->open_session(conn, NULL, NULL, &session)) != 0)
+		die("conn.session", ret);
+
+	load(session);
+	wait_flush(session);
+	run(session);
+
+	if ((ret = conn->close(conn, NULL)) != 0)
+		die("conn.close", ret);
+
+	return (EXIT_SUCCESS);
+}
+
+/*
+ * keygen --
+ *	Build the key for a record in a phase.  Keys sort by phase, and only
+ *	even record numbers are loaded: odd numbers, and numbers past the end
+ *	of the phase, are missing from the middle and end of each range.
+ */
+static void
+keygen(u_int phase, u_int recno, char *buf, WT_ITEM *key)
+{
+	key->data = buf;
+	key->size = (uint32_t)sprintf(buf, "%u%010u", phase, recno);
+}
+
+/*
+ * expect --
+ *	Return the expected value for a key, or WT_NOTFOUND.  The newest phase
+ *	removes the oldest phase's keys with record numbers that are multiples
+ *	of 20, and replaces the values of those 10 past a multiple of 20 with
+ *	large values, so a batch of them has to grow the cursor's value buffer.
+ */
+static int
+expect(u_int phase, u_int recno, char *buf, size_t *sizep)
+{
+	size_t len;
+
+	if (phase >= PHASES || recno % 2 != 0 || recno >= 2 * nkeys)
+		return (WT_NOTFOUND);
+	if (phase == 0 && recno % 20 == 0)
+		return (WT_NOTFOUND);
+	if (phase == 0 && recno % 20 == 10) {
+		len = VALUE_LARGE + recno % VALUE_LARGE;
+		memset(buf, 'a' + (int)(recno % 26), len);
+		(void)sprintf(buf, "updated %u.%u", phase, recno);
+		*sizep = len;
+		return (0);
+	}
+	*sizep = (size_t)sprintf(buf, "value %u.%u", phase, recno);
+	return (0);
+}
+
+/*
+ * load --
+ *	Load the phases.
+ */
+static void
+load(WT_SESSION *session)
+{
+	WT_CURSOR *cursor;
+	WT_ITEM key, value;
+	size_t len;
+	u_int phase, recno;
+	int ret;
+	char kbuf[64], vbuf[2 * VALUE_LARGE];
+
+	/*
+	 * Small chunks, so each phase fills several, and Bloom filters on the
+	 * chunks as they're written, without waiting for a merge.
+	 */
+	if ((ret = session->create(session, URI,
+	    "key_format=u,value_format=u,"
+	    "lsm_chunk_size=512KB,lsm_bloom_newest=true")) != 0)
+		die("session.create", ret);
+	if ((ret = session->open_cursor(
+	    session, URI, NULL, NULL, &cursor)) != 0)
+		die("session.open_cursor", ret);
+
+	for (phase = 0; phase < PHASES; ++phase) {
+		for (recno = 0; recno < 2 * nkeys; recno += 2) {
+			keygen(phase, recno, kbuf, &key);
+			cursor->set_key(cursor, &key);
+			len = (size_t)sprintf(
+			    vbuf, "value %u.%u", phase, recno);
+			value.data = vbuf;
+			value.size = (uint32_t)len;
+			cursor->set_value(cursor, &value);
+			if ((ret = cursor->insert(cursor)) != 0)
+				die("cursor.insert", ret);
+		}
+
+		if (phase != PHASES - 1)
+			continue;
+		for (recno = 0; recno < 2 * nkeys; recno += 10) {
+			keygen(0, recno, kbuf, &key);
+			cursor->set_key(cursor, &key);
+			if (recno % 20 == 0)
+				ret = cursor->remove(cursor);
+			else {
+				(void)expect(0, recno, vbuf, &len);
+				value.data = vbuf;
+				value.size = (uint32_t)len;
+				cursor->set_value(cursor, &value);
+				ret = cursor->insert(cursor);
+			}
+			if (ret != 0)
+				die("cursor.update", ret);
+		}
+	}
+
+	if ((ret = cursor->close(cursor)) != 0)
+		die("cursor.close", ret);
+}
+
+/*
+ * stat_get --
+ *	Return a statistic for the tree.
+ */
+static uint64_t
+stat_get(WT_SESSION *session, int which)
+{
+	WT_CURSOR *cursor;
+	uint64_t v;
+	int ret;
+	const char *desc, *pvalue;
+
+	if ((ret = session->open_cursor(
+	    session, STAT_URI, NULL, NULL, &cursor)) != 0)
+		die("session.open_cursor: statistics", ret);
+	cursor->set_key(cursor, which);
+	if ((ret = cursor->search(cursor)) != 0 ||
+	    (ret = cursor->get_value(cursor, &desc, &pvalue, &v)) != 0)
+		die("statistics search", ret);
+	if ((ret = cursor->close(cursor)) != 0)
+		die("cursor.close: statistics", ret);
+	return (v);
+}
+
+/*
+ * wait_flush --
+ *	Wait for the chunks written from memory to have Bloom filters: all
+ *	but the active chunk, and the empty chunk created with the tree, which
+ *	the first update switched out.
+ */
+static void
+wait_flush(WT_SESSION *session)
+{
+	uint64_t blooms, chunks;
+	u_int i;
+
+	for (i = 0; i < 120; ++i) {
+		chunks = stat_get(session, WT_STAT_chunk_count);
+		blooms = stat_get(session, WT_STAT_bloom_count);
+		if (chunks > PHASES && blooms == chunks - 2)
+			return;
+		(void)sleep(1);
+	}
+	fprintf(stderr, "%s: chunks not flushed: %" PRIu64
+	    " chunks, %" PRIu64 " Bloom filters\n", progname, chunks, blooms);
+	exit(EXIT_FAILURE);
+}
+
+/*
+ * run --
+ *	Search random batches of keys and check the results.
+ */
+static void
+run(WT_SESSION *session)
+{
+	WT_CURSOR *cursor, *file;
+	WT_ITEM *keys, *values;
+	size_t len;
+	u_int i, j, large, *phases, *recnos;
+	int *results, ret;
+	char *kbufs, vbuf[2 * VALUE_LARGE];
+
+	if ((keys = calloc(batch, sizeof(*keys))) == NULL ||
+	    (values = calloc(batch, sizeof(*values))) == NULL ||
+	    (results = calloc(batch, sizeof(*results))) == NULL ||
+	    (phases = calloc(batch, sizeof(*phases))) == NULL ||
+	    (recnos = calloc(batch, sizeof(*recnos))) == NULL ||
+	    (kbufs = calloc(batch, 64)) == NULL)
+		die("calloc", errno);
+
+	if ((ret = session->open_cursor(
+	    session, URI, NULL, NULL, &cursor)) != 0)
+		die("session.open_cursor", ret);
+
+	/* An empty batch does nothing. */
+	if ((ret = cursor->search_batch(cursor, keys, values, results, 0)) != 0)
+		die("cursor.search_batch: empty batch", ret);
+
+	srand(3233456);
+	for (i = large = 0; i < nbatches; ++i) {
+		/*
+		 * Choose keys from every phase, and past the last, with a
+		 * duplicate at the end of each batch.
+		 */
+		for (j = 0; j < batch - 1; ++j) {
+			phases[j] = (u_int)rand() % (PHASES + 1);
+			recnos[j] = (u_int)rand() % (2 * nkeys + 100);
+			keygen(phases[j],
+			    recnos[j], kbufs + 64 * j, &keys[j]);
+		}
+		phases[j] = phases[0];
+		recnos[j] = recnos[0];
+		keys[j] = keys[0];
+
+		/*
+		 * The first batch is a single key, so the following batches
+		 * grow a buffer that has already been allocated.
+		 */
+		if ((ret = cursor->search_batch(cursor,
+		    keys, values, results, i == 0 ? 1 : batch)) != 0)
+			die("cursor.search_batch", ret);
+
+		for (j = 0; j < (i == 0 ? 1 : batch); ++j) {
+			ret = expect(phases[j], recnos[j], vbuf, &len);
+			if (results[j] != ret) {
+				fprintf(stderr, "%s: batch %u key %.*s: "
+				    "expected %s, got %s\n", progname, i,
+				    (int)keys[j].size, (char *)keys[j].data,
+				    wiredtiger_strerror(ret),
+				    wiredtiger_strerror(results[j]));
+				exit(EXIT_FAILURE);
+			}
+			if (ret != 0)
+				continue;
+			if (values[j].size != len ||
+			    memcmp(values[j].data, vbuf, len) != 0) {
+				fprintf(stderr, "%s: batch %u key %.*s: "
+				    "value mismatch\n", progname, i,
+				    (int)keys[j].size, (char *)keys[j].data);
+				exit(EXIT_FAILURE);
+			}
+			if (len >= VALUE_LARGE)
+				++large;
+		}
+	}
+	if (large == 0) {
+		fprintf(stderr, "%s: no large values found\n", progname);
+		exit(EXIT_FAILURE);
+	}
+
+	/*
+	 * Keys outside a chunk's range skip the chunk without probing its
+	 * Bloom filter, keys in range but not in the chunk are (mostly)
+	 * stopped by the Bloom filter: both have to have happened.
+	 */
+	if (stat_get(session, WT_STAT_search_range_skips) == 0) {
+		fprintf(stderr, "%s: no key range skips\n", progname);
+		exit(EXIT_FAILURE);
+	}
+	if (stat_get(session, WT_STAT_bloom_misses) == 0) {
+		fprintf(stderr, "%s: no Bloom filter misses\n", progname);
+		exit(EXIT_FAILURE);
+	}
+
+	if ((ret = cursor->close(cursor)) != 0)
+		die("cursor.close", ret);
+
+	/* Other cursor types don't support batches. */
+	if ((ret = session->create(session,
+	    "file:__batch.wt", "key_format=u,value_format=u")) != 0)
+		die("session.create: file", ret);
+	if ((ret = session->open_cursor(
+	    session, "file:__batch.wt", NULL, NULL, &file)) != 0)
+		die("session.open_cursor: file", ret);
+	if ((ret = file->search_batch(
+	    file, keys, values, results, 1)) != ENOTSUP)
+		die("cursor.search_batch: file", ret);
+	if ((ret = file->close(file)) != 0)
+		die("cursor.close: file", ret);
+
+	free(keys);
+	free(values);
+	free(results);
+	free(phases);
+	free(recnos);
+	free(kbufs);
+}
+
+/*
+ * die --
+ *	Report an error and quit.
+ */
+static void
+die(const char *m, int e)
+{
+	fprintf(stderr, "%s: %s: %s\n", progname, m, wiredtiger_strerror(e));
+	exit(EXIT_FAILURE);
+}
+
+/*
+ * usage --
+ *	Display usage statement and exit failure.
+ */
+static int
+usage(void)
+{
+	fprintf(stderr,
+	    "usage: %s [-b batch] [-C wiredtiger-config] [-k keys] [-n ops]\n",
+	    progname);
+	fprintf(stderr, "%s",
+	    "\t-b set number of keys in each batch\n"
+	    "\t-C specify wiredtiger_open configuration arguments\n"
+	    "\t-k set number of keys to load in each phase\n"
+	    "\t-n set number of batches\n");
+	return (EXIT_FAILURE);
+}
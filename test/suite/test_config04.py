@@ -150,6 +150,77 @@ class test_config04(wttest.WiredTigerTestCase):
                                        'eviction_trigger=86'),
             "/eviction target must be lower than the eviction trigger/")
 
+    def test_eviction_dirty(self):
+        self.common_test('eviction_dirty_target=50,eviction_dirty_trigger=70')
+
+    def test_eviction_dirty_bad(self):
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError, lambda:
+            wiredtiger.wiredtiger_open('.', 'create,' +
+                'eviction_dirty_target=70,eviction_dirty_trigger=70'),
+            "/eviction dirty target must be lower than the eviction " +
+            "dirty trigger/")
+
+    def test_lsm_merge_workers(self):
+        self.common_test('lsm_merge_workers=4')
+
+    def test_lsm_merge_workers_bad(self):
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: wiredtiger.wiredtiger_open('.',
+                'create,lsm_merge_workers=0'),
+            "/Value too small for key 'lsm_merge_workers' the minimum is/")
+
+    def test_read_ahead(self):
+        self.common_test('read_ahead_workers=4,read_ahead_pages=32')
+
+    def test_read_ahead_off(self):
+        self.common_test('read_ahead_workers=0')
+
+    def test_read_ahead_bad(self):
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: wiredtiger.wiredtiger_open('.',
+                'create,read_ahead_workers=21'),
+            "/Value too large for key 'read_ahead_workers' the maximum is/")
+
+    def test_io_backend_sync(self):
+        self.common_test('io_backend=sync')
+
+    def test_io_backend_threads(self):
+        self.common_test('io_backend=threads,io_threads=2')
+
+    def test_io_backend_io_uring(self):
+        # Falls back to I/O threads where io_uring isn't available.
+        self.common_test('io_backend=io_uring')
+
+    def test_io_backend_bad(self):
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: wiredtiger.wiredtiger_open('.',
+                'create,io_backend=aio'),
+            "/Value 'aio' not a permitted choice for key 'io_backend'/")
+
+    def test_io_threads_bad(self):
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: wiredtiger.wiredtiger_open('.',
+                'create,io_backend=threads,io_threads=0'),
+            "/Value too small for key 'io_threads' the minimum is/")
+
+    def test_buffer_pool_size(self):
+        self.common_test('buffer_pool_size=1MB')
+
+    def test_buffer_pool_size_off(self):
+        self.common_test('buffer_pool_size=0')
+
+    def test_buffer_alignment_bad(self):
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: wiredtiger.wiredtiger_open('.',
+                'create,buffer_alignment=100'),
+            "/buffer_alignment must be a power of two/")
+
+    def test_direct_io_alignment_bad(self):
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: wiredtiger.wiredtiger_open('.',
+                'create,direct_io=[data],buffer_alignment=4096'),
+            "/direct_io=\\[data\\] requires a buffer_alignment/")
+
     def test_hazard_max(self):
         # Note: There isn't any direct way to know that this was set.
         self.common_test('hazard_max=50')
@@ -78,9 +78,8 @@ class test_lsm01(wttest.WiredTigerTestCase):
             'Test LSM with config: ' + args + ' count: ' + str(self.nrecs))
         simple_populate(self, self.uri, args, self.nrecs)
 
-        # TODO: Adding an explicit drop here can cause deadlocks, if a merge
-        # is still happening. See issue #349.
-        # self.session.drop(self.uri)
+        # Drop the tree, a merge may still be happening.
+        self.session.drop(self.uri, None)
 
 if __name__ == '__main__':
     wttest.run()
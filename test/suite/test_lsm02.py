@@ -0,0 +1,71 @@
+#!/usr/bin/env python
+#
+# Public Domain 2008-2012 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+import wiredtiger, wttest
+from helper import simple_populate, simple_populate_check
+
+# test_lsm02.py
+#    Test the pool of LSM merge workers shared by multiple trees.
+class test_lsm02(wttest.WiredTigerTestCase):
+    ntrees = 3
+    nrecs = 100000
+
+    scenarios = [
+        ('one-worker', dict(workers=1)),
+        ('two-workers', dict(workers=2)),
+        ('many-workers', dict(workers=8)),
+    ]
+
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir,
+            'create,lsm_merge_workers=' + str(self.workers))
+        self.pr(`conn`)
+        return conn
+
+    def uri(self, i):
+        return 'lsm:test_lsm02_' + str(i)
+
+    # Populate several trees with small chunks so they all need merges, then
+    # check their contents.
+    def test_lsm_merge_workers(self):
+        for i in range(self.ntrees):
+            simple_populate(self, self.uri(i), 'key_format=S' +
+                ',lsm_chunk_size=1MB,lsm_merge_max=4', self.nrecs)
+        for i in range(self.ntrees):
+            simple_populate_check(self, self.uri(i))
+
+    # Drop trees while the merge workers may still be merging them.
+    def test_lsm_merge_workers_drop(self):
+        for i in range(self.ntrees):
+            simple_populate(self, self.uri(i), 'key_format=S' +
+                ',lsm_chunk_size=1MB,lsm_merge_max=4', self.nrecs)
+        for i in range(self.ntrees):
+            self.session.drop(self.uri(i), None)
+
+if __name__ == '__main__':
+    wttest.run()
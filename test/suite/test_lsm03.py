@@ -0,0 +1,81 @@
+#!/usr/bin/env python
+#
+# Public Domain 2008-2012 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+
+import wiredtiger, wttest
+from helper import key_populate, simple_populate, simple_populate_check
+
+# test_lsm03.py
+#    Test the LSM merge policies.
+class test_lsm03(wttest.WiredTigerTestCase):
+    uri = 'lsm:test_lsm03'
+    nrecs = 100000
+
+    scenarios = [
+        ('tiered', dict(policy='tiered')),
+        ('leveled', dict(policy='leveled')),
+    ]
+
+    def config(self):
+        return 'key_format=S,lsm_chunk_size=512KB,lsm_merge_max=4,' + \
+            'lsm_merge_policy=' + self.policy
+
+    # Populate a tree with small chunks so it needs merges, then check its
+    # contents, including after the tree is reopened.
+    def test_lsm_merge_policy(self):
+        simple_populate(self, self.uri, self.config(), self.nrecs)
+        simple_populate_check(self, self.uri)
+        self.reopen_conn()
+        simple_populate_check(self, self.uri)
+
+    # Remove records, which leaves tombstones for merges to discard, and
+    # check they stay removed.
+    def test_lsm_merge_policy_remove(self):
+        simple_populate(self, self.uri, self.config(), self.nrecs)
+        cursor = self.session.open_cursor(self.uri, None)
+        for i in range(1, self.nrecs, 3):
+            cursor.set_key(key_populate(cursor, i))
+            self.assertEqual(cursor.remove(), 0)
+        cursor.close()
+        self.reopen_conn()
+        cursor = self.session.open_cursor(self.uri, None)
+        count = 0
+        for key,val in cursor:
+            self.assertNotEqual((int(key) - 1) % 3, 0)
+            count += 1
+        self.assertEqual(count, self.nrecs - 1 - len(range(1, self.nrecs, 3)))
+        cursor.close()
+
+    def test_lsm_merge_policy_bad(self):
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.create(self.uri,
+                'key_format=S,value_format=S,lsm_merge_policy=other'),
+            "/not a permitted choice for key 'lsm_merge_policy'/")
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,118 @@
+#!/usr/bin/env python
+#
+# Public Domain 2008-2012 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+
+import wiredtiger, wttest
+from helper import key_populate, simple_populate
+
+# test_lsm04.py
+#    Test LSM chunks are skipped using their key ranges.
+class test_lsm04(wttest.WiredTigerTestCase):
+    uri = 'lsm:test_lsm04'
+    nrecs = 100000
+
+    # Keep the chunks separate, so each has a narrow range of keys.
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir,
+            'create,lsm_merge=false,error_prefix="' + self.shortid() + ': "')
+        self.pr(`conn`)
+        return conn
+
+    def range_skips(self):
+        cursor = self.session.open_cursor('statistics:' + self.uri, None)
+        for id, desc, valstr, val in cursor:
+            if desc.startswith('Number of chunk searches skipped'):
+                cursor.close()
+                return val
+        cursor.close()
+        self.fail('no chunk search skip statistic')
+
+    # Insert keys in order into small chunks, then reopen so the chunks are
+    # on disk with known key ranges.
+    def populate(self):
+        simple_populate(self, self.uri,
+            'key_format=S,lsm_chunk_size=512KB', self.nrecs)
+        self.reopen_conn()
+
+    def test_lsm_range_search(self):
+        self.populate()
+        cursor = self.session.open_cursor(self.uri, None)
+        for i in range(1, self.nrecs, 97):
+            cursor.set_key(key_populate(cursor, i))
+            self.assertEqual(cursor.search(), 0)
+            self.assertEqual(cursor.get_key(), key_populate(cursor, i))
+        for i in (0, self.nrecs, self.nrecs * 2):
+            cursor.set_key(key_populate(cursor, i))
+            self.assertEqual(cursor.search(), wiredtiger.WT_NOTFOUND)
+        cursor.close()
+        self.assertTrue(self.range_skips() > 0)
+
+    def test_lsm_range_search_near(self):
+        self.populate()
+        cursor = self.session.open_cursor(self.uri, None)
+
+        # Keys between records find the next record.
+        for i in range(1, self.nrecs - 1, 997):
+            cursor.set_key(key_populate(cursor, i) + 'a')
+            self.assertEqual(cursor.search_near(), 1)
+            self.assertEqual(cursor.get_key(), key_populate(cursor, i + 1))
+
+        # Keys before the first record and after the last record.
+        cursor.set_key(key_populate(cursor, 0))
+        self.assertEqual(cursor.search_near(), 1)
+        self.assertEqual(cursor.get_key(), key_populate(cursor, 1))
+        cursor.set_key(key_populate(cursor, self.nrecs * 2))
+        self.assertEqual(cursor.search_near(), -1)
+        self.assertEqual(cursor.get_key(), key_populate(cursor, self.nrecs - 1))
+        cursor.close()
+
+    def test_lsm_range_scan(self):
+        self.populate()
+        cursor = self.session.open_cursor(self.uri, None)
+        start = self.nrecs / 2
+
+        # Scan forward and backward from the middle of the keys.
+        cursor.set_key(key_populate(cursor, start))
+        self.assertEqual(cursor.search(), 0)
+        count = 1
+        while cursor.next() == 0:
+            count += 1
+            self.assertEqual(cursor.get_key(), key_populate(cursor, start + count - 1))
+        self.assertEqual(count, self.nrecs - start)
+
+        cursor.set_key(key_populate(cursor, start))
+        self.assertEqual(cursor.search(), 0)
+        count = 1
+        while cursor.prev() == 0:
+            count += 1
+            self.assertEqual(cursor.get_key(), key_populate(cursor, start - count + 1))
+        self.assertEqual(count, start)
+        cursor.close()
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,69 @@
+#!/usr/bin/env python
+#
+# Public Domain 2008-2012 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+
+import wiredtiger, wttest
+from helper import simple_populate, simple_populate_check
+
+# test_lsm05.py
+#    Test writes to LSM trees are throttled while merges catch up.
+class test_lsm05(wttest.WiredTigerTestCase):
+    uri = 'lsm:test_lsm05'
+    nrecs = 100000
+
+    def stat(self, lookfor):
+        cursor = self.session.open_cursor('statistics:' + self.uri, None)
+        for id, desc, valstr, val in cursor:
+            if desc == lookfor:
+                cursor.close()
+                return val
+        cursor.close()
+        self.fail('in stats, did not see: ' + lookfor)
+
+    # With low limits, writes are slowed down, but they all complete.
+    def test_lsm_throttle(self):
+        simple_populate(self, self.uri, 'key_format=S,lsm_chunk_size=512KB,' +
+            'lsm_throttle_chunks=1,lsm_stall_chunks=3', self.nrecs)
+        self.assertTrue(self.stat(
+            'Number of writes slowed down to wait for merges') > 0)
+        simple_populate_check(self, self.uri)
+        self.reopen_conn()
+        simple_populate_check(self, self.uri)
+
+    # With the limits disabled, writes are never slowed down.
+    def test_lsm_throttle_off(self):
+        simple_populate(self, self.uri, 'key_format=S,lsm_chunk_size=512KB,' +
+            'lsm_throttle_chunks=0,lsm_stall_chunks=0', self.nrecs)
+        self.assertEqual(self.stat(
+            'Number of writes slowed down to wait for merges'), 0)
+        self.assertEqual(self.stat(
+            'Number of writes stopped until merges caught up'), 0)
+        simple_populate_check(self, self.uri)
+
+if __name__ == '__main__':
+    wttest.run()
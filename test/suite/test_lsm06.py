@@ -0,0 +1,68 @@
+#!/usr/bin/env python
+#
+# Public Domain 2008-2012 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+
+
+import wiredtiger, wttest
+from helper import simple_populate, simple_populate_check
+
+# test_lsm06.py
+#    Test LSM chunks are flushed by the connection's pool of workers.
+class test_lsm06(wttest.WiredTigerTestCase):
+    uri = 'lsm:test_lsm06'
+    nrecs = 100000
+
+    scenarios = [
+        ('1', dict(workers=1)),
+        ('4', dict(workers=4)),
+    ]
+
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir,
+            'create,lsm_flush_workers=' + str(self.workers) +
+            ',error_prefix="' + self.shortid() + ': "')
+        self.pr(`conn`)
+        return conn
+
+    # Fill several trees at once, so chunks from all of them are queued.
+    def test_lsm_flush(self):
+        uris = [self.uri + str(i) for i in range(3)]
+        for uri in uris:
+            simple_populate(self, uri,
+                'key_format=S,lsm_chunk_size=512KB', self.nrecs)
+        for uri in uris:
+            simple_populate_check(self, uri)
+
+        # Dropping a tree discards its chunks waiting to be flushed.
+        self.session.drop(uris[0], None)
+        self.reopen_conn()
+        for uri in uris[1:]:
+            simple_populate_check(self, uri)
+
+if __name__ == '__main__':
+    wttest.run()
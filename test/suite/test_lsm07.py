@@ -0,0 +1,80 @@
+#!/usr/bin/env python
+#
+# Public Domain 2008-2012 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+
+
+import wiredtiger, wttest
+from helper import key_populate, simple_populate
+
+# test_lsm07.py
+#    Test merges drop removed records while keeping those that hide records
+#    in older chunks.
+class test_lsm07(wttest.WiredTigerTestCase):
+    uri = 'lsm:test_lsm07'
+    nrecs = 50000
+
+    scenarios = [
+        ('tiered', dict(policy='tiered')),
+        ('leveled', dict(policy='leveled')),
+    ]
+
+    # Remove every third record of the original set, then repeatedly insert
+    # and remove a second set of records, so merges see removed records both
+    # with and without older versions.
+    def test_lsm_tombstones(self):
+        simple_populate(self, self.uri, 'key_format=S,lsm_chunk_size=512KB,' +
+            'lsm_merge_policy=' + self.policy, self.nrecs)
+        cursor = self.session.open_cursor(self.uri, None)
+        for i in range(1, self.nrecs, 3):
+            cursor.set_key(key_populate(cursor, i))
+            cursor.remove()
+        for round in range(3):
+            for i in range(self.nrecs, 3 * self.nrecs):
+                cursor.set_key(key_populate(cursor, i))
+                cursor.set_value(str(round))
+                cursor.insert()
+            for i in range(self.nrecs, 3 * self.nrecs, 2):
+                cursor.set_key(key_populate(cursor, i))
+                cursor.remove()
+        cursor.close()
+
+        self.check()
+        self.reopen_conn()
+        self.check()
+
+    def check(self):
+        expect = [i for i in range(1, self.nrecs) if (i - 1) % 3 != 0] + \
+            range(self.nrecs + 1, 3 * self.nrecs, 2)
+        cursor = self.session.open_cursor(self.uri, None)
+        expect = [key_populate(cursor, i) for i in expect]
+        keys = [key for key, val in cursor]
+        cursor.close()
+        self.assertEqual(keys, expect)
+
+if __name__ == '__main__':
+    wttest.run()
@@ -37,6 +37,11 @@ class test_stat01(wttest.WiredTigerTestCase):
     tablename = 'test_stat01.wt'
     nentries = 25
 
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir, 'create,eviction_workers=2')
+        self.pr(`conn`)
+        return conn
+
     def statstr_to_int(self, str):
         """
         Convert a statistics value string, which may be in either form:
@@ -114,5 +119,18 @@ class test_stat01(wttest.WiredTigerTestCase):
                           lambda: self.session.open_cursor(
                               'statistics:file:DoesNotExist', None, None))
 
+    def test_evict_worker_statistics(self):
+        for i in range(0, 2):
+            uri = 'statistics:evict_worker:' + str(i)
+            self.printVerbose(2, 'eviction worker ' + str(i) + ' stats:')
+            statcursor = self.session.open_cursor(uri, None, None)
+            self.check_stats(statcursor, 2, 'eviction worker: pages evicted')
+            statcursor.close()
+
+        for uri in ('statistics:evict_worker:', 'statistics:evict_worker:2',
+                    'statistics:evict_worker:x'):
+            self.assertRaises(wiredtiger.WiredTigerError,
+                              lambda: self.session.open_cursor(uri, None, None))
+
 if __name__ == '__main__':
     wttest.run()
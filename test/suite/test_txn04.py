@@ -0,0 +1,114 @@
+#!/usr/bin/env python
+#
+# Public Domain 2008-2012 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_txn04.py
+#   Transactions: write-ahead logging of commits
+#
+
+import glob, os
+import wiredtiger, wttest
+from wtscenario import multiply_scenarios, number_scenarios
+
+class test_txn04(wttest.WiredTigerTestCase):
+    tablename = 'test_txn04'
+    uri = 'table:' + tablename
+    nentries = 100
+
+    types = [
+        ('row', dict(create_params = "key_format=i,value_format=S")),
+        ('var', dict(create_params = "key_format=r,value_format=S")),
+    ]
+    syncs = [
+        ('full', dict(sync='full', logged=True)),
+        ('flush', dict(sync='flush', logged=True)),
+        ('write', dict(sync='write', logged=True)),
+        ('none', dict(sync='none', logged=False)),
+    ]
+    scenarios = number_scenarios(multiply_scenarios('.', types, syncs))
+
+    # Overrides WiredTigerTestCase
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir, 'create,' +
+                ('error_prefix="%s: ",' % self.shortid()) +
+                'logging,transactional,')
+        self.pr(`conn`)
+        return conn
+
+    def log_records(self):
+        c = self.session.open_cursor('statistics:', None, None)
+        c.set_key(wiredtiger.stat.log_records)
+        self.assertEqual(c.search(), 0)
+        val = c.get_values()[2]
+        c.close()
+        return val
+
+    def test_log(self):
+        self.session.create(self.uri, self.create_params)
+        self.assertTrue(glob.glob('WiredTigerLog.*'))
+
+        before = self.log_records()
+        c = self.session.open_cursor(self.uri, None)
+        for i in xrange(1, self.nentries + 1):
+            self.session.begin_transaction('sync=' + self.sync)
+            c.set_key(i)
+            c.set_value(str(i))
+            c.insert()
+            if i % 2 == 0:
+                c.set_key(i)
+                c.remove()
+            self.session.commit_transaction()
+        c.close()
+
+        # Each transaction is logged in a single commit record.
+        if self.logged:
+            self.assertEqual(self.log_records(), before + self.nentries)
+        else:
+            self.assertEqual(self.log_records(), before)
+
+        # Rolled-back transactions aren't logged.
+        before = self.log_records()
+        c = self.session.open_cursor(self.uri, None)
+        self.session.begin_transaction('sync=' + self.sync)
+        c.set_key(self.nentries + 1)
+        c.set_value('rollback')
+        c.insert()
+        self.session.rollback_transaction()
+        c.close()
+        self.assertEqual(self.log_records(), before)
+
+        # Reopening the connection starts a new log file.
+        last = max(glob.glob('WiredTigerLog.*'))
+        self.reopen_conn()
+        current = max(glob.glob('WiredTigerLog.*'))
+        self.assertTrue(current > last)
+
+        # A checkpoint removes the log files recovery no longer needs.
+        self.session.checkpoint(None)
+        self.assertEqual(glob.glob('WiredTigerLog.*'), [current])
+
+if __name__ == '__main__':
+    wttest.run()
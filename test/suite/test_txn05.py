@@ -0,0 +1,107 @@
+#!/usr/bin/env python
+#
+# Public Domain 2008-2012 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_txn05.py
+#   Transactions: recovery from the log
+#
+
+import glob, os, shutil
+import wiredtiger, wttest
+from wtscenario import multiply_scenarios, number_scenarios
+
+class test_txn05(wttest.WiredTigerTestCase):
+    tablename = 'test_txn05'
+    uri = 'table:' + tablename
+    nentries = 1000
+    backup_dir = 'BACKUP'
+
+    types = [
+        ('row', dict(create_params = "key_format=i,value_format=S")),
+        ('var', dict(create_params = "key_format=r,value_format=S")),
+        ('fix', dict(create_params = "key_format=r,value_format=8t")),
+    ]
+    checkpoints = [
+        ('none', dict(checkpoint=False)),
+        ('checkpoint', dict(checkpoint=True)),
+    ]
+    scenarios = number_scenarios(
+        multiply_scenarios('.', types, checkpoints))
+
+    # Overrides WiredTigerTestCase
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir, 'create,' +
+                ('error_prefix="%s: ",' % self.shortid()) +
+                'logging,transactional,')
+        self.pr(`conn`)
+        return conn
+
+    def value(self, i):
+        if self.create_params.endswith('8t'):
+            return i % 100 + 1
+        return str(i)
+
+    def check(self, session):
+        # Every third record was removed: fixed-length column-stores return
+        # removed records as 0, other stores skip them.
+        fix = self.create_params.endswith('8t')
+        expected = [(i, self.value(i)) for i in xrange(1, self.nentries + 1)
+            if fix or i % 3 != 0]
+        if fix:
+            expected = [(k, 0 if k % 3 == 0 else v) for k, v in expected]
+        c = session.open_cursor(self.uri, None)
+        self.assertEqual([(k, v) for k, v in c], expected)
+        c.close()
+
+    def test_recovery(self):
+        self.session.create(self.uri, self.create_params)
+
+        c = self.session.open_cursor(self.uri, None)
+        for i in xrange(1, self.nentries + 1):
+            if self.checkpoint and i == self.nentries / 2:
+                self.session.checkpoint()
+            self.session.begin_transaction('sync=full')
+            c.set_key(i)
+            c.set_value(self.value(i))
+            c.insert()
+            if i % 3 == 0:
+                c.set_key(i)
+                c.remove()
+            self.session.commit_transaction()
+        c.close()
+
+        # Copy the database while it's open, as if the process had crashed,
+        # then open the copy: its changes are recovered from the log.
+        os.mkdir(self.backup_dir)
+        for f in glob.glob('WiredTiger*') + glob.glob(self.tablename + '*'):
+            shutil.copy(f, self.backup_dir)
+        conn = wiredtiger.wiredtiger_open(self.backup_dir, 'logging')
+        session = conn.open_session()
+        self.check(session)
+        conn.close()
+
+if __name__ == '__main__':
+    wttest.run()